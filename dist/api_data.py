@@ -92,6 +92,23 @@ file_config = format_meta + [
 		empty (off) or \c "bzip2", \c "snappy" or custom compression
 		engine \c "name" created with WT_CONNECTION::add_compressor.
 		See @ref compression for more information'''),
+	Config('cache_max', '0', r'''
+		the maximum bytes of the file's pages held in the cache.  If
+		non-zero, once the file's pages use more of the cache, they are
+		evicted before the pages of other files, even if the cache is
+		below its eviction target''',
+		min='0'),
+	Config('cache_min', '0', r'''
+		the bytes of the file's pages held in the cache that are not
+		evicted to make space for other files' pages''',
+		min='0'),
+	Config('cache_priority', '0', r'''
+		the priority of the file's pages in the cache, relative to other
+		files' pages.  A page in a file with priority \c N is evicted
+		as if it had been used after a further \c N percent of the
+		pages in the cache were used; negative priorities evict the
+		file's pages sooner''',
+		min='-100', max='100'),
 	Config('checksum', 'true', r'''
 		configure file block checksums; if false, the block
 		manager is free to not write or check block checksums.
@@ -157,6 +174,11 @@ file_config = format_meta + [
 
 # File metadata, including both configurable and non-configurable (internal)
 file_meta = file_config + [
+	Config('checkpoint_lsn', '0', r'''
+		the log position from which recovery replays the file's
+		changes'''),
+	Config('id', '0', r'''
+		the file's identifier in log records'''),
 	Config('root', '', r'''
 		the root page address'''),
 	Config('version', '(major=0,minor=0)', r'''
@@ -180,6 +202,34 @@ index_meta = column_meta + filename_meta
 
 table_meta = format_meta + table_only_meta
 
+connection_runtime_config = [
+	Config('cache_size', '100MB', r'''
+		maximum heap memory to allocate for the cache''',
+		min='1MB', max='10TB'),
+	Config('eviction_dirty_target', '40', r'''
+		continue writing dirty pages until less of the cache than
+		this is dirty (as a percentage).  Must be less than
+		\c eviction_dirty_trigger''',
+		min=5, max=99),
+	Config('eviction_dirty_trigger', '60', r'''
+		trigger writing dirty pages when this much of the cache is
+		dirty (as a percentage)''',
+		min=5, max=99),
+	Config('eviction_target', '80', r'''
+		continue evicting until the cache becomes less full than this
+		(as a percentage).  Must be less than \c eviction_trigger''',
+		min=10, max=99),
+	Config('eviction_trigger', '95', r'''
+		trigger eviction when the cache becomes this full (as a
+		percentage)''',
+		min=10, max=99),
+	Config('hazard_max', '30', r'''
+		number of simultaneous hazard references per session handle.
+		Can be reconfigured, but not above the value the database was
+		opened with''',
+		min='15'),
+]
+
 methods = {
 'file.meta' : Method(file_meta),
 
@@ -255,7 +305,13 @@ methods = {
 		files''',
 		type='boolean'),
 ]),
-'session.sync' : Method([]),
+'session.sync' : Method([
+	Config('threads', '1', r'''
+		the number of threads writing the file's dirty pages, each
+		thread writes the pages below one of the root page's children
+		at a time''',
+		min='1', max='64'),
+]),
 'session.truncate' : Method([]),
 'session.upgrade' : Method([]),
 'session.verify' : Method([]),
@@ -269,8 +325,16 @@ methods = {
 	Config('name', '', r'''
 		name of the transaction for tracing and debugging'''),
 	Config('sync', 'full', r'''
-		how to sync log records when the transaction commits''',
-		choices=['full', 'flush', 'write', 'none']),
+		how durable the transaction's commit is when
+		WT_SESSION::commit_transaction returns, if logging is
+		enabled.  With \c full, the commit record is synced to disk;
+		with \c background, it is written to the log file and synced
+		by a background thread within the \c log_flush_period; with
+		\c write, it is written to the log file without being synced;
+		with \c none, it may only be buffered in memory.  Use
+		WT_SESSION::transaction_sync to wait for a commit to become
+		durable''',
+		choices=['full', 'background', 'write', 'none']),
 	Config('priority', 0, r'''
 		priority of the transaction for resolving conflicts.
 		Transactions with higher values are less likely to abort''',
@@ -279,11 +343,13 @@ methods = {
 
 'session.commit_transaction' : Method([]),
 'session.rollback_transaction' : Method([]),
+'session.transaction_sync' : Method([]),
 
 'session.checkpoint' : Method([
 	Config('archive', 'false', r'''
-		remove log files no longer required for transactional
-		durability''',
+		once the checkpoint completes, recycle or remove the log files
+		recovery no longer requires.  A recycled file is reused as the
+		next log file.  Ignored if \c flush_cache is false''',
 		type='boolean'),
 	Config('flush_cache', 'true', r'''
 		flush the cache''',
@@ -319,17 +385,43 @@ methods = {
 		make namespaces distinct or during upgrades'''),
 ]),
 
-'connection.open_session' : Method([]),
+'connection.reconfigure' : Method(connection_runtime_config),
+
+'connection.open_session' : Method([
+	Config('cache_cursors', 'false', r'''
+		cache closed cursors, and return a cached cursor from
+		WT_SESSION::open_cursor when the URI and configuration match
+		a closed cursor.  Defaults to the connection's \c cache_cursors
+		configuration''',
+		type='boolean'),
+]),
 
-'wiredtiger_open' : Method([
+'wiredtiger_open' : Method(connection_runtime_config + [
 	Config('buffer_alignment', '-1', r'''
 		in-memory alignment (in bytes) for buffers used for I/O.  By
 		default, a platform-specific alignment value is used (512 bytes
 		on Linux systems, zero elsewhere)''',
 		min='-1', max='1MB'),
-	Config('cache_size', '100MB', r'''
-		maximum heap memory to allocate for the cache''',
-		min='1MB', max='10TB'),
+	Config('cache_cursors', 'false', r'''
+		cache closed cursors in each session, and return a cached
+		cursor from WT_SESSION::open_cursor when the URI and
+		configuration match a closed cursor.  Cached cursors keep
+		their underlying files open.  May be overridden when a
+		session is opened''',
+		type='boolean'),
+	Config('cache_warm', 'false', r'''
+		save the addresses of the pages in the cache when the
+		connection is closed, and read the pages back into the cache
+		in the background when the database is next opened''',
+		type='boolean'),
+	Config('cache_warm_fill', '80', r'''
+		when reading the saved pages back into the cache, stop once
+		the cache is this percent full''',
+		min=1, max=100),
+	Config('cache_warm_threads', '2', r'''
+		the number of threads reading the saved pages back into the
+		cache, each reading the pages of one file at a time''',
+		min=1, max=20),
 	Config('create', 'false', r'''
 		create the database if it does not exist''',
 		type='boolean'),
@@ -355,17 +447,42 @@ methods = {
 		type='list'),
 	Config('error_prefix', '', r'''
 		prefix string for error messages'''),
-	Config('eviction_target', '80', r'''
-		continue evicting until the cache becomes less full than this
-		(as a percentage).  Must be less than \c eviction_trigger''',
-		min=10, max=99),
-	Config('eviction_trigger', '95', r'''
-		trigger eviction when the cache becomes this full (as a
-		percentage)''',
-		min=10, max=99),
-	Config('hazard_max', '30', r'''
-		number of simultaneous hazard references per session handle''',
-		min='15'),
+	Config('eviction_cleaners', '0', r'''
+		additional threads writing dirty pages when too much of the
+		cache is dirty.  Pages are written but stay in the cache, and
+		can then be evicted without being written.  If zero, the
+		eviction server thread writes the pages''',
+		min=0, max=20),
+	Config('eviction_policy', 'lru', r'''
+		the algorithm used to select pages for eviction.  The \c lru
+		policy evicts the least-recently used pages; the \c 2q and
+		\c clockpro policies are scan resistant, pages read once (for
+		example, by a cursor scan) are evicted before pages accessed
+		repeatedly''',
+		choices=['lru', '2q', 'clockpro']),
+	Config('eviction_workers', '0', r'''
+		additional threads to help evict pages from the cache.  The
+		eviction server thread fills the queue of pages to evict,
+		worker threads reconcile and discard pages from the queue''',
+		min=0, max=20),
+	Config('log_compressor', '', r'''
+		configure a compressor for log records.  Records of at least
+		128 bytes are compressed, using the custom compression engine
+		\c "name" created with WT_CONNECTION::add_compressor.  The
+		same compressor must be configured to read the log'''),
+	Config('log_file_size', '100MB', r'''
+		the size of a log file.  Log files are pre-allocated by a
+		background thread so log writes overwrite allocated blocks''',
+		min='1MB', max='2GB'),
+	Config('log_flush_bytes', '1MB', r'''
+		sync the log as soon as this many bytes of log records have
+		been written by transactions committed with \c sync=background,
+		rather than waiting for the \c log_flush_period''',
+		min='0'),
+	Config('log_flush_period', '100', r'''
+		the longest time, in milliseconds, before the log records of
+		transactions committed with \c sync=background are synced''',
+		min='1', max='60000'),
 	Config('logging', 'false', r'''
 		enable logging''',
 		type='boolean'),
@@ -374,10 +491,39 @@ methods = {
 		RPC server for primary processes and use RPC for secondary
 		processes). <b>Not yet supported in WiredTiger</b>''',
 		type='boolean'),
+	Config('page_reclaim', 'hazard', r'''
+		how threads pin pages in the cache.  With \c hazard, each
+		session publishes a hazard reference for every page it uses,
+		and eviction checks every session's hazard references before
+		discarding a page.  With \c epoch, pinning a page increments
+		the page's reference count, and discarded pages are freed
+		once every session has left the epoch in which the page was
+		evicted''',
+		choices=['hazard', 'epoch']),
+	Config('read_ahead', '0', r'''
+		the number of leaf pages read ahead of a cursor iterating
+		through a file, by background read threads.  If zero, pages
+		are only read when a cursor reaches them''',
+		min='0', max='64'),
+	Config('read_threads', '2', r'''
+		the number of threads reading pages ahead of cursors, if
+		\c read_ahead is non-zero''',
+		min='1', max='20'),
+	Config('recovery_threads', '4', r'''
+		the number of threads replaying the log when the database is
+		opened, each thread replays the records of one file at a
+		time''',
+		min='1', max='64'),
 	Config('session_max', '50', r'''
 		maximum expected number of sessions (including server
 		threads)''',
 		min='1'),
+	Config('statistics', 'true', r'''
+		maintain statistics counters.  Counters are sharded across
+		sessions and summed when a \c "statistics:" cursor is read;
+		if \c false, counters are not updated and statistics cursors
+		only return values computed when the cursor is opened''',
+		type='boolean'),
 	Config('transactional', 'false', r'''
 		support transactional semantics''',
 		type='boolean'),
@@ -394,9 +540,15 @@ methods = {
 		    'read',
 		    'readserver',
 		    'reconcile',
+		    'recovery',
 		    'salvage',
 		    'verify',
 		    'write']),
+	Config('write_threads', '0', r'''
+		the number of threads writing file blocks.  If non-zero, pages
+		written by eviction and checkpoints are queued for the write
+		threads rather than written by the thread reconciling them''',
+		min='0', max='64'),
 ]),
 }
 
@@ -405,6 +557,7 @@ flags = {
 # Internal routine flag declarations
 ###################################################
 	'direct_io' : [ 'DIRECTIO_DATA', 'DIRECTIO_LOG' ],
+	'log_write' : [ 'LOG_FLUSH', 'LOG_FSYNC' ],
 	'page_free' : [ 'PAGE_FREE_IGNORE_DISK' ],
 	'rec_evict' : [ 'REC_SINGLE' ],
 	'verbose' : [
@@ -417,6 +570,7 @@ flags = {
 		'VERB_read',
 		'VERB_readserver',
 		'VERB_reconcile',
+		'VERB_recovery',
 		'VERB_salvage',
 		'VERB_verify',
 		'VERB_write'
@@ -425,6 +579,9 @@ flags = {
 ###################################################
 # Structure flag declarations
 ###################################################
-	'conn' : [ 'SERVER_RUN' ],
-	'session' : [ 'SESSION_INTERNAL', 'SESSION_SALVAGE_QUIET_ERR' ],
+	'conn' : [ 'CACHE_CURSORS', 'EPOCH_RECLAIM', 'SERVER_RUN', 'STATISTICS' ],
+	'session' : [ 'SESSION_CACHE_CURSORS', 'SESSION_EVICT_CLOSE',
+	    'SESSION_INTERNAL', 'SESSION_NO_LOGGING', 'SESSION_NO_TXN',
+	    'SESSION_SALVAGE_QUIET_ERR' ],
+	'txn' : [ 'TXN_AUTOCOMMIT', 'TXN_RUNNING' ],
 }
@@ -177,5 +177,18 @@ __wt_confchk_%(name)s =
 			for c in sorted(ctype))) or [""]),
 })
 
+# Write the table of methods and their check strings, used to validate strings
+# being compiled.
+tfile.write('''
+WT_CONFIG_METHOD
+__wt_config_methods[] = {
+''')
+for name in sorted(api_data.methods.keys()):
+	tfile.write('\t{ "%s",\n\t    &__wt_confchk_%s },\n' %
+	    (name, name.replace('.', '_')))
+tfile.write('''\t{ NULL, NULL }
+};
+''')
+
 tfile.close()
 compare_srcfile(tmp_file, f)
@@ -9,12 +9,18 @@ tmp_file = '__tmp'
 
 # Map log record types to C
 c_types = {
+		'item' : 'WT_ITEM *',
 		'string' : 'const char *',
+		'uint32' : 'uint32_t',
+		'uint64' : 'uint64_t',
 }
 
 # Map log record types to format strings
 fmt_types = {
+		'item' : 'u',
 		'string' : 'S',
+		'uint32' : 'I',
+		'uint64' : 'Q',
 }
 
 #####################################################################
@@ -25,12 +31,36 @@ tfile = open(tmp_file, 'w')
 
 tfile.write('/* DO NOT EDIT: automatically built by dist/log.py. */\n')
 
+tfile.write('''
+#define	WT_LOGREC_MAX	%d		/* Largest log record type */
+''' % len(log_data.types))
+
+# Records changing a file are logged as operations, other records are written
+# directly.
 for t in log_data.types:
+	if t.fileop:
+		tfile.write('''
+static inline int
+__wt_logop_%(name)s(WT_SESSION_IMPL *session,
+    %(param_decl)s)
+{
+	return (__wt_log_op(
+	    session, &__wt_logdesc_%(name)s, %(param_list)s));
+}
+''' % {
+	'name' : t.name,
+	'param_decl' : ', '.join(
+	    '%s %s' % (c_types.get(t, t), n) for t, n in t.fields),
+	'param_list' : ', '.join(n for t, n in t.fields),
+})
+		continue
 	tfile.write('''
 static inline int
-__wt_logput_%(name)s(WT_SESSION_IMPL *session, %(param_decl)s)
+__wt_logput_%(name)s(WT_SESSION_IMPL *session,
+    WT_LSN *lsnp, uint32_t flags, %(param_decl)s)
 {
-	return (__wt_log_put(session, &__wt_logdesc_%(name)s, %(param_list)s));
+	return (__wt_log_put(
+	    session, lsnp, flags, &__wt_logdesc_%(name)s, %(param_list)s));
 }
 ''' % {
 	'name' : t.name,
@@ -53,18 +83,29 @@ tfile.write('''/* DO NOT EDIT: automatically built by dist/log.py. */
 #include "wt_internal.h"
 ''')
 
-for t in log_data.types:
+for rectype, t in enumerate(log_data.types, 1):
 	tfile.write('''
 WT_LOGREC_DESC
 __wt_logdesc_%(name)s =
 {
-	"%(fmt)s", { %(field_list)s, NULL }
+	%(rectype)d, "%(name)s", "%(fmt)s", %(apply)s,
+	{ %(field_list)s, NULL }
 };
 ''' % {
 	'name' : t.name,
+	'rectype' : rectype,
+	'apply' : '__wt_logapply_' + t.name if t.fileop else 'NULL',
 	'fmt' : ''.join(fmt_types[t] for t, n in t.fields),
 	'field_list' : ', '.join('"%s"' % n for t, n in t.fields),
 })
 
+tfile.write('''
+WT_LOGREC_DESC *
+__wt_logdesc_table[] = {
+	NULL,
+%s
+};
+''' % '\n'.join('\t&__wt_logdesc_%s,' % t.name for t in log_data.types))
+
 tfile.close()
 compare_srcfile(tmp_file, f)
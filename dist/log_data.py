@@ -1,10 +1,24 @@
 # Data for config.py, describes all configuration key / value pairs
 
 class LogRecordType:
-	def __init__(self, name, fields):
+	def __init__(self, name, fields, fileop=False):
 		self.name = name
+		self.fileop = fileop
+		# Records changing a file start with the file's ID.
+		if fileop:
+			fields = [('uint32', 'fileid')] + fields
 		self.fields = fields
 
+# A transaction's operations are packed into its commit record, operations
+# outside a transaction are logged as they're made.  Keys and values are the
+# cursor's packed WT_ITEMs.
 types = [
-	LogRecordType('debug', [('string', 'message')])
+	LogRecordType('debug', [('string', 'message')]),
+	LogRecordType('commit', [('uint64', 'txnid'), ('item', 'ops')]),
+	LogRecordType('row_put',
+	    [('item', 'key'), ('item', 'value')], fileop=True),
+	LogRecordType('row_remove', [('item', 'key')], fileop=True),
+	LogRecordType('col_put',
+	    [('uint64', 'recno'), ('item', 'value')], fileop=True),
+	LogRecordType('col_remove', [('uint64', 'recno')], fileop=True),
 ]
@@ -22,7 +22,7 @@ Serial('col_append', 'WT_SERIAL_FUNC', [
 		SerialArg('WT_INSERT ***', 'ins_stack'),
 		SerialArg('WT_INSERT_HEAD **', 'new_inslist', 1),
 		SerialArg('WT_INSERT_HEAD *', 'new_inshead', 1),
-		SerialArg('WT_INSERT *', 'new_ins', 1),
+		SerialArg('WT_INSERT *', 'new_ins'),
 		SerialArg('u_int', 'skipdepth'),
 	]),
 
@@ -32,12 +32,12 @@ Serial('evict_file', 'WT_SERIAL_EVICT', [
 
 Serial('insert', 'WT_SERIAL_FUNC', [
 		SerialArg('WT_PAGE *', 'page'),
-		SerialArg('uint32_t', 'write_gen'),
 		SerialArg('WT_INSERT_HEAD **', 'inshead'),
 		SerialArg('WT_INSERT ***', 'ins_stack'),
+		SerialArg('WT_INSERT **', 'next_stack'),
 		SerialArg('WT_INSERT_HEAD **', 'new_inslist', 1),
 		SerialArg('WT_INSERT_HEAD *', 'new_inshead', 1),
-		SerialArg('WT_INSERT *', 'new_ins', 1),
+		SerialArg('WT_INSERT *', 'new_ins'),
 		SerialArg('u_int', 'skipdepth'),
 	]),
 
@@ -49,10 +49,9 @@ Serial('row_key', 'WT_SERIAL_FUNC', [
 
 Serial('update', 'WT_SERIAL_FUNC', [
 		SerialArg('WT_PAGE *', 'page'),
-		SerialArg('uint32_t', 'write_gen'),
 		SerialArg('WT_UPDATE **', 'srch_upd'),
 		SerialArg('WT_UPDATE **', 'new_upd', 1),
-		SerialArg('WT_UPDATE *', 'upd', 1),
+		SerialArg('WT_UPDATE *', 'upd'),
 	]),
 ]
 
@@ -6,7 +6,7 @@ from dist import compare_srcfile
 from dist import source_paths_list
 
 # Read the source files.
-from stat_data import btree_stats, connection_stats
+from stat_data import btree_stats, connection_stats, evict_worker_stats
 
 # print_struct --
 #	Print the structures for the stat.h file.
@@ -20,7 +20,16 @@ def print_struct(title, name, list):
 	# disply is sorted by string.
 	for l in sorted(list, key=attrgetter('desc')):
 		f.write('\tWT_STATS ' + l.name + ';\n')
-	f.write('};\n\n')
+
+	# Pad the structure to a multiple of the cache line size, so adjacent
+	# copies of sharded statistics don't share cache lines.  That means
+	# the structure's size can't be used to count the entries.
+	f.write('\n\tuint8_t pad[WT_CACHE_LINE_ALIGNMENT -\n')
+	f.write('\t    (' + str(len(list)) +
+	    ' * sizeof(WT_STATS)) % WT_CACHE_LINE_ALIGNMENT];\n')
+	f.write('};\n')
+	f.write('#define\tWT_' + name.upper() + '_STATS_COUNT\t' +
+	    str(len(list)) + '\n\n')
 
 # Update the #defines in the stat.h file.
 tmp_file = '__tmp'
@@ -37,6 +46,7 @@ for line in open('../src/include/stat.h', 'r'):
 		skip = 1
 		print_struct('BTREE', 'btree', btree_stats)
 		print_struct('CONNECTION', 'connection', connection_stats)
+		print_struct('EVICT_WORKER', 'evict_worker', evict_worker_stats)
 f.close()
 compare_srcfile(tmp_file, '../src/include/stat.h')
 
@@ -74,6 +84,19 @@ def print_define():
 		f.write('#define\tWT_STAT_' + l.name + "\t" *
 		    max(1, 6 - int((len('WT_STAT_') + len(l.name)) / 8)) +
 		    str(v) + '\n')
+	f.write('''
+/*!
+ * @}
+ * @name Statistics for eviction worker threads
+ * @anchor statistics_evict_worker
+ * @{
+ */
+''')
+	for v, l in enumerate(sorted(evict_worker_stats, key=attrgetter('desc'))):
+		f.write('/*! %s */\n' % '\n * '.join(textwrap.wrap(l.desc, 70)))
+		f.write('#define\tWT_STAT_' + l.name + "\t" *
+		    max(1, 6 - int((len('WT_STAT_') + len(l.name)) / 8)) +
+		    str(v) + '\n')
 	f.write('/*! @} */\n')
 
 # Update the #defines in the wiredtiger.in file.
@@ -99,12 +122,12 @@ compare_srcfile(tmp_file, '../src/include/wiredtiger.in')
 def print_func(name, list):
 	f.write('''
 int
-__wt_stat_alloc_''' + name + '''_stats(WT_SESSION_IMPL *session, WT_''' +
-	    name.upper() + '''_STATS **statsp)
+__wt_stat_alloc_''' + name + '''_stats(WT_SESSION_IMPL *session,
+    u_int slots, WT_''' + name.upper() + '''_STATS **statsp)
 {
 \tWT_''' + name.upper() + '''_STATS *stats;
 
-\tWT_RET(__wt_calloc_def(session, 1, &stats));
+\tWT_RET(__wt_calloc_def(session, slots, &stats));
 
 ''')
 
@@ -141,5 +164,6 @@ f.write('#include "wt_internal.h"\n')
 
 print_func('btree', btree_stats)
 print_func('connection', connection_stats)
+print_func('evict_worker', evict_worker_stats)
 f.close()
 compare_srcfile(tmp_file, '../src/support/stat.c')
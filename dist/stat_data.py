@@ -18,24 +18,87 @@ class Stat:
 # CONNECTION statistics
 ##########################################
 connection_stats = [
+	Stat('arena_alloc', 'page arena: structures allocated'),
+	Stat('arena_chunk_alloc', 'page arena: chunks allocated'),
+	Stat('arena_chunk_bytes', 'page arena: bytes allocated in chunks'),
+	Stat('arena_chunk_free', 'page arena: chunks freed'),
+	Stat('arena_wasted', 'page arena: bytes of unused structures'),
 	Stat('block_read', 'blocks read from a file'),
 	Stat('block_write', 'blocks written to a file'),
+	Stat('cache_bytes_dirty', 'cache: modified bytes currently held in the cache', 'perm'),
 	Stat('cache_bytes_inuse', 'cache: bytes currently held in the cache', 'perm'),
 	Stat('cache_bytes_max', 'cache: maximum bytes configured', 'perm'),
+	Stat('cache_clean_fail', 'cache: dirty pages not written ahead of eviction because of an error'),
+	Stat('cache_clean_pages', 'cache: dirty pages written ahead of eviction'),
+	Stat('cache_evict_app', 'cache: pages evicted by application threads'),
+	Stat('cache_evict_app_wait', 'cache: application threads waiting for eviction'),
 	Stat('cache_evict_hazard', 'cache: pages selected for eviction not evicted because of a hazard reference'),
 	Stat('cache_evict_internal', 'cache: internal pages evicted'),
 	Stat('cache_evict_modified', 'cache: modified pages evicted'),
+	Stat('cache_evict_readers', 'cache: pages not written because running transactions need their updates'),
 	Stat('cache_evict_slow', 'cache: eviction server unable to reach eviction goal'),
 	Stat('cache_evict_unmodified', 'cache: unmodified pages evicted'),
 	Stat('cache_pages_inuse', 'cache: pages currently held in the cache', 'perm'),
+	Stat('cache_stall_ge100ms', 'cache: application waits for a page: 100ms or more'),
+	Stat('cache_stall_lt100ms', 'cache: application waits for a page: 10ms to 100ms'),
+	Stat('cache_stall_lt10ms', 'cache: application waits for a page: 1ms to 10ms'),
+	Stat('cache_stall_lt1ms', 'cache: application waits for a page: less than 1ms'),
+	Stat('cache_warm_read', 'cache: saved pages read back into the cache'),
+	Stat('cache_warm_saved', 'cache: pages saved as the connection closed'),
+	Stat('checkpoint', 'checkpoints'),
+	Stat('checkpoint_bytes', 'checkpoint: bytes written'),
+	Stat('checkpoint_skipped',
+	    'checkpoint: skipped because of the timeout or log_size'),
+	Stat('checkpoint_stall_max', 'checkpoint: longest application wait for a page (usecs)', 'perm'),
+	Stat('checkpoint_time', 'checkpoint: time spent in checkpoints (usecs)'),
 	Stat('cond_wait', 'condition wait calls'),
+	Stat('config_cache_hit',
+	    'configuration cache: strings found in the cache'),
+	Stat('config_cache_miss',
+	    'configuration cache: strings parsed'),
+	Stat('cursor_cache_hit', 'cursor cache: cursors reused from the cache'),
+	Stat('cursor_cache_miss', 'cursor cache: cursors not found in the cache'),
 	Stat('file_open', 'files currently open'),
+	Stat('log_background_syncs', 'log: syncs by the log flush thread'),
+	Stat('log_archived', 'log: files removed by archival'),
+	Stat('log_bytes', 'log: bytes written'),
+	Stat('log_compressed', 'log: records compressed'),
+	Stat('log_ops', 'log: file operations logged'),
+	Stat('log_prealloc', 'log: files pre-allocated'),
+	Stat('log_prealloc_missed',
+	    'log: files created because no pre-allocated file was ready'),
+	Stat('log_records', 'log: records written'),
+	Stat('log_recycled', 'log: files recycled by archival'),
+	Stat('log_sync_records', 'log: records synced'),
+	Stat('log_sync_wait_time',
+	    'log: time spent waiting for records to be synced (usecs)'),
+	Stat('log_sync_waits', 'log: records waiting to be synced'),
+	Stat('log_syncs', 'log: syncs'),
+	Stat('log_writes', 'log: writes'),
 	Stat('memalloc', 'total memory allocations'),
 	Stat('memfree', 'total memory frees'),
+	Stat('recovery_applied', 'recovery: records replayed'),
+	Stat('recovery_rate', 'recovery: records replayed per second', 'perm'),
+	Stat('recovery_scanned', 'recovery: log records read'),
+	Stat('recovery_time', 'recovery: time spent replaying the log (usecs)'),
+	Stat('read_ahead_hit',
+	    'read-ahead: pages read ahead found by a cursor scan'),
+	Stat('read_ahead_miss',
+	    'read-ahead: pages found by a cursor scan not read ahead'),
+	Stat('read_ahead_queued', 'read-ahead: pages queued'),
 	Stat('rwlock_rdlock', 'rwlock readlock calls'),
 	Stat('rwlock_wrlock', 'rwlock writelock calls'),
 	Stat('total_read_io', 'total read I/Os'),
 	Stat('total_write_io', 'total write I/Os'),
+	Stat('txn_begin', 'transactions: begins'),
+	Stat('txn_commit', 'transactions: committed'),
+	Stat('txn_conflict', 'transactions: update conflicts'),
+	Stat('txn_rollback', 'transactions: rolled back'),
+	Stat('txn_sync', 'transactions: waits for a commit to be synced'),
+	Stat('write_queue_full',
+	    'write queue: blocks written directly because the queue was full'),
+	Stat('write_queue_read', 'write queue: blocks read from the queue'),
+	Stat('write_queued', 'write queue: blocks queued'),
 ]
 
 ##########################################
@@ -54,6 +117,7 @@ btree_stats = [
 	Stat('extend', 'file: block allocations required file extension'),
 	Stat('file_allocsize', 'page size allocation unit'),
 	Stat('file_bulk_loaded', 'bulk-loaded entries'),
+	Stat('file_cache_bytes', 'file: bytes currently held in the cache'),
 	Stat('file_col_deleted', 'column-store deleted values'),
 	Stat('file_col_fix_pages', 'column-store fixed-size leaf pages'),
 	Stat('file_col_int_pages', 'column-store internal pages'),
@@ -86,3 +150,13 @@ btree_stats = [
 	Stat('rec_split_leaf', 'reconcile: leaf pages split'),
 	Stat('rec_written', 'reconcile: pages written'),
 ]
+
+##########################################
+# Eviction worker statistics
+##########################################
+evict_worker_stats = [
+	Stat('evict_worker_fail', 'eviction worker: pages selected but not evicted'),
+	Stat('evict_worker_pages', 'eviction worker: pages evicted'),
+	Stat('evict_worker_time', 'eviction worker: time spent evicting (usecs)'),
+	Stat('evict_worker_wakeup', 'eviction worker: wakeups'),
+]
@@ -362,6 +362,14 @@ session_ops(WT_SESSION *session)
 	ret = session->rollback_transaction(session, NULL);
 	/*! [session rollback transaction] */
 
+	/*! [session transaction sync] */
+	ret = session->begin_transaction(session, "sync=background");
+	/* Update the tables, then commit without waiting for the disk. */
+	ret = session->commit_transaction(session, NULL);
+	/* Wait for the commit to be synced. */
+	ret = session->transaction_sync(session, NULL);
+	/*! [session transaction sync] */
+
 	/*! [session close] */
 	ret = session->close(session, NULL);
 	/*! [session close] */
@@ -573,6 +581,10 @@ connection_ops(WT_CONNECTION *conn)
 	add_collator(conn);
 	add_extractor(conn);
 
+	/*! [Reconfigure a connection] */
+	ret = conn->reconfigure(conn, "cache_size=2GB,eviction_target=70");
+	/*! [Reconfigure a connection] */
+
 	/*! [conn close] */
 	ret = conn->close(conn, NULL);
 	/*! [conn close] */
@@ -593,6 +605,17 @@ connection_ops(WT_CONNECTION *conn)
 	ret = conn->open_session(conn, NULL, NULL, &session);
 	/*! [Open a session] */
 
+	{
+	/*! [Compile a configuration string] */
+	WT_CURSOR *cursor;
+	const char *overwrite;
+	ret = conn->compile_configuration(
+	    conn, "session.open_cursor", "overwrite", &overwrite);
+	ret = session->open_cursor(
+	    session, "table:mytable", NULL, overwrite, &cursor);
+	/*! [Compile a configuration string] */
+	}
+
 	session_ops(session);
 	}
 
@@ -308,6 +308,7 @@ SELFHELPER(struct __wt_cursor)
 %ignore __wt_buf;
 %ignore __wt_collator;
 %ignore __wt_connection::add_collator;
+%ignore __wt_connection::compile_configuration;
 %ignore __wt_compressor;
 %ignore __wt_connection::add_compressor;
 %ignore __wt_cursor_type;
@@ -0,0 +1,74 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_block_checkpoint_start --
+ *	Start a file checkpoint.
+ */
+int
+__wt_block_checkpoint_start(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	int ret;
+
+	ret = 0;
+
+	/*
+	 * The free-list in the file describes the file as of the last clean
+	 * close: once a checkpoint's root is durable, blocks it lists can be
+	 * in use.  Clear the file's free-list reference before writing any
+	 * pages, a crash leaks the free space rather than corrupting the file.
+	 * The free-list is written again when the file is closed.
+	 */
+	if (block->free_offset != WT_BLOCK_INVALID_OFFSET) {
+		block->free_offset = WT_BLOCK_INVALID_OFFSET;
+		block->free_size = block->free_cksum = 0;
+		WT_RET(__wt_desc_update(session, block));
+		WT_RET(__wt_fsync(session, block->fh));
+	}
+
+	/*
+	 * Blocks freed before the checkpoint started are released when the
+	 * checkpoint completes.  Blocks allocated before the checkpoint, or
+	 * while it's running, may be part of it: forget the allocations and
+	 * stop tracking them until the checkpoint is resolved.
+	 */
+	__wt_spin_lock(session, &block->freelist_lock);
+	ret = __wt_block_extlist_merge(
+	    session, &block->discard, &block->ckpt_discard);
+	__wt_block_extlist_free(session, &block->alloc);
+	block->ckpt_bytes = 0;
+	block->ckpt_inprogress = 1;
+	__wt_spin_unlock(session, &block->freelist_lock);
+
+	return (ret);
+}
+
+/*
+ * __wt_block_checkpoint_resolve --
+ *	Resolve a file checkpoint: if it failed, the blocks it would have
+ * released are held until the next one.
+ */
+int
+__wt_block_checkpoint_resolve(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, int failed)
+{
+	int ret;
+
+	if (!block->ckpt_inprogress)
+		return (0);
+
+	__wt_spin_lock(session, &block->freelist_lock);
+	ret = __wt_block_extlist_merge(session, &block->ckpt_discard,
+	    failed ? &block->discard : &block->free);
+	block->ckpt_inprogress = 0;
+	__wt_spin_unlock(session, &block->freelist_lock);
+
+	WT_CSTAT_INCRV(session, checkpoint_bytes, block->ckpt_bytes);
+	return (ret);
+}
@@ -232,6 +232,39 @@ __block_off_remove(
 	return (0);
 }
 
+/*
+ * __block_off_remove_range --
+ *	Remove a range from an extent list, returning WT_NOTFOUND if the range
+ * isn't entirely contained in a single extent.
+ */
+static int
+__block_off_remove_range(
+    WT_SESSION_IMPL *session, WT_EXTLIST *el, off_t off, off_t size)
+{
+	WT_EXT *after, *before, *ext;
+	off_t a_off, a_size, b_off, b_size;
+
+	/* Find the extent starting at or before the range. */
+	__block_off_pair_srch(el, off + 1, &before, &after);
+	if (before == NULL ||
+	    before->off > off || before->off + before->size < off + size)
+		return (WT_NOTFOUND);
+
+	/* Remove the extent, then put back any parts outside of the range. */
+	WT_RET(__block_off_remove(session, el, before->off, &ext));
+	b_off = ext->off;
+	b_size = off - ext->off;
+	a_off = off + size;
+	a_size = (ext->off + ext->size) - a_off;
+	__wt_free(session, ext);
+
+	if (b_size != 0)
+		WT_RET(__block_merge(session, el, b_off, b_size));
+	if (a_size != 0)
+		WT_RET(__block_merge(session, el, a_off, a_size));
+	return (0);
+}
+
 /*
  * __wt_block_alloc --
  *	Alloc a chunk of space from the underlying file.
@@ -293,8 +326,14 @@ __wt_block_alloc(
 		__wt_free(session, ext);
 	}
 
-done: err:
-	__wt_spin_unlock(session, &block->freelist_lock);
+done:	/*
+	 * Track blocks allocated since the last checkpoint: no checkpoint can
+	 * reference them, they can be reused as soon as they're freed.
+	 */
+	if (!block->ckpt_inprogress)
+		WT_ERR(__block_merge(session, &block->alloc, *offp, size));
+
+err:	__wt_spin_unlock(session, &block->freelist_lock);
 	return (ret);
 }
 
@@ -380,8 +419,24 @@ __wt_block_free(
 	WT_VERBOSE(session, block,
 	    "free %" PRIdMAX "/%" PRIdMAX, (intmax_t)off, (intmax_t)size);
 
+	/* The block can't be re-allocated while its write is queued. */
+	__wt_block_queue_wait(session, block, off);
+
 	__wt_spin_lock(session, &block->freelist_lock);
-	ret = __block_merge(session, &block->free, off, (off_t)size);
+
+	/*
+	 * Blocks allocated since the last checkpoint go back on the free-list.
+	 * Any other block may be referenced by the last checkpoint (or by the
+	 * checkpoint being written), and is held until a newer checkpoint is
+	 * durable.
+	 */
+	ret = block->ckpt_inprogress ? WT_NOTFOUND :
+	    __block_off_remove_range(session, &block->alloc, off, size);
+	if (ret == 0)
+		ret = __block_merge(session, &block->free, off, size);
+	else if (ret == WT_NOTFOUND)
+		ret = __block_merge(session, &block->discard, off, size);
+
 	__wt_spin_unlock(session, &block->freelist_lock);
 
 	return (ret);
@@ -557,18 +612,45 @@ __wt_block_freelist_open(WT_SESSION_IMPL *session, WT_BLOCK *block)
 
 	block->free_offset = WT_BLOCK_INVALID_OFFSET;
 	block->free_size = block->free_cksum = 0;
+
+	memset(&block->alloc, 0, sizeof(block->alloc));
+	block->alloc.name = "alloc";
+	memset(&block->discard, 0, sizeof(block->discard));
+	block->discard.name = "discard";
+	memset(&block->ckpt_discard, 0, sizeof(block->ckpt_discard));
+	block->ckpt_discard.name = "checkpoint discard";
 }
 
 /*
  * __wt_block_freelist_close --
- *	Write the free-list at the tail of the file.
+ *	Discard the free-list structures.
  */
 void
 __wt_block_freelist_close(WT_SESSION_IMPL *session, WT_BLOCK *block)
 {
+	__wt_block_extlist_free(session, &block->free);
+	__wt_block_extlist_free(session, &block->alloc);
+	__wt_block_extlist_free(session, &block->discard);
+	__wt_block_extlist_free(session, &block->ckpt_discard);
+
 	__wt_spin_destroy(session, &block->freelist_lock);
 }
 
+/*
+ * __wt_block_extlist_merge --
+ *	Merge one extent list into another, emptying the first list.
+ */
+int
+__wt_block_extlist_merge(WT_SESSION_IMPL *session, WT_EXTLIST *a, WT_EXTLIST *b)
+{
+	WT_EXT *ext;
+
+	WT_EXT_FOREACH(ext, a->off)
+		WT_RET(__block_merge(session, b, ext->off, ext->size));
+	__wt_block_extlist_free(session, a);
+	return (0);
+}
+
 /*
  * __wt_block_extlist_write --
  *	Write an extent list at the tail of the file.
@@ -695,24 +777,37 @@ __block_truncate(WT_SESSION_IMPL *session, WT_BLOCK *block)
 
 /*
  * __wt_block_discard --
- *	Discard any extent-list entries.
+ *	Discard any free-list entries.
  */
 void
 __wt_block_discard(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	__wt_block_extlist_free(session, &block->free);
+}
+
+/*
+ * __wt_block_extlist_free --
+ *	Discard an extent list's entries.
+ */
+void
+__wt_block_extlist_free(WT_SESSION_IMPL *session, WT_EXTLIST *el)
 {
 	WT_EXT *ext, *next;
 	WT_SIZE *szp, *nszp;
+	const char *name;
 
-	for (ext = block->free.off[0]; ext != NULL; ext = next) {
+	for (ext = el->off[0]; ext != NULL; ext = next) {
 		next = ext->next[0];
 		__wt_free(session, ext);
 	}
-	for (szp = block->free.size[0]; szp != NULL; szp = nszp) {
+	for (szp = el->size[0]; szp != NULL; szp = nszp) {
 		nszp = szp->next[0];
 		__wt_free(session, szp);
 	}
 
-	memset(&block->free, 0, sizeof(block->free));
+	name = el->name;
+	memset(el, 0, sizeof(*el));
+	el->name = name;
 }
 
 /*
@@ -71,6 +71,24 @@ __wt_bm_addr_string(WT_SESSION_IMPL *session,
 	    __wt_block_addr_string(session, block, buf, addr, addr_size));
 }
 
+/*
+ * __wt_bm_addr_offset --
+ *	Return the file offset of an address cookie.
+ */
+int
+__wt_bm_addr_offset(WT_SESSION_IMPL *session,
+    const uint8_t *addr, uint32_t addr_size, off_t *offsetp)
+{
+	WT_BLOCK *block;
+
+	WT_UNUSED(addr_size);
+
+	if ((block = session->btree->block) == NULL)
+		return (__bm_invalid(session));
+
+	return (__wt_block_buffer_to_addr(block, addr, offsetp, NULL, NULL));
+}
+
 /*
  * __wt_bm_create --
  *	Create a new file.
@@ -210,6 +228,67 @@ __wt_bm_write(
 	return (__wt_block_write_buf(session, block, buf, addr, addr_size));
 }
 
+/*
+ * __wt_bm_sync --
+ *	Flush a file to disk.
+ */
+int
+__wt_bm_sync(WT_SESSION_IMPL *session)
+{
+	WT_BLOCK *block;
+
+	if ((block = session->btree->block) == NULL)
+		return (__bm_invalid(session));
+
+	WT_RET(__wt_block_queue_drain(session, block));
+	return (__wt_fsync(session, block->fh));
+}
+
+/*
+ * __wt_bm_flush --
+ *	Wait for a file's queued writes.
+ */
+int
+__wt_bm_flush(WT_SESSION_IMPL *session)
+{
+	WT_BLOCK *block;
+
+	if ((block = session->btree->block) == NULL)
+		return (__bm_invalid(session));
+
+	return (__wt_block_queue_drain(session, block));
+}
+
+/*
+ * __wt_bm_checkpoint_start --
+ *	Start a file checkpoint.
+ */
+int
+__wt_bm_checkpoint_start(WT_SESSION_IMPL *session)
+{
+	WT_BLOCK *block;
+
+	if ((block = session->btree->block) == NULL)
+		return (__bm_invalid(session));
+
+	return (__wt_block_checkpoint_start(session, block));
+}
+
+/*
+ * __wt_bm_checkpoint_resolve --
+ *	Resolve a file checkpoint.
+ */
+int
+__wt_bm_checkpoint_resolve(WT_SESSION_IMPL *session, int failed)
+{
+	WT_BLOCK *block;
+
+	if ((block = session->btree->block) == NULL)
+		return (__bm_invalid(session));
+
+	return (__wt_block_checkpoint_resolve(session, block, failed));
+}
+
 /*
  * __wt_bm_stat --
  *	Block-manager statistics.
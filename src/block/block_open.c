@@ -8,7 +8,6 @@
 #include "wt_internal.h"
 
 static int __desc_read(WT_SESSION_IMPL *, WT_BLOCK *, int);
-static int __desc_update(WT_SESSION_IMPL *, WT_BLOCK *);
 
 /*
  * __wt_block_truncate --
@@ -158,13 +157,24 @@ __wt_block_close(WT_SESSION_IMPL *session, WT_BLOCK *block)
 
 	/*
 	 * If the file was active, write out the free-list and update the
-	 * file's description.
+	 * file's description.  The description references the free-list,
+	 * wait for the queued writes first.
 	 */
 	if (F_ISSET(block, WT_BLOCK_OK)) {
+		/*
+		 * Blocks held for checkpoints are free once the file is closed:
+		 * the root written at close replaces any checkpoint.
+		 */
+		WT_TRET(__wt_block_extlist_merge(
+		    session, &block->discard, &block->free));
+		WT_TRET(__wt_block_extlist_merge(
+		    session, &block->ckpt_discard, &block->free));
+
 		WT_TRET(__wt_block_extlist_write(session, block,
 		    &block->free, &block->free_offset,
 		    &block->free_size, &block->free_cksum));
-		WT_TRET(__desc_update(session, block));
+		WT_TRET(__wt_block_queue_drain(session, block));
+		WT_TRET(__wt_desc_update(session, block));
 	}
 
 	if (block->name != NULL)
@@ -295,11 +305,11 @@ __wt_desc_init(WT_SESSION_IMPL *session, WT_FH *fh)
 }
 
 /*
- * __desc_update --
+ * __wt_desc_update --
  *	Update the file's descriptor structure.
  */
-static int
-__desc_update(WT_SESSION_IMPL *session, WT_BLOCK *block)
+int
+__wt_desc_update(WT_SESSION_IMPL *session, WT_BLOCK *block)
 {
 	WT_BLOCK_DESC *desc;
 	WT_ITEM *buf;
@@ -316,7 +326,7 @@ __desc_update(WT_SESSION_IMPL *session, WT_BLOCK *block)
 	if (desc->free_offset == (uint64_t)block->free_offset &&
 	    desc->free_size == block->free_size &&
 	    desc->write_gen == block->write_gen)
-		return (0);
+		goto err;
 
 	WT_VERBOSE(session, block,
 	    "resetting free list [offset %" PRIuMAX ", size %" PRIu32 "]",
@@ -0,0 +1,406 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Each write thread has this many writes queued for it before block writes
+ * are done by the thread writing the block.
+ */
+#define	WT_WRITE_QUEUE_DEPTH	16
+
+static void	     __write_done_wait(WT_SESSION_IMPL *, WT_WRITE_QUEUE *,
+		    uint64_t);
+static WT_WRITE_REQ *__write_next(WT_SESSION_IMPL *, WT_WRITE_QUEUE *);
+static void	     __write_req(WT_SESSION_IMPL *, WT_WRITE_QUEUE *,
+		    WT_WRITE_REQ *);
+
+/*
+ * __wt_write_queue_create --
+ *	Create the block write queue, if write threads are configured.  The
+ * threads are started when the connection is opened.
+ */
+int
+__wt_write_queue_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_SESSION_IMPL *session;
+	WT_WRITE_QUEUE *wq;
+	u_int i;
+	int ret;
+
+	session = &conn->default_session;
+	ret = 0;
+
+	WT_RET(__wt_config_gets(session, cfg, "write_threads", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, 1, &wq));
+	conn->write_queue = wq;
+
+	__wt_spin_init(session, &wq->lock);
+	TAILQ_INIT(&wq->qh);
+	for (i = 0; i < WT_WRITE_QUEUE_BUCKETS; ++i) {
+		__wt_spin_init(session, &wq->hash[i].lock);
+		TAILQ_INIT(&wq->hash[i].qh);
+	}
+	wq->nthreads = (u_int)cval.val;
+	wq->max = wq->nthreads * WT_WRITE_QUEUE_DEPTH;
+	WT_ERR(__wt_cond_alloc(session, "block write", 1, &wq->cond));
+	WT_ERR(__wt_cond_alloc(
+	    session, "block write done", 1, &wq->done_cond));
+	WT_ERR(__wt_calloc_def(session, wq->nthreads, &wq->tids));
+	return (0);
+
+err:	__wt_write_queue_destroy(conn);
+	return (ret);
+}
+
+/*
+ * __wt_write_queue_destroy --
+ *	Discard the block write queue.  The write threads have exited, and
+ * closing the files waited for their queued writes.
+ */
+void
+__wt_write_queue_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_SESSION_IMPL *session;
+	WT_WRITE_QUEUE *wq;
+	u_int i;
+
+	session = &conn->default_session;
+	if ((wq = conn->write_queue) == NULL)
+		return;
+
+	WT_ASSERT(session, TAILQ_EMPTY(&wq->qh));
+	if (wq->cond != NULL)
+		(void)__wt_cond_destroy(session, wq->cond);
+	if (wq->done_cond != NULL)
+		(void)__wt_cond_destroy(session, wq->done_cond);
+	for (i = 0; i < WT_WRITE_QUEUE_BUCKETS; ++i)
+		__wt_spin_destroy(session, &wq->hash[i].lock);
+	__wt_spin_destroy(session, &wq->lock);
+	__wt_free(session, wq->tids);
+	__wt_free(session, conn->write_queue);
+}
+
+/*
+ * __wt_block_queue_write --
+ *	Queue a block write.  If there are no write threads, or the queue is
+ * full, write the block in this thread.
+ *
+ * If the session is writing a page that stays in memory, the page is tagged
+ * with the write: it's not clean until the write completes.
+ */
+int
+__wt_block_queue_write(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, off_t offset, uint32_t size, const void *mem)
+{
+	WT_WRITE_BUCKET *bucket;
+	WT_WRITE_QUEUE *wq;
+	WT_WRITE_REQ *req;
+	int ret;
+
+	if ((wq = S2C(session)->write_queue) == NULL)
+		return (__wt_write(session, block->fh, offset, size, mem));
+	if (wq->entries >= wq->max) {
+		WT_CSTAT_INCR(session, write_queue_full);
+		return (__wt_write(session, block->fh, offset, size, mem));
+	}
+
+	/*
+	 * Copy the block image: the caller's buffer is re-used as soon as we
+	 * return.
+	 */
+	WT_RET(__wt_calloc_def(session, 1, &req));
+	F_SET(&req->buf, WT_ITEM_ALIGNED);
+	if ((ret = __wt_buf_set(session, &req->buf, mem, size)) != 0) {
+		__wt_free(session, req);
+		return (ret);
+	}
+	req->block = block;
+	req->offset = offset;
+	req->size = size;
+	bucket = &wq->hash[WT_WRITE_QUEUE_HASH(block, offset)];
+
+	__wt_spin_lock(session, &wq->lock);
+	TAILQ_INSERT_TAIL(&wq->qh, req, q);
+	__wt_spin_lock(session, &bucket->lock);
+	TAILQ_INSERT_HEAD(&bucket->qh, req, hq);
+	__wt_spin_unlock(session, &bucket->lock);
+	++wq->entries;
+	++block->write_pending;
+	if ((req->page = session->write_page) != NULL)
+		++req->page->modify->write_pending;
+	__wt_spin_unlock(session, &wq->lock);
+
+	__wt_cond_signal(session, wq->cond);
+	WT_CSTAT_INCR(session, write_queued);
+	return (0);
+}
+
+/*
+ * __wt_block_queue_read --
+ *	Copy a block that's queued for writing into a buffer.
+ */
+int
+__wt_block_queue_read(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    off_t offset, uint32_t size, void *mem, int *foundp)
+{
+	WT_WRITE_BUCKET *bucket;
+	WT_WRITE_QUEUE *wq;
+	WT_WRITE_REQ *req;
+
+	*foundp = 0;
+
+	/* Most blocks are read long after they're written. */
+	if (block->write_pending == 0)
+		return (0);
+
+	wq = S2C(session)->write_queue;
+	bucket = &wq->hash[WT_WRITE_QUEUE_HASH(block, offset)];
+	__wt_spin_lock(session, &bucket->lock);
+	TAILQ_FOREACH(req, &bucket->qh, hq)
+		if (req->block == block && req->offset == offset) {
+			if (req->size == size) {
+				memcpy(mem, req->buf.mem, size);
+				*foundp = 1;
+			}
+			break;
+		}
+	__wt_spin_unlock(session, &bucket->lock);
+
+	if (*foundp)
+		WT_CSTAT_INCR(session, write_queue_read);
+	return (0);
+}
+
+/*
+ * __wt_block_queue_wait --
+ *	Wait for any queued write of a block: a freed block can't be re-used
+ * until it has been written, or the writes could be re-ordered.
+ */
+void
+__wt_block_queue_wait(WT_SESSION_IMPL *session, WT_BLOCK *block, off_t offset)
+{
+	WT_WRITE_BUCKET *bucket;
+	WT_WRITE_QUEUE *wq;
+	WT_WRITE_REQ *req;
+	uint64_t gen;
+
+	if (block->write_pending == 0)
+		return;
+
+	wq = S2C(session)->write_queue;
+	bucket = &wq->hash[WT_WRITE_QUEUE_HASH(block, offset)];
+	for (;;) {
+		WT_ORDERED_READ(gen, wq->done_gen);
+		__wt_spin_lock(session, &bucket->lock);
+		TAILQ_FOREACH(req, &bucket->qh, hq)
+			if (req->block == block && req->offset == offset)
+				break;
+		__wt_spin_unlock(session, &bucket->lock);
+		if (req == NULL)
+			break;
+		__write_done_wait(session, wq, gen);
+	}
+}
+
+/*
+ * __wt_block_queue_drain --
+ *	Wait for a file's queued writes, returning any error writing them.
+ */
+int
+__wt_block_queue_drain(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_WRITE_QUEUE *wq;
+	uint64_t gen;
+	int ret;
+
+	if ((wq = S2C(session)->write_queue) == NULL)
+		return (0);
+
+	for (;;) {
+		WT_ORDERED_READ(gen, wq->done_gen);
+		if (block->write_pending == 0)
+			break;
+		__write_done_wait(session, wq, gen);
+	}
+
+	__wt_spin_lock(session, &wq->lock);
+	ret = block->write_error;
+	block->write_error = 0;
+	__wt_spin_unlock(session, &wq->lock);
+	return (ret);
+}
+
+/*
+ * __wt_block_queue_page_out --
+ *	Detach a discarded page from its queued writes.  The writes complete
+ * from their own copies of the blocks, but can't re-dirty the page.
+ */
+void
+__wt_block_queue_page_out(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_WRITE_QUEUE *wq;
+	WT_WRITE_REQ *req;
+
+	if ((wq = S2C(session)->write_queue) == NULL ||
+	    page->modify == NULL || page->modify->write_pending == 0)
+		return;
+
+	__wt_spin_lock(session, &wq->lock);
+	TAILQ_FOREACH(req, &wq->qh, q)
+		if (req->page == page)
+			req->page = NULL;
+	page->modify->write_pending = 0;
+	__wt_spin_unlock(session, &wq->lock);
+}
+
+/*
+ * __write_done_wait --
+ *	Wait for a queued write to finish, given the generation read before the
+ * caller checked its condition.
+ */
+static void
+__write_done_wait(WT_SESSION_IMPL *session, WT_WRITE_QUEUE *wq, uint64_t gen)
+{
+	(void)WT_ATOMIC_ADD(wq->done_waiters, 1);
+	if (wq->done_gen == gen)
+		__wt_cond_wait_timed(session, wq->done_cond, 10000);
+	(void)WT_ATOMIC_ADD(wq->done_waiters, -1);
+
+	/*
+	 * Threads wake one at a time and wait for different writes: if a
+	 * write finished, pass the wakeup on.
+	 */
+	if (wq->done_waiters != 0 && wq->done_gen != gen)
+		__wt_cond_signal(session, wq->done_cond);
+}
+
+/*
+ * __wt_write_server --
+ *	Thread writing queued blocks.
+ */
+void *
+__wt_write_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *session;
+	WT_WRITE_QUEUE *wq;
+	WT_WRITE_REQ *req;
+	int ret;
+
+	conn = arg;
+	wq = conn->write_queue;
+	ret = 0;
+
+	/*
+	 * We need a session handle because we're writing files.  Start with
+	 * the default session to keep error handling simple.
+	 */
+	session = &conn->default_session;
+	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &session));
+
+	while (F_ISSET(conn, WT_SERVER_RUN)) {
+		__wt_cond_wait_timed(session, wq->cond, 100000);
+		while ((req = __write_next(session, wq)) != NULL)
+			__write_req(session, wq, req);
+	}
+
+	if (0) {
+err:		__wt_err(session, ret, "block write server error");
+	}
+	if (session != &conn->default_session)
+		(void)session->iface.close(&session->iface, NULL);
+	return (NULL);
+}
+
+/*
+ * __write_next --
+ *	Claim the oldest queued write no other thread is writing.
+ */
+static WT_WRITE_REQ *
+__write_next(WT_SESSION_IMPL *session, WT_WRITE_QUEUE *wq)
+{
+	WT_WRITE_REQ *req;
+	int more;
+
+	more = 0;
+	__wt_spin_lock(session, &wq->lock);
+	TAILQ_FOREACH(req, &wq->qh, q)
+		if (!req->busy) {
+			req->busy = 1;
+			more = TAILQ_NEXT(req, q) != NULL;
+			break;
+		}
+	__wt_spin_unlock(session, &wq->lock);
+
+	/* If there's more work, wake another thread to share it. */
+	if (more)
+		__wt_cond_signal(session, wq->cond);
+	return (req);
+}
+
+/*
+ * __write_req --
+ *	Write a queued block and discard the request.
+ */
+static void
+__write_req(WT_SESSION_IMPL *session, WT_WRITE_QUEUE *wq, WT_WRITE_REQ *req)
+{
+	WT_BLOCK *block;
+	WT_PAGE *page;
+	WT_WRITE_BUCKET *bucket;
+	int ret;
+
+	block = req->block;
+	ret = __wt_write(session,
+	    block->fh, req->offset, req->size, req->buf.mem);
+	bucket = &wq->hash[WT_WRITE_QUEUE_HASH(block, req->offset)];
+
+	__wt_spin_lock(session, &wq->lock);
+	TAILQ_REMOVE(&wq->qh, req, q);
+	__wt_spin_lock(session, &bucket->lock);
+	TAILQ_REMOVE(&bucket->qh, req, hq);
+	__wt_spin_unlock(session, &bucket->lock);
+	--wq->entries;
+	--block->write_pending;
+
+	/*
+	 * The error is returned when the file is next synced or closed: the
+	 * block's address may already be in a parent page, the checkpoint
+	 * or close writing that page must fail.
+	 */
+	if (ret != 0 && block->write_error == 0)
+		block->write_error = ret;
+
+	/*
+	 * The page is clean once its last queued write completes; if a write
+	 * failed, it's dirty again and will be re-written.  Discarding the
+	 * page detaches it from its writes, under this lock.
+	 */
+	if ((page = req->page) != NULL) {
+		--page->modify->write_pending;
+		if (ret != 0)
+			__wt_page_modify_set(session, page);
+	}
+	__wt_spin_unlock(session, &wq->lock);
+
+	/*
+	 * The atomic add is a full barrier: a thread that read the previous
+	 * generation and is going to sleep has counted itself as a waiter by
+	 * the time we check, or sees the new generation and doesn't sleep.
+	 */
+	(void)WT_ATOMIC_ADD(wq->done_gen, 1);
+	if (wq->done_waiters != 0)
+		__wt_cond_signal(session, wq->done_cond);
+
+	__wt_buf_free(session, &req->buf);
+	__wt_free(session, req);
+}
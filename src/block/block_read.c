@@ -55,7 +55,7 @@ __wt_block_read(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	WT_PAGE_HEADER *dsk;
 	size_t result_len;
 	uint32_t page_cksum;
-	int ret;
+	int found, ret;
 
 	tmp = NULL;
 	ret = 0;
@@ -81,8 +81,11 @@ __wt_block_read(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		dsk = tmp->mem;
 	}
 
-	/* Read. */
-	WT_ERR(__wt_read(session, block->fh, offset, size, dsk));
+	/* Read, from the write queue if the block hasn't been written yet. */
+	WT_ERR(
+	    __wt_block_queue_read(session, block, offset, size, dsk, &found));
+	if (!found)
+		WT_ERR(__wt_read(session, block->fh, offset, size, dsk));
 	blk = WT_BLOCK_HEADER_REF(dsk);
 
 	/* Validate the checksum. */
@@ -118,22 +118,33 @@ static int
 __verify_freelist(WT_SESSION_IMPL *session, WT_BLOCK *block)
 {
 	WT_EXT *ext;
+	WT_EXTLIST *el, *lists[3];
+	u_int i;
 	int ret;
 
 	ret = 0;
 
-	WT_EXT_FOREACH(ext, block->free.off) {
-		if (ext->off + (off_t)ext->size > block->fh->file_size)
-			WT_RET_MSG(session, WT_ERROR,
-			    "free-list entry offset %" PRIuMAX "references "
-			    "non-existent file pages",
-			    (uintmax_t)ext->off);
-
-		WT_VERBOSE(session, verify,
-		    "free-list range %" PRIdMAX "-%" PRIdMAX,
-		    (intmax_t)ext->off, (intmax_t)(ext->off + ext->size));
-
-		WT_TRET(__verify_addfrag(session, block, ext->off, ext->size));
+	/* Blocks held for checkpoints are free space as well. */
+	lists[0] = &block->free;
+	lists[1] = &block->discard;
+	lists[2] = &block->ckpt_discard;
+	for (i = 0; i < 3; ++i) {
+		el = lists[i];
+		WT_EXT_FOREACH(ext, el->off) {
+			if (ext->off + (off_t)ext->size > block->fh->file_size)
+				WT_RET_MSG(session, WT_ERROR,
+				    "%s entry offset %" PRIuMAX " references "
+				    "non-existent file pages",
+				    el->name, (uintmax_t)ext->off);
+
+			WT_VERBOSE(session, verify,
+			    "%s range %" PRIdMAX "-%" PRIdMAX, el->name,
+			    (intmax_t)ext->off,
+			    (intmax_t)(ext->off + ext->size));
+
+			WT_TRET(__verify_addfrag(
+			    session, block, ext->off, ext->size));
+		}
 	}
 
 	return (ret);
@@ -226,12 +226,17 @@ not_compressed:	/*
 	} else
 		blk->cksum = WT_BLOCK_CHECKSUM_NOT_SET;
 
-	/* Allocate space from the underlying file and write the block. */
+	/*
+	 * Allocate space from the underlying file and write the block, or
+	 * queue it for a write thread.
+	 */
 	WT_ERR(__wt_block_alloc(session, block, &offset, (off_t)align_size));
-	WT_ERR(__wt_write(session, block->fh, offset, align_size, dsk));
+	WT_ERR(__wt_block_queue_write(session, block, offset, align_size, dsk));
 
 	WT_BSTAT_INCR(session, page_write);
 	WT_CSTAT_INCR(session, block_write);
+	if (block->ckpt_inprogress)
+		(void)WT_ATOMIC_ADD(block->ckpt_bytes, align_size);
 
 	WT_VERBOSE(session, write,
 	    "off %" PRIuMAX ", size %" PRIu32 ", cksum %" PRIu32,
@@ -0,0 +1,127 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_page_arena_alloc --
+ *	Allocate cleared memory for a WT_INSERT, WT_UPDATE or WT_IKEY structure
+ * from the page's arena.
+ */
+int
+__wt_page_arena_alloc(
+    WT_SESSION_IMPL *session, WT_PAGE *page, size_t size, void *retp)
+{
+	WT_PAGE_ARENA *arena, *new, *next;
+	size_t chunk;
+	uint32_t used;
+
+	size = WT_ALIGN(size, sizeof(void *));
+
+	for (;;) {
+		/* Allocate from the newest chunk if there's room. */
+		if ((arena = page->arena) != NULL) {
+			used = arena->used;
+			if (used + size <= arena->size) {
+				if (!WT_ATOMIC_CAS(arena->used,
+				    used, used + WT_STORE_SIZE(size)))
+					continue;
+				WT_CSTAT_INCR(session, arena_alloc);
+				*(void **)retp = WT_PAGE_ARENA_DATA(arena) + used;
+				return (0);
+			}
+		}
+
+		/*
+		 * Allocate a new chunk, doubling the chunk size each time so
+		 * pages with few modifications don't waste memory.  Large
+		 * objects get a chunk of their own, linked behind the newest
+		 * chunk, so the newest chunk's free space isn't lost.
+		 */
+		if (size > WT_PAGE_ARENA_MAX / 4)
+			chunk = size;
+		else if (arena == NULL)
+			chunk = WT_PAGE_ARENA_MIN;
+		else
+			chunk = WT_MIN(2 * (size_t)arena->size,
+			    WT_PAGE_ARENA_MAX);
+		WT_RET(__wt_calloc(
+		    session, 1, sizeof(WT_PAGE_ARENA) + chunk, &new));
+		new->size = WT_STORE_SIZE(chunk);
+		new->used = WT_STORE_SIZE(size);
+
+		if (chunk == size && arena != NULL)
+			do {
+				next = arena->next;
+				new->next = next;
+			} while (!WT_ATOMIC_CAS(arena->next, next, new));
+		else {
+			/*
+			 * If another thread added a chunk first, discard ours
+			 * and allocate from theirs.
+			 */
+			new->next = arena;
+			if (!WT_ATOMIC_CAS(page->arena, arena, new)) {
+				__wt_free(session, new);
+				continue;
+			}
+		}
+
+		__wt_cache_page_inmem_incr(
+		    session, page, sizeof(WT_PAGE_ARENA) + chunk);
+		WT_CSTAT_INCR(session, arena_alloc);
+		WT_CSTAT_INCR(session, arena_chunk_alloc);
+		WT_CSTAT_INCRV(session, arena_chunk_bytes, chunk);
+		*(void **)retp = WT_PAGE_ARENA_DATA(new);
+		return (0);
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __wt_page_arena_free --
+ *	Return an unused allocation to the page's arena.
+ *
+ * Structures that weren't linked into the page (for example, because another
+ * thread updated the same entry first), are returned to the arena.  If it was
+ * the newest allocation from the newest chunk, the space is re-used, otherwise
+ * it's lost until the page is discarded.
+ */
+void
+__wt_page_arena_free(
+    WT_SESSION_IMPL *session, WT_PAGE *page, void *p, size_t size)
+{
+	WT_PAGE_ARENA *arena;
+	uint32_t used;
+
+	size = WT_ALIGN(size, sizeof(void *));
+
+	/* The memory is ours until the used count changes: clear it. */
+	memset(p, 0, size);
+	if ((arena = page->arena) != NULL &&
+	    (used = arena->used) >= size &&
+	    WT_PAGE_ARENA_DATA(arena) + (used - size) == (uint8_t *)p &&
+	    WT_ATOMIC_CAS(arena->used, used, used - WT_STORE_SIZE(size)))
+		return;
+	WT_CSTAT_INCRV(session, arena_wasted, size);
+}
+
+/*
+ * __wt_page_arena_discard --
+ *	Free a page's arena.
+ */
+void
+__wt_page_arena_discard(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_PAGE_ARENA *arena;
+
+	while ((arena = page->arena) != NULL) {
+		page->arena = arena->next;
+		__wt_free(session, arena);
+		WT_CSTAT_INCR(session, arena_chunk_free);
+	}
+}
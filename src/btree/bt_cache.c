@@ -16,7 +16,9 @@ __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 {
 	WT_CACHE *cache;
 	WT_CONFIG_ITEM cval;
+	WT_EVICT_WORKER *worker;
 	WT_SESSION_IMPL *session;
+	u_int i;
 	int ret;
 
 	session = &conn->default_session;
@@ -30,6 +32,17 @@ __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	cache->eviction_target = (u_int)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "eviction_trigger", &cval));
 	cache->eviction_trigger = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "eviction_dirty_target", &cval));
+	cache->eviction_dirty_target = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "eviction_dirty_trigger", &cval));
+	cache->eviction_dirty_trigger = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "eviction_policy", &cval));
+	if (strncmp(cval.str, "2q", cval.len) == 0)
+		cache->evict_policy = WT_EVICT_POLICY_2Q;
+	else if (strncmp(cval.str, "clockpro", cval.len) == 0)
+		cache->evict_policy = WT_EVICT_POLICY_CLOCKPRO;
+	else
+		cache->evict_policy = WT_EVICT_POLICY_LRU;
 
 	/*
 	 * The target size must be lower than the trigger size or we will never
@@ -38,11 +51,52 @@ __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	if (cache->eviction_target >= cache->eviction_trigger)
 		WT_ERR_MSG(session, EINVAL,
 		    "eviction target must be lower than the eviction trigger");
+	if (cache->eviction_dirty_target >= cache->eviction_dirty_trigger)
+		WT_ERR_MSG(session, EINVAL,
+		    "eviction dirty target must be lower than the eviction "
+		    "dirty trigger");
 
 	WT_ERR(__wt_cond_alloc(session,
 	    "cache eviction server", 1, &cache->evict_cond));
+	WT_ERR(__wt_cond_alloc(session,
+	    "cache eviction waiters", 1, &cache->evict_waiter_cond));
 	__wt_spin_init(session, &cache->lru_lock);
 
+	/*
+	 * Allocate the eviction worker array; the threads are started when the
+	 * connection is opened.
+	 */
+	WT_ERR(__wt_config_gets(session, cfg, "eviction_workers", &cval));
+	cache->eviction_workers = (u_int)cval.val;
+	if (cache->eviction_workers > 0) {
+		WT_ERR(__wt_calloc_def(
+		    session, cache->eviction_workers, &cache->workers));
+		for (i = 0, worker = cache->workers;
+		    i < cache->eviction_workers; ++i, ++worker) {
+			worker->conn = conn;
+			worker->id = i;
+			WT_ERR(__wt_cond_alloc(session,
+			    "cache eviction worker", 1, &worker->cond));
+			WT_ERR(__wt_stat_alloc_evict_worker_stats(
+			    session, 1, &worker->stats));
+		}
+		WT_ERR(__wt_cond_alloc(session, "cache eviction workers done",
+		    1, &cache->evict_worker_cond));
+	}
+
+	/*
+	 * Allocate the cleaner thread IDs; the threads are started when the
+	 * connection is opened.
+	 */
+	WT_ERR(__wt_config_gets(session, cfg, "eviction_cleaners", &cval));
+	cache->eviction_cleaners = (u_int)cval.val;
+	if (cache->eviction_cleaners > 0) {
+		WT_ERR(__wt_calloc_def(
+		    session, cache->eviction_cleaners, &cache->clean_tids));
+		WT_ERR(__wt_cond_alloc(
+		    session, "cache clean server", 1, &cache->clean_cond));
+	}
+
 	/*
 	 * Allocate the eviction request array.  We size it to allow one
 	 * eviction request request per session.
@@ -51,6 +105,30 @@ __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	WT_ERR(__wt_calloc_def(
 	    session, cache->max_evict_request, &cache->evict_request));
 
+	/*
+	 * Allocate the read-ahead queue, sized to allow every session to read
+	 * ahead; the threads are started when the connection is opened.
+	 */
+	WT_ERR(__wt_config_gets(session, cfg, "read_ahead", &cval));
+	cache->read_ahead = (u_int)cval.val;
+	if (cache->read_ahead > 0) {
+		WT_ERR(__wt_config_gets(session, cfg, "read_threads", &cval));
+		cache->read_threads = (u_int)cval.val;
+		WT_ERR(__wt_calloc_def(
+		    session, cache->read_threads, &cache->read_tids));
+		cache->read_queue_max = conn->session_size * cache->read_ahead;
+		WT_ERR(__wt_calloc_def(
+		    session, cache->read_queue_max, &cache->read_queue));
+		WT_ERR(__wt_cond_alloc(
+		    session, "cache read server", 1, &cache->read_cond));
+		__wt_spin_init(session, &cache->read_lock);
+		WT_ERR(__wt_cond_alloc(
+		    session, "cache reads done", 1, &cache->read_done_cond));
+	}
+
+	/* The saved working set is read once the database is open. */
+	WT_ERR(__wt_cache_warm_create(conn, cfg));
+
 	/*
 	 * We pull some values from the cache statistics (rather than have two
 	 * copies).   Set them.
@@ -63,6 +141,95 @@ err:	__wt_cache_destroy(conn);
 	return (ret);
 }
 
+/*
+ * __cache_config_pct --
+ *	Return a percentage from a reconfiguration string, if it's set.
+ */
+static int
+__cache_config_pct(
+    WT_SESSION_IMPL *session, const char *cfg[], const char *name, u_int *pctp)
+{
+	WT_CONFIG_ITEM cval;
+	int ret;
+
+	if ((ret = __wt_config_gets(session, cfg, name, &cval)) == 0)
+		*pctp = (u_int)cval.val;
+	return (ret == WT_NOTFOUND ? 0 : ret);
+}
+
+/*
+ * __wt_cache_reconfigure --
+ *	Change the cache size and eviction thresholds of an open connection.
+ * Only the values set in the configuration strings change.
+ */
+int
+__wt_cache_reconfigure(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CACHE *cache;
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t cache_size;
+	u_int dirty_target, dirty_trigger, target, trigger;
+	int ret;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	/* Check the new values before changing any of them. */
+	target = cache->eviction_target;
+	trigger = cache->eviction_trigger;
+	dirty_target = cache->eviction_dirty_target;
+	dirty_trigger = cache->eviction_dirty_trigger;
+	WT_RET(__cache_config_pct(session, cfg, "eviction_target", &target));
+	WT_RET(__cache_config_pct(session, cfg, "eviction_trigger", &trigger));
+	WT_RET(__cache_config_pct(
+	    session, cfg, "eviction_dirty_target", &dirty_target));
+	WT_RET(__cache_config_pct(
+	    session, cfg, "eviction_dirty_trigger", &dirty_trigger));
+	if (target >= trigger)
+		WT_RET_MSG(session, EINVAL,
+		    "eviction target must be lower than the eviction trigger");
+	if (dirty_target >= dirty_trigger)
+		WT_RET_MSG(session, EINVAL,
+		    "eviction dirty target must be lower than the eviction "
+		    "dirty trigger");
+
+	cache_size = 0;
+	if ((ret = __wt_config_gets(session, cfg, "cache_size", &cval)) == 0)
+		cache_size = (uint64_t)cval.val;
+	else if (ret != WT_NOTFOUND)
+		return (ret);
+
+	cache->eviction_target = target;
+	cache->eviction_trigger = trigger;
+	cache->eviction_dirty_target = dirty_target;
+	cache->eviction_dirty_trigger = dirty_trigger;
+
+	/*
+	 * A larger cache takes effect immediately: wake any threads waiting
+	 * for space.  A smaller cache is reached in steps by the eviction
+	 * server, so application threads aren't locked out of the cache while
+	 * it's evicting the difference.
+	 */
+	if (cache_size != 0) {
+		__wt_spin_lock(session, &conn->spinlock);
+		if (cache_size >= conn->cache_size) {
+			cache->resize_target = 0;
+			conn->cache_size = cache_size;
+		} else
+			cache->resize_target = cache_size;
+		__wt_spin_unlock(session, &conn->spinlock);
+
+		if (cache->evict_waiters != 0)
+			__wt_cond_signal(session, cache->evict_waiter_cond);
+	}
+	__wt_cache_stats_update(conn);
+
+	/* The thresholds may have been crossed, let eviction check. */
+	__wt_evict_server_wake(session);
+	return (0);
+}
+
 /*
  * __wt_cache_stats_update --
  *	Update the cache statistics for return to the application.
@@ -77,6 +244,8 @@ __wt_cache_stats_update(WT_CONNECTION_IMPL *conn)
 	WT_STAT_SET(conn->stats, cache_bytes_max, conn->cache_size);
 	WT_STAT_SET(
 	    conn->stats, cache_bytes_inuse, __wt_cache_bytes_inuse(cache));
+	WT_STAT_SET(
+	    conn->stats, cache_bytes_dirty, __wt_cache_bytes_dirty(cache));
 	WT_STAT_SET(
 	    conn->stats, cache_pages_inuse, __wt_cache_pages_inuse(cache));
 }
@@ -90,6 +259,8 @@ __wt_cache_destroy(WT_CONNECTION_IMPL *conn)
 {
 	WT_SESSION_IMPL *session;
 	WT_CACHE *cache;
+	WT_EVICT_WORKER *worker;
+	u_int i;
 
 	session = &conn->default_session;
 	cache = conn->cache;
@@ -97,10 +268,41 @@ __wt_cache_destroy(WT_CONNECTION_IMPL *conn)
 	if (cache == NULL)
 		return;
 
+	if (cache->workers != NULL) {
+		for (i = 0, worker = cache->workers;
+		    i < cache->eviction_workers; ++i, ++worker) {
+			if (worker->cond != NULL)
+				(void)__wt_cond_destroy(session, worker->cond);
+			__wt_free(session, worker->stats);
+		}
+		__wt_free(session, cache->workers);
+	}
+	if (cache->evict_worker_cond != NULL)
+		(void)__wt_cond_destroy(session, cache->evict_worker_cond);
+
 	if (cache->evict_cond != NULL)
 		(void)__wt_cond_destroy(session, cache->evict_cond);
+	if (cache->evict_waiter_cond != NULL)
+		(void)__wt_cond_destroy(session, cache->evict_waiter_cond);
 	__wt_spin_destroy(session, &cache->lru_lock);
 
+	if (cache->clean_cond != NULL)
+		(void)__wt_cond_destroy(session, cache->clean_cond);
+	__wt_free(session, cache->clean_tids);
+
+	if (cache->read_cond != NULL) {
+		(void)__wt_cond_destroy(session, cache->read_cond);
+		__wt_spin_destroy(session, &cache->read_lock);
+	}
+	if (cache->read_done_cond != NULL)
+		(void)__wt_cond_destroy(session, cache->read_done_cond);
+	__wt_free(session, cache->read_queue);
+	__wt_free(session, cache->read_tids);
+
+	__wt_cache_warm_destroy(conn);
+
+	__wt_free(session, cache->evict);
+	__wt_free(session, cache->clean);
 	__wt_free(session, cache->evict_request);
 	__wt_free(session, conn->cache);
 }
@@ -15,7 +15,10 @@ static inline int
 __cursor_fix_append_next(WT_CURSOR_BTREE *cbt, int newpage)
 {
 	WT_ITEM *val;
+	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
 
+	session = (WT_SESSION_IMPL *)cbt->iface.session;
 	val = &cbt->iface.value;
 
 	if (newpage) {
@@ -26,12 +29,17 @@ __cursor_fix_append_next(WT_CURSOR_BTREE *cbt, int newpage)
 		    (cbt->ins = WT_SKIP_NEXT(cbt->ins)) == NULL)
 			return (WT_NOTFOUND);
 
+	/*
+	 * Records without a visible update read as zero, the same as records
+	 * in the gaps between appended records.
+	 */
 	cbt->iface.recno = ++cbt->recno;
-	if (cbt->recno < WT_INSERT_RECNO(cbt->ins)) {
+	if (cbt->recno < WT_INSERT_RECNO(cbt->ins) ||
+	    (upd = __wt_txn_read(session, cbt->ins->upd)) == NULL) {
 		cbt->v = 0;
 		val->data = &cbt->v;
 	} else
-		val->data = WT_UPDATE_DATA(cbt->ins->upd);
+		val->data = WT_UPDATE_DATA(upd);
 	val->size = 1;
 	return (0);
 }
@@ -47,6 +55,7 @@ __cursor_fix_next(WT_CURSOR_BTREE *cbt, int newpage)
 	WT_INSERT *ins;
 	WT_ITEM *val;
 	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
 	uint64_t *recnop;
 
 	session = (WT_SESSION_IMPL *)cbt->iface.session;
@@ -71,10 +80,11 @@ __cursor_fix_next(WT_CURSOR_BTREE *cbt, int newpage)
 		++cbt->recno;
 new_page:	*recnop = cbt->recno;
 
-		/* Check any insert list for a matching record. */
+		/* Check any insert list for a matching, visible record. */
 		if ((ins = __col_insert_search_match(
-		    WT_COL_UPDATE_SINGLE(cbt->page), cbt->recno)) != NULL) {
-			val->data = WT_UPDATE_DATA(ins->upd);
+		    WT_COL_UPDATE_SINGLE(cbt->page), cbt->recno)) != NULL &&
+		    (upd = __wt_txn_read(session, ins->upd)) != NULL) {
+			val->data = WT_UPDATE_DATA(upd);
 			val->size = 1;
 			return (0);
 		}
@@ -95,7 +105,10 @@ static inline int
 __cursor_var_append_next(WT_CURSOR_BTREE *cbt, int newpage)
 {
 	WT_ITEM *val;
+	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
 
+	session = (WT_SESSION_IMPL *)cbt->iface.session;
 	val = &cbt->iface.value;
 
 	if (newpage) {
@@ -108,10 +121,11 @@ __cursor_var_append_next(WT_CURSOR_BTREE *cbt, int newpage)
 			return (WT_NOTFOUND);
 
 new_page:	cbt->iface.recno = WT_INSERT_RECNO(cbt->ins);
-		if (WT_UPDATE_DELETED_ISSET(cbt->ins->upd))
+		if ((upd = __wt_txn_read(session, cbt->ins->upd)) == NULL ||
+		    WT_UPDATE_DELETED_ISSET(upd))
 			continue;
-		val->data = WT_UPDATE_DATA(cbt->ins->upd);
-		val->size = cbt->ins->upd->size;
+		val->data = WT_UPDATE_DATA(upd);
+		val->size = upd->size;
 		break;
 	}
 	return (0);
@@ -130,6 +144,7 @@ __cursor_var_next(WT_CURSOR_BTREE *cbt, int newpage)
 	WT_INSERT *ins;
 	WT_ITEM *val;
 	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
 	uint64_t *recnop;
 
 	session = (WT_SESSION_IMPL *)cbt->iface.session;
@@ -156,13 +171,14 @@ new_page:	*recnop = cbt->recno;
 		if ((cip = __col_var_search(cbt->page, cbt->recno)) == NULL)
 			return (WT_NOTFOUND);
 
-		/* Check any insert list for a matching record. */
+		/* Check any insert list for a matching, visible record. */
 		if ((ins = __col_insert_search_match(
-		    WT_COL_UPDATE(cbt->page, cip), cbt->recno)) != NULL) {
-			if (WT_UPDATE_DELETED_ISSET(ins->upd))
+		    WT_COL_UPDATE(cbt->page, cip), cbt->recno)) != NULL &&
+		    (upd = __wt_txn_read(session, ins->upd)) != NULL) {
+			if (WT_UPDATE_DELETED_ISSET(upd))
 				continue;
-			val->data = WT_UPDATE_DATA(ins->upd);
-			val->size = ins->upd->size;
+			val->data = WT_UPDATE_DATA(upd);
+			val->size = upd->size;
 			return (0);
 		}
 
@@ -207,8 +223,10 @@ __cursor_row_next(WT_CURSOR_BTREE *cbt, int newpage)
 {
 	WT_ITEM *key, *val;
 	WT_ROW *rip;
+	WT_SESSION_IMPL *session;
 	WT_UPDATE *upd;
 
+	session = (WT_SESSION_IMPL *)cbt->iface.session;
 	key = &cbt->iface.key;
 	val = &cbt->iface.value;
 
@@ -241,8 +259,8 @@ __cursor_row_next(WT_CURSOR_BTREE *cbt, int newpage)
 			cbt->ins = WT_SKIP_NEXT(cbt->ins);
 
 new_insert:	if (cbt->ins != NULL) {
-			upd = cbt->ins->upd;
-			if (WT_UPDATE_DELETED_ISSET(upd))
+			upd = __wt_txn_read(session, cbt->ins->upd);
+			if (upd == NULL || WT_UPDATE_DELETED_ISSET(upd))
 				continue;
 			key->data = WT_INSERT_KEY(cbt->ins);
 			key->size = WT_INSERT_KEY_SIZE(cbt->ins);
@@ -270,11 +288,11 @@ new_insert:	if (cbt->ins != NULL) {
 		cbt->ins = NULL;
 
 		rip = &cbt->page->u.row.d[cbt->slot / 2 - 1];
-		upd = WT_ROW_UPDATE(cbt->page, rip);
+		upd = __wt_txn_read(session, WT_ROW_UPDATE(cbt->page, rip));
 		if (upd != NULL && WT_UPDATE_DELETED_ISSET(upd))
 			continue;
 
-		return (__cursor_row_slot_return(cbt, rip));
+		return (__cursor_row_slot_return(cbt, rip, upd));
 	}
 	/* NOTREACHED */
 }
@@ -358,6 +376,7 @@ __wt_btcur_next(WT_CURSOR_BTREE *cbt)
 	WT_BSTAT_INCR(session, cursor_read_next);
 
 	__cursor_func_init(cbt, 0);
+	__wt_txn_cursor_op(session);
 
 	/*
 	 * If we aren't already iterating in the right direction, there's
@@ -422,6 +441,7 @@ __wt_btcur_next(WT_CURSOR_BTREE *cbt)
 		} while (
 		    cbt->page->type == WT_PAGE_COL_INT ||
 		    cbt->page->type == WT_PAGE_ROW_INT);
+		WT_ERR(__cursor_read_ahead(cbt, 1));
 	}
 
 err:	__cursor_func_resolve(cbt, ret);
@@ -54,7 +54,8 @@ restart:
 			    cbt, cbt->ins_head, &key);
 		} else
 			cbt->ins = __col_insert_search(cbt->ins_head,
-			    cbt->ins_stack, WT_INSERT_RECNO(current));
+			    cbt->ins_stack, cbt->next_stack,
+			    WT_INSERT_RECNO(current));
 	}
 
 	/*
@@ -121,7 +122,10 @@ static inline int
 __cursor_fix_append_prev(WT_CURSOR_BTREE *cbt, int newpage)
 {
 	WT_ITEM *val;
+	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
 
+	session = (WT_SESSION_IMPL *)cbt->iface.session;
 	val = &cbt->iface.value;
 
 	if (newpage) {
@@ -137,12 +141,17 @@ __cursor_fix_append_prev(WT_CURSOR_BTREE *cbt, int newpage)
 		--cbt->recno;
 	}
 
+	/*
+	 * Records without a visible update read as zero, the same as records
+	 * in the gaps between appended records.
+	 */
 	cbt->iface.recno = cbt->recno;
-	if (cbt->recno > WT_INSERT_RECNO(cbt->ins)) {
+	if (cbt->recno > WT_INSERT_RECNO(cbt->ins) ||
+	    (upd = __wt_txn_read(session, cbt->ins->upd)) == NULL) {
 		cbt->v = 0;
 		val->data = &cbt->v;
 	} else
-		val->data = WT_UPDATE_DATA(cbt->ins->upd);
+		val->data = WT_UPDATE_DATA(upd);
 	val->size = 1;
 	return (0);
 }
@@ -158,6 +167,7 @@ __cursor_fix_prev(WT_CURSOR_BTREE *cbt, int newpage)
 	WT_INSERT *ins;
 	WT_ITEM *val;
 	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
 	uint64_t *recnop;
 
 	session = (WT_SESSION_IMPL *)cbt->iface.session;
@@ -182,13 +192,16 @@ __cursor_fix_prev(WT_CURSOR_BTREE *cbt, int newpage)
 		--cbt->recno;
 new_page:	*recnop = cbt->recno;
 
-		/* Check any insert list for a matching record. */
-		if ((ins = cbt->ins = __col_insert_search_match(
-		    WT_COL_UPDATE_SINGLE(cbt->page), cbt->recno)) != NULL) {
-			val->data = WT_UPDATE_DATA(ins->upd);
+		/* Check any insert list for a matching, visible record. */
+		if ((ins = __col_insert_search_match(
+		    WT_COL_UPDATE_SINGLE(cbt->page), cbt->recno)) != NULL &&
+		    (upd = __wt_txn_read(session, ins->upd)) != NULL) {
+			cbt->ins = ins;
+			val->data = WT_UPDATE_DATA(upd);
 			val->size = 1;
 			return (0);
 		}
+		cbt->ins = NULL;
 
 		cbt->v = __bit_getv_recno(cbt->page, cbt->recno, btree->bitcnt);
 		val->data = &cbt->v;
@@ -206,7 +219,10 @@ static inline int
 __cursor_var_append_prev(WT_CURSOR_BTREE *cbt, int newpage)
 {
 	WT_ITEM *val;
+	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
 
+	session = (WT_SESSION_IMPL *)cbt->iface.session;
 	val = &cbt->iface.value;
 
 	if (newpage) {
@@ -220,10 +236,11 @@ new_page:	if (cbt->ins == NULL)
 			return (WT_NOTFOUND);
 
 		cbt->iface.recno = WT_INSERT_RECNO(cbt->ins);
-		if (WT_UPDATE_DELETED_ISSET(cbt->ins->upd))
+		if ((upd = __wt_txn_read(session, cbt->ins->upd)) == NULL ||
+		    WT_UPDATE_DELETED_ISSET(upd))
 			continue;
-		val->data = WT_UPDATE_DATA(cbt->ins->upd);
-		val->size = cbt->ins->upd->size;
+		val->data = WT_UPDATE_DATA(upd);
+		val->size = upd->size;
 		break;
 	}
 	return (0);
@@ -242,6 +259,7 @@ __cursor_var_prev(WT_CURSOR_BTREE *cbt, int newpage)
 	WT_INSERT *ins;
 	WT_ITEM *val;
 	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
 	uint64_t *recnop;
 
 	session = (WT_SESSION_IMPL *)cbt->iface.session;
@@ -268,14 +286,15 @@ new_page:	*recnop = cbt->recno;
 		if ((cip = __col_var_search(cbt->page, cbt->recno)) == NULL)
 			return (WT_NOTFOUND);
 
-		/* Check any insert list for a matching record. */
+		/* Check any insert list for a matching, visible record. */
 		if ((ins = __col_insert_search_match(
-		    WT_COL_UPDATE(cbt->page, cip), cbt->recno)) != NULL) {
-			if (WT_UPDATE_DELETED_ISSET(ins->upd))
+		    WT_COL_UPDATE(cbt->page, cip), cbt->recno)) != NULL &&
+		    (upd = __wt_txn_read(session, ins->upd)) != NULL) {
+			if (WT_UPDATE_DELETED_ISSET(upd))
 				continue;
 			cbt->ins = ins;
-			val->data = WT_UPDATE_DATA(ins->upd);
-			val->size = ins->upd->size;
+			val->data = WT_UPDATE_DATA(upd);
+			val->size = upd->size;
 			return (0);
 		}
 
@@ -368,8 +387,8 @@ __cursor_row_prev(WT_CURSOR_BTREE *cbt, int newpage)
 			__cursor_skip_prev(cbt);
 
 new_insert:	if ((ins = cbt->ins) != NULL) {
-			upd = ins->upd;
-			if (WT_UPDATE_DELETED_ISSET(upd))
+			upd = __wt_txn_read(session, ins->upd);
+			if (upd == NULL || WT_UPDATE_DELETED_ISSET(upd))
 				continue;
 			key->data = WT_INSERT_KEY(ins);
 			key->size = WT_INSERT_KEY_SIZE(ins);
@@ -398,11 +417,11 @@ new_insert:	if ((ins = cbt->ins) != NULL) {
 		cbt->ins = NULL;
 
 		rip = &cbt->page->u.row.d[cbt->slot / 2 - 1];
-		upd = WT_ROW_UPDATE(cbt->page, rip);
+		upd = __wt_txn_read(session, WT_ROW_UPDATE(cbt->page, rip));
 		if (upd != NULL && WT_UPDATE_DELETED_ISSET(upd))
 			continue;
 
-		return (__cursor_row_slot_return(cbt, rip));
+		return (__cursor_row_slot_return(cbt, rip, upd));
 	}
 	/* NOTREACHED */
 }
@@ -421,6 +440,7 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt)
 	WT_BSTAT_INCR(session, cursor_read_prev);
 
 	__cursor_func_init(cbt, 0);
+	__wt_txn_cursor_op(session);
 
 	/*
 	 * If we aren't already iterating in the right direction, there's
@@ -475,6 +495,7 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt)
 		} while (
 		    cbt->page->type == WT_PAGE_COL_INT ||
 		    cbt->page->type == WT_PAGE_ROW_INT);
+		WT_ERR(__cursor_read_ahead(cbt, 0));
 
 		/*
 		 * The last page in a column-store has appended entries.
@@ -60,14 +60,26 @@ __cursor_invalid(WT_CURSOR_BTREE *cbt)
 	WT_COL *cip;
 	WT_INSERT *ins;
 	WT_PAGE *page;
+	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
 
 	btree = cbt->btree;
 	ins = cbt->ins;
 	page = cbt->page;
+	session = (WT_SESSION_IMPL *)cbt->iface.session;
 
-	/* If we found an item on an insert list, check there. */
-	if (ins != NULL)
-		return (WT_UPDATE_DELETED_ISSET(ins->upd) ? 1 : 0);
+	/*
+	 * If we found an item on an insert list, check there.  If none of its
+	 * updates are visible: a row-store insert or a column-store append
+	 * doesn't exist yet, a column-store update falls back to the page.
+	 */
+	if (ins != NULL) {
+		if ((upd = __wt_txn_read(session, ins->upd)) != NULL)
+			return (WT_UPDATE_DELETED_ISSET(upd) ? 1 : 0);
+		if (btree->type == BTREE_ROW ||
+		    cbt->ins_head == WT_COL_APPEND(page))
+			return (1);
+	}
 
 	/* The page may be empty, the search routine doesn't check. */
 	if (page->entries == 0)
@@ -86,15 +98,49 @@ __cursor_invalid(WT_CURSOR_BTREE *cbt)
 			return (1);
 		break;
 	case BTREE_ROW:
-		if (page->u.row.upd != NULL &&
-		    page->u.row.upd[cbt->slot] != NULL &&
-		    WT_UPDATE_DELETED_ISSET(page->u.row.upd[cbt->slot]))
+		if (page->u.row.upd != NULL && (upd = __wt_txn_read(session,
+		    page->u.row.upd[cbt->slot])) != NULL &&
+		    WT_UPDATE_DELETED_ISSET(upd))
 			return (1);
 		break;
 	}
 	return (0);
 }
 
+/*
+ * __cursor_log --
+ *	Log a successful change for recovery to replay.
+ */
+static inline int
+__cursor_log(WT_CURSOR_BTREE *cbt, int remove)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_SESSION_IMPL *session;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	/*
+	 * Files without an ID (the schema file) aren't logged, and neither
+	 * are the changes recovery replays.
+	 */
+	if (S2C(session)->log == NULL ||
+	    btree->id == 0 || F_ISSET(session, WT_SESSION_NO_LOGGING))
+		return (0);
+
+	if (btree->type == BTREE_ROW)
+		return (remove ?
+		    __wt_logop_row_remove(session, btree->id, &cursor->key) :
+		    __wt_logop_row_put(
+		    session, btree->id, &cursor->key, &cursor->value));
+	return (remove ?
+	    __wt_logop_col_remove(session, btree->id, cursor->recno) :
+	    __wt_logop_col_put(
+	    session, btree->id, cursor->recno, &cursor->value));
+}
+
 /*
  * __wt_btcur_reset --
  *	Invalidate the cursor position.
@@ -135,6 +181,7 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 		WT_RET(__cursor_size_chk(session, &cursor->key));
 
 	__cursor_func_init(cbt, 1);
+	__wt_txn_cursor_op(session);
 
 	WT_ERR(btree->type == BTREE_ROW ?
 	    __wt_row_search(session, cbt, 0) :
@@ -181,6 +228,7 @@ __wt_btcur_search_near(WT_CURSOR_BTREE *cbt, int *exact)
 		WT_RET(__cursor_size_chk(session, &cursor->key));
 
 	__cursor_func_init(cbt, 1);
+	__wt_txn_cursor_op(session);
 
 	WT_ERR(btree->type == BTREE_ROW ?
 	    __wt_row_search(session, cbt, 0) :
@@ -249,6 +297,7 @@ __wt_btcur_insert(WT_CURSOR_BTREE *cbt)
 	WT_RET(__cursor_size_chk(session, &cursor->value));
 
 retry:	__cursor_func_init(cbt, 1);
+	__wt_txn_cursor_op(session);
 
 	switch (btree->type) {
 	case BTREE_COL_FIX:
@@ -309,7 +358,9 @@ retry:	__cursor_func_init(cbt, 1);
 	WT_ILLEGAL_VALUE(session);
 	}
 
-err:	__cursor_func_resolve(cbt, ret);
+err:	if (ret == 0)
+		ret = __cursor_log(cbt, 0);
+	__cursor_func_resolve(cbt, ret);
 
 	return (ret);
 }
@@ -335,6 +386,7 @@ __wt_btcur_remove(WT_CURSOR_BTREE *cbt)
 		WT_RET(__cursor_size_chk(session, &cursor->key));
 
 retry:	__cursor_func_init(cbt, 1);
+	__wt_txn_cursor_op(session);
 
 	switch (btree->type) {
 	case BTREE_COL_FIX:
@@ -364,7 +416,9 @@ retry:	__cursor_func_init(cbt, 1);
 	WT_ILLEGAL_VALUE(session);
 	}
 
-err:	__cursor_func_resolve(cbt, ret);
+err:	if (ret == 0)
+		ret = __cursor_log(cbt, 1);
+	__cursor_func_resolve(cbt, ret);
 
 	return (ret);
 }
@@ -391,6 +445,7 @@ __wt_btcur_update(WT_CURSOR_BTREE *cbt)
 	WT_RET(__cursor_size_chk(session, &cursor->value));
 
 retry:	__cursor_func_init(cbt, 1);
+	__wt_txn_cursor_op(session);
 
 	switch (btree->type) {
 	case BTREE_COL_FIX:
@@ -426,7 +481,9 @@ retry:	__cursor_func_init(cbt, 1);
 	WT_ILLEGAL_VALUE(session);
 	}
 
-err:	__cursor_func_resolve(cbt, ret);
+err:	if (ret == 0)
+		ret = __cursor_log(cbt, 0);
+	__cursor_func_resolve(cbt, ret);
 
 	return (ret);
 }
@@ -13,9 +13,6 @@ static void __free_page_col_var(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_page_row_int(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_page_row_leaf(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_skip_array(WT_SESSION_IMPL *, WT_INSERT_HEAD **, uint32_t);
-static void __free_skip_list(WT_SESSION_IMPL *, WT_INSERT *);
-static void __free_update(WT_SESSION_IMPL *, WT_UPDATE **, uint32_t);
-static void __free_update_list(WT_SESSION_IMPL *, WT_UPDATE *);
 
 /*
  * __wt_page_out --
@@ -34,6 +31,9 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t flags)
 
 	WT_ASSERT(session, !F_ISSET(page, WT_PAGE_EVICT_LRU));
 
+	/* Queued writes of the page can no longer re-dirty it. */
+	__wt_block_queue_page_out(session, page);
+
 	/* If not a split merged into its parent, the page must be clean. */
 	WT_ASSERT(session,
 	    !__wt_page_is_modified(page) ||
@@ -43,6 +43,10 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t flags)
 	__wt_hazard_validate(session, page);
 #endif
 
+	/* Update the count of pages in the replacement policy's hot set. */
+	if (page->evict_state == WT_EVICT_STATE_HOT)
+		WT_ATOMIC_ADD(S2C(session)->cache->evict_hot_out, 1);
+
 	/*
 	 * If this page has a memory footprint associated with it, update
 	 * the cache information.
@@ -76,10 +80,16 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t flags)
 		__wt_free(session, page->modify);
 	}
 
+	/*
+	 * The page's WT_INSERT, WT_UPDATE and WT_IKEY structures are freed
+	 * with its arena.
+	 */
+	__wt_page_arena_discard(session, page);
+
 #ifdef HAVE_DIAGNOSTIC
 	memset(page, WT_DEBUG_BYTE, sizeof(WT_PAGE));
 #endif
-	__wt_free(session, page);
+	__wt_hazard_page_free(session, page);
 }
 
 /*
@@ -93,7 +103,6 @@ __free_page_col_fix(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	/* Free the append array. */
 	if ((append = WT_COL_APPEND(page)) != NULL) {
-		__free_skip_list(session, WT_SKIP_FIRST(append));
 		__wt_free(session, append);
 		__wt_free(session, page->modify->append);
 	}
@@ -145,7 +154,6 @@ __free_page_col_var(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	/* Free the append array. */
 	if ((append = WT_COL_APPEND(page)) != NULL) {
-		__free_skip_list(session, WT_SKIP_FIRST(append));
 		__wt_free(session, append);
 		__wt_free(session, page->modify->append);
 	}
@@ -162,25 +170,19 @@ __free_page_col_var(WT_SESSION_IMPL *session, WT_PAGE *page)
 static void
 __free_page_row_int(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
-	WT_IKEY *ikey;
 	WT_REF *ref;
 	uint32_t i;
 
 	/*
-	 * Free any allocated keys.
-	 *
 	 * For each referenced addr, see if the addr was an allocation, and if
-	 * so, free it.
+	 * so, free it.  The keys are freed with the page's arena.
 	 */
-	WT_REF_FOREACH(page, ref, i) {
-		if ((ikey = ref->u.key) != NULL)
-			__wt_free(session, ikey);
+	WT_REF_FOREACH(page, ref, i)
 		if (ref->addr != NULL &&
 		    __wt_off_page(page, ref->addr)) {
 			__wt_free(session, ((WT_ADDR *)ref->addr)->addr);
 			__wt_free(session, ref->addr);
 		}
-	}
 
 	/* Free the subtree-reference array. */
 	__wt_free(session, page->u.intl.t);
@@ -193,20 +195,10 @@ __free_page_row_int(WT_SESSION_IMPL *session, WT_PAGE *page)
 static void
 __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
-	WT_IKEY *ikey;
-	WT_ROW *rip;
-	uint32_t i;
-
 	/*
-	 * Free the in-memory index array.
-	 *
-	 * For each entry, see if the key was an allocation (that is, if it
-	 * points somewhere other than the original page), and if so, free
-	 * the memory.
+	 * Free the in-memory index array: instantiated keys are freed with the
+	 * page's arena.
 	 */
-	WT_ROW_FOREACH(page, rip, i)
-		if ((ikey = rip->key) != NULL && __wt_off_page(page, ikey))
-			__wt_free(session, ikey);
 	__wt_free(session, page->u.row.d);
 
 	/*
@@ -220,8 +212,7 @@ __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
 		__free_skip_array(session, page->u.row.ins, page->entries + 1);
 
 	/* Free the update array. */
-	if (page->u.row.upd != NULL)
-		__free_update(session, page->u.row.upd, page->entries);
+	__wt_free(session, page->u.row.upd);
 }
 
 /*
@@ -236,70 +227,13 @@ __free_skip_array(
 
 	/*
 	 * For each non-NULL slot in the page's array of inserts, free the
-	 * linked list anchored in that slot.
+	 * insert list head: the WT_INSERT and WT_UPDATE structures are freed
+	 * with the page's arena.
 	 */
 	for (head = head_arg; entries > 0; --entries, ++head)
-		if (*head != NULL) {
-			__free_skip_list(session, WT_SKIP_FIRST(*head));
+		if (*head != NULL)
 			__wt_free(session, *head);
-		}
 
 	/* Free the page's array of inserts. */
 	__wt_free(session, head_arg);
 }
-
-/*
- * __free_skip_list --
- *	Walk a WT_INSERT forward-linked list and free the per-thread combination
- * of a WT_INSERT structure and its associated chain of WT_UPDATE structures.
- */
-static void
-__free_skip_list(WT_SESSION_IMPL *session, WT_INSERT *ins)
-{
-	WT_INSERT *next;
-
-	do {
-		__free_update_list(session, ins->upd);
-
-		next = WT_SKIP_NEXT(ins);
-		__wt_free(session, ins);
-	} while ((ins = next) != NULL);
-}
-
-/*
- * __free_update --
- *	Discard the update array.
- */
-static void
-__free_update(
-    WT_SESSION_IMPL *session, WT_UPDATE **update_head, uint32_t entries)
-{
-	WT_UPDATE **updp;
-
-	/*
-	 * For each non-NULL slot in the page's array of updates, free the
-	 * linked list anchored in that slot.
-	 */
-	for (updp = update_head; entries > 0; --entries, ++updp)
-		if (*updp != NULL)
-			__free_update_list(session, *updp);
-
-	/* Free the page's array of updates. */
-	__wt_free(session, update_head);
-}
-
-/*
- * __free_update_list --
- *	Walk a WT_UPDATE forward-linked list and free the per-thread combination
- *	of a WT_UPDATE structure and its associated data.
- */
-static void
-__free_update_list(WT_SESSION_IMPL *session, WT_UPDATE *upd)
-{
-	WT_UPDATE *next;
-
-	do {
-		next = upd->next;
-		__wt_free(session, upd);
-	} while ((upd = next) != NULL);
-}
@@ -7,14 +7,19 @@
 
 #include "wt_internal.h"
 
+static int  __evict_clean(WT_SESSION_IMPL *, u_int *);
+static int  __evict_dirty(WT_SESSION_IMPL *);
+static int  __evict_dirty_over(WT_SESSION_IMPL *, u_int);
 static int  __evict_file(WT_SESSION_IMPL *, WT_EVICT_REQ *);
+static void __evict_get_dirty(WT_SESSION_IMPL *, WT_BTREE **, WT_PAGE **);
 static int  __evict_lru(WT_SESSION_IMPL *);
-static int  __evict_lru_cmp(const void *, const void *);
-static void __evict_lru_sort(WT_SESSION_IMPL *);
+static int  __evict_lru_page(WT_SESSION_IMPL *, int, int *);
 static void __evict_pages(WT_SESSION_IMPL *);
+static int  __evict_quota_over(WT_SESSION_IMPL *);
 static int  __evict_request_walk(WT_SESSION_IMPL *);
-static int  __evict_walk(WT_SESSION_IMPL *);
-static int  __evict_walk_file(WT_SESSION_IMPL *, u_int *);
+static void __evict_resize(WT_SESSION_IMPL *);
+static int  __evict_walk(WT_SESSION_IMPL *, uint32_t);
+static int  __evict_walk_file(WT_SESSION_IMPL *, uint32_t);
 static int  __evict_worker(WT_SESSION_IMPL *);
 
 /*
@@ -23,7 +28,19 @@ static int  __evict_worker(WT_SESSION_IMPL *);
  */
 #define	WT_EVICT_GROUP		30	/* Consider N pages as LRU candidates */
 #define	WT_EVICT_WALK_PER_TABLE	35	/* Pages to visit per file */
-#define	WT_EVICT_WALK_BASE	50	/* Pages tracked across file visits */
+#define	WT_EVICT_WALK_BASE	50	/* Pages kept across walks */
+#define	WT_EVICT_QUEUE_MAX	400	/* Pages tracked for eviction */
+#define	WT_EVICT_CLEAN_MAX	100	/* Dirty pages tracked for cleaning */
+#define	WT_EVICT_CLEAN_WALK	200	/* Pages visited per file to clean */
+#define	WT_EVICT_2Q_AM_BIAS	((uint64_t)1 << 32) /* 2Q: Am key bias */
+#define	WT_EVICT_HOT_PCT	75	/* Hot set percentage of the cache */
+
+/*
+ * The queues an eviction walk fills: the eviction queue, and, while too much
+ * of the cache is dirty, the cleaner queue.
+ */
+#define	WT_EVICT_QUEUE_LRU	0x01	/* Queue pages for eviction */
+#define	WT_EVICT_QUEUE_CLEAN	0x02	/* Queue dirty pages for cleaning */
 
 /*
  * WT_EVICT_REQ_FOREACH --
@@ -49,22 +66,286 @@ __evict_clr(WT_SESSION_IMPL *session, WT_EVICT_LIST *e)
 	e->btree = WT_DEBUG_POINT;
 }
 
+/*
+ * __evict_clr_queue --
+ *	Clear all entries in a queue.
+ */
+static inline void
+__evict_clr_queue(
+    WT_SESSION_IMPL *session, WT_EVICT_LIST *heap, uint32_t *countp)
+{
+	uint32_t i;
+
+	for (i = 0; i < *countp; i++)
+		__evict_clr(session, &heap[i]);
+	*countp = 0;
+}
+
 /*
  * __evict_clr_all --
- *	Clear all entries in the eviction list.
+ *	Clear all entries in the eviction and cleaner queues.
  */
 static inline void
 __evict_clr_all(WT_SESSION_IMPL *session)
 {
 	WT_CACHE *cache;
-	WT_EVICT_LIST *evict;
-	int i, elem;
 
 	cache = S2C(session)->cache;
 
-	elem = cache->evict_entries;
-	for (evict = cache->evict, i = 0; i < elem; i++, evict++)
-		__evict_clr(session, evict);
+	__evict_clr_queue(session, cache->evict, &cache->evict_count);
+	__evict_clr_queue(session, cache->clean, &cache->clean_count);
+}
+
+/*
+ * __evict_queue_empty --
+ *	Return if the eviction server's queue of pages has been emptied.
+ */
+static inline int
+__evict_queue_empty(WT_CACHE *cache)
+{
+	return (cache->evict_count == 0 ||
+	    cache->evict_taken >= cache->evict_candidates);
+}
+
+/*
+ * __evict_page_key --
+ *	Return the replacement policy's sort key for a page.
+ */
+static inline uint64_t
+__evict_page_key(WT_CACHE *cache, WT_PAGE *page)
+{
+	uint64_t key;
+
+	switch (cache->evict_policy) {
+	case WT_EVICT_POLICY_2Q:
+		/*
+		 * Pages in the A1 queue (read and not accessed since), are
+		 * evicted in the order they were read.  Pages in the Am queue
+		 * are evicted in LRU order, after the A1 pages unless the A1
+		 * queue has shrunk below its share of the cache.
+		 */
+		if (page->evict_state != WT_EVICT_STATE_HOT &&
+		    page->read_gen <= page->evict_gen)
+			return (page->evict_gen);
+		key = page->read_gen;
+		if (!cache->evict_hot_full)
+			key += WT_EVICT_2Q_AM_BIAS;
+		break;
+	case WT_EVICT_POLICY_CLOCKPRO:
+		/*
+		 * Cold pages are evicted in the order they became cold; pages
+		 * accessed since they were queued sort as recently used.
+		 */
+		key = page->read_gen > page->evict_gen ?
+		    page->read_gen : page->evict_gen;
+		break;
+	case WT_EVICT_POLICY_LRU:
+	default:
+		key = page->read_gen;
+		break;
+	}
+
+	/*
+	 * Bias in favor of leaf pages.  Otherwise, we can waste time
+	 * considering parent pages for eviction while their child pages are
+	 * still in memory.
+	 *
+	 * Bump the LRU generation by a small fixed amount: the idea being that
+	 * if we have enough good leaf page candidates, we should evict them
+	 * first, but not completely ignore an old internal page.
+	 */
+	if (page->type == WT_PAGE_ROW_INT || page->type == WT_PAGE_COL_INT)
+		key += WT_EVICT_GROUP;
+	return (key);
+}
+
+/*
+ * __evict_key --
+ *	Return the eviction queue sort key for a page.
+ */
+static inline uint64_t
+__evict_key(WT_CACHE *cache, WT_BTREE *btree, WT_PAGE *page)
+{
+	uint64_t key, skew;
+
+	/* Pages of files over their cache quota are evicted first. */
+	if (__wt_btree_over_quota(btree))
+		return (0);
+
+	/*
+	 * Skew the key by the file's priority: a percentage of the pages in
+	 * the cache, in read generations.
+	 */
+	key = __evict_page_key(cache, page);
+	if (btree->cache_priority > 0)
+		key += (uint64_t)btree->cache_priority *
+		    cache->evict_priority_gen;
+	else if (btree->cache_priority < 0) {
+		skew = (uint64_t)-btree->cache_priority *
+		    cache->evict_priority_gen;
+		key = key > skew ? key - skew : 0;
+	}
+	return (key);
+}
+
+/*
+ * __evict_visit --
+ *	Update a page's replacement policy state as the eviction walk visits
+ *	it, and return if the page is a candidate for eviction.
+ */
+static inline int
+__evict_visit(WT_CACHE *cache, WT_PAGE *page)
+{
+	int referenced;
+
+	/* Check if the page has been accessed since it was last visited. */
+	referenced = page->read_gen > page->evict_gen;
+
+	switch (cache->evict_policy) {
+	case WT_EVICT_POLICY_2Q:
+		/*
+		 * Pages accessed after they were read move from the A1 queue
+		 * to the Am queue; internal pages always belong in the Am
+		 * queue.
+		 */
+		if (page->evict_state != WT_EVICT_STATE_HOT && (referenced ||
+		    page->type == WT_PAGE_ROW_INT ||
+		    page->type == WT_PAGE_COL_INT)) {
+			page->evict_state = WT_EVICT_STATE_HOT;
+			WT_ATOMIC_ADD(cache->evict_hot_in, 1);
+		}
+		return (1);
+	case WT_EVICT_POLICY_CLOCKPRO:
+		/*
+		 * The eviction walk is the clock hand: once the hot set has
+		 * reached its target size, hot pages not accessed since the
+		 * last visit become cold.  Cold pages accessed during their
+		 * test period become hot, other accessed cold pages start a
+		 * new test period.  Only cold pages that haven't been accessed
+		 * are eviction candidates, which ages out pages read once by a
+		 * scan before pages accessed repeatedly.
+		 */
+		page->evict_gen = cache->read_gen;
+		if (page->evict_state == WT_EVICT_STATE_HOT) {
+			if (!referenced && cache->evict_hot_full) {
+				page->evict_state = 0;
+				WT_ATOMIC_ADD(cache->evict_hot_out, 1);
+			}
+			return (0);
+		}
+		if (referenced) {
+			if (page->evict_state == WT_EVICT_STATE_TEST) {
+				page->evict_state = WT_EVICT_STATE_HOT;
+				WT_ATOMIC_ADD(cache->evict_hot_in, 1);
+			} else
+				page->evict_state = WT_EVICT_STATE_TEST;
+			return (0);
+		}
+		page->evict_state = 0;
+		return (1);
+	case WT_EVICT_POLICY_LRU:
+	default:
+		return (1);
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __evict_heap_down --
+ *	Move an eviction queue entry down the heap to its correct position.
+ */
+static inline void
+__evict_heap_down(WT_EVICT_LIST *heap, uint32_t count, uint32_t i)
+{
+	WT_EVICT_LIST tmp;
+	uint32_t child;
+
+	for (tmp = heap[i]; (child = 2 * i + 1) < count; i = child) {
+		if (child + 1 < count &&
+		    heap[child + 1].read_gen < heap[child].read_gen)
+			++child;
+		if (tmp.read_gen <= heap[child].read_gen)
+			break;
+		heap[i] = heap[child];
+	}
+	heap[i] = tmp;
+}
+
+/*
+ * __evict_heap_push --
+ *	Add an entry to a queue.
+ */
+static inline void
+__evict_heap_push(WT_EVICT_LIST *heap, uint32_t *countp, WT_EVICT_LIST *e)
+{
+	uint32_t i, parent;
+
+	for (i = (*countp)++; i > 0; i = parent) {
+		parent = (i - 1) / 2;
+		if (heap[parent].read_gen <= e->read_gen)
+			break;
+		heap[i] = heap[parent];
+	}
+	heap[i] = *e;
+}
+
+/*
+ * __evict_heap_pop --
+ *	Remove the oldest entry from a queue.
+ */
+static inline void
+__evict_heap_pop(WT_EVICT_LIST *heap, uint32_t *countp, WT_EVICT_LIST *e)
+{
+	*e = heap[0];
+	if (--*countp > 0) {
+		heap[0] = heap[*countp];
+		__evict_heap_down(heap, *countp, 0);
+	}
+}
+
+/*
+ * __evict_heap_trim --
+ *	Re-sort the eviction queue by the pages' current read generations, and
+ *	discard all but the oldest entries.
+ */
+static void
+__evict_heap_trim(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_EVICT_LIST *heap, saved[WT_EVICT_WALK_BASE];
+	uint32_t count, i;
+
+	cache = S2C(session)->cache;
+	heap = cache->evict;
+
+	/*
+	 * Pages are read while they're queued, so their read generations may
+	 * have changed: discard any entries cleared since they were queued,
+	 * update the keys, and rebuild the heap.
+	 */
+	for (count = i = 0; i < cache->evict_count; ++i)
+		if (heap[i].page != NULL) {
+			heap[count] = heap[i];
+			heap[count++].read_gen = __evict_key(
+			    cache, heap[i].btree, heap[i].page);
+		}
+	for (i = count / 2; i > 0; --i)
+		__evict_heap_down(heap, count, i - 1);
+	cache->evict_count = count;
+	if (count <= WT_EVICT_WALK_BASE)
+		return;
+
+	/*
+	 * Pop the oldest entries: they come out in sorted order, which is a
+	 * valid heap.  Clear the remaining entries, then copy the saved
+	 * entries back into the queue.
+	 */
+	for (i = 0; i < WT_EVICT_WALK_BASE; ++i)
+		__evict_heap_pop(heap, &cache->evict_count, &saved[i]);
+	for (i = 0; i < cache->evict_count; ++i)
+		__evict_clr(session, &heap[i]);
+	memcpy(heap, saved, sizeof(saved));
+	cache->evict_count = WT_EVICT_WALK_BASE;
 }
 
 /*
@@ -78,7 +359,7 @@ __wt_evict_clr_page(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
 	WT_CACHE *cache;
 	WT_EVICT_LIST *evict;
-	int i, elem;
+	uint32_t i;
 
 	/* Fast path: if the page isn't on the queue, don't bother searching. */
 	if (!F_ISSET(page, WT_PAGE_EVICT_LRU))
@@ -87,8 +368,16 @@ __wt_evict_clr_page(WT_SESSION_IMPL *session, WT_PAGE *page)
 	cache = S2C(session)->cache;
 	__wt_spin_lock(session, &cache->lru_lock);
 
-	elem = cache->evict_entries;
-	for (evict = cache->evict, i = 0; i < elem; i++, evict++)
+	/*
+	 * Leave the cleared entry in its queue, it's skipped when it reaches
+	 * the top of the heap.
+	 */
+	for (evict = cache->evict, i = 0; i < cache->evict_count; i++, evict++)
+		if (evict->page == page) {
+			__evict_clr(session, evict);
+			break;
+		}
+	for (evict = cache->clean, i = 0; i < cache->clean_count; i++, evict++)
 		if (evict->page == page) {
 			__evict_clr(session, evict);
 			break;
@@ -196,18 +485,17 @@ __wt_evict_file_serial_func(WT_SESSION_IMPL *session)
  * __wt_evict_page_request --
  *	Schedule a page for forced eviction due to a high volume of inserts or
  *	updates.
- *
- *	NOTE: this function is called from inside serialized functions, so it
- *	is holding the serial lock.
  */
 int
 __wt_evict_page_request(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
 	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
 	WT_EVICT_REQ *er, *er_end;
 	int first;
 
-	cache = S2C(session)->cache;
+	conn = S2C(session);
+	cache = conn->cache;
 	first = 1;
 
 	/*
@@ -233,7 +521,12 @@ __wt_evict_page_request(WT_SESSION_IMPL *session, WT_PAGE *page)
 	if (!WT_ATOMIC_CAS(page->ref->state, WT_REF_MEM, WT_REF_EVICTING))
 		return (0);
 
-	/* Find an empty slot and enter the eviction request. */
+	/*
+	 * Find an empty slot and enter the eviction request.  Serialized
+	 * functions no longer run under a single lock: acquire the eviction
+	 * request lock so other threads don't claim the same slot.
+	 */
+	__wt_spin_lock(session, &conn->serial_lock);
 	WT_EVICT_REQ_FOREACH(er, er_end, cache)
 		if (er->session == NULL) {
 			/* Always leave one empty slot */
@@ -242,9 +535,11 @@ __wt_evict_page_request(WT_SESSION_IMPL *session, WT_PAGE *page)
 				continue;
 			}
 			__evict_req_set(session, er, page, WT_EVICT_REQ_PAGE);
+			__wt_spin_unlock(session, &conn->serial_lock);
 			__wt_evict_server_wake(session);
 			return (0);
 		}
+	__wt_spin_unlock(session, &conn->serial_lock);
 
 	/*
 	 * The request table is full, that's okay for page requests: another
@@ -279,15 +574,23 @@ __wt_cache_evict_server(void *arg)
 	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &session));
 
 	while (F_ISSET(conn, WT_SERVER_RUN)) {
+		/* Step the cache size down, if it's being shrunk. */
+		__evict_resize(session);
+
 		/*
 		 * Use the same logic as application threads to decide whether
-		 * there is work to do.
+		 * there is work to do.  While the cache is being shrunk, wake
+		 * regularly to take the next step.
 		 */
 		__wt_eviction_check(session, &read_lockout, 0);
 
 		if (!read_lockout) {
 			WT_VERBOSE(session, evictserver, "sleeping");
-			__wt_cond_wait(session, cache->evict_cond);
+			if (cache->resize_target != 0)
+				__wt_cond_wait_timed(
+				    session, cache->evict_cond, 100000);
+			else
+				__wt_cond_wait(session, cache->evict_cond);
 		}
 
 		if (!F_ISSET(conn, WT_SERVER_RUN))
@@ -296,6 +599,9 @@ __wt_cache_evict_server(void *arg)
 
 		/* Evict pages from the cache as needed. */
 		WT_ERR(__evict_worker(session));
+
+		/* Write dirty pages as needed. */
+		WT_ERR(__evict_dirty(session));
 	}
 
 	if (ret == 0) {
@@ -311,7 +617,111 @@ err:		__wt_err(session, ret, "eviction server error");
 
 	WT_VERBOSE(session, evictserver, "exiting");
 
-	__wt_free(session, cache->evict);
+	if (session != &conn->default_session)
+		(void)session->iface.close(&session->iface, NULL);
+
+	return (NULL);
+}
+
+/*
+ * __evict_resize --
+ *	Take a step shrinking the cache: once eviction has reached its target
+ * for the current size, lower the size by a tenth, until the configured size
+ * is reached.
+ */
+static void
+__evict_resize(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t bytes_max, step;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	if (cache->resize_target == 0 || __wt_cache_bytes_inuse(cache) >
+	    cache->eviction_target * (conn->cache_size / 100))
+		return;
+
+	__wt_spin_lock(session, &conn->spinlock);
+	if (cache->resize_target != 0) {
+		bytes_max = conn->cache_size;
+		step = bytes_max / 10;
+		if (bytes_max - step <= cache->resize_target) {
+			bytes_max = cache->resize_target;
+			cache->resize_target = 0;
+		} else
+			bytes_max -= step;
+		conn->cache_size = bytes_max;
+		WT_VERBOSE(session, evictserver,
+		    "cache size %" PRIu64 "MB", bytes_max / WT_MEGABYTE);
+	}
+	__wt_spin_unlock(session, &conn->spinlock);
+	__wt_cache_stats_update(conn);
+}
+
+/*
+ * __wt_cache_evict_worker --
+ *	Thread to help the eviction server evict pages from the cache.
+ */
+void *
+__wt_cache_evict_worker(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_EVICT_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	time_t start_secs, stop_secs;
+	long start_nsecs, stop_nsecs;
+	int evicted, ret;
+
+	worker = arg;
+	conn = worker->conn;
+	ret = 0;
+
+	/*
+	 * We need a session handle because we're reading/writing pages.
+	 * Start with the default session to keep error handling simple.
+	 */
+	session = &conn->default_session;
+	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &session));
+
+	for (;;) {
+		/* The eviction server wakes us when it has queued pages. */
+		__wt_cond_wait(session, worker->cond);
+		if (!F_ISSET(conn, WT_SERVER_RUN))
+			break;
+		WT_VERBOSE(session,
+		    evictserver, "worker %u waking", worker->id);
+		WT_STAT_INCR(worker->stats, evict_worker_wakeup);
+
+		/*
+		 * Evict pages until the queue is empty.  Errors evicting a
+		 * page don't stop the worker: report them and wait for the
+		 * next pass.
+		 */
+		WT_ERR(__wt_epoch(session, &start_secs, &start_nsecs));
+		while ((ret = __evict_lru_page(session, 0, &evicted)) == 0)
+			if (evicted)
+				WT_STAT_INCR(worker->stats, evict_worker_pages);
+			else
+				WT_STAT_INCR(worker->stats, evict_worker_fail);
+		if (ret != WT_NOTFOUND && ret != EBUSY)
+			__wt_err(session, ret,
+			    "eviction worker %u: page eviction", worker->id);
+		ret = 0;
+		WT_ERR(__wt_epoch(session, &stop_secs, &stop_nsecs));
+		WT_STAT_INCRV(worker->stats, evict_worker_time,
+		    (uint64_t)((stop_secs - start_secs) * WT_MILLION +
+		    (stop_nsecs - start_nsecs) / 1000));
+
+		/* The eviction server waits for the queue to be emptied. */
+		__wt_cond_signal(session, conn->cache->evict_worker_cond);
+	}
+
+	if (ret != 0)
+err:		__wt_err(session, ret, "eviction worker error");
+
+	WT_VERBOSE(session, evictserver, "worker %u exiting", worker->id);
 
 	if (session != &conn->default_session)
 		(void)session->iface.close(&session->iface, NULL);
@@ -319,6 +729,57 @@ err:		__wt_err(session, ret, "eviction server error");
 	return (NULL);
 }
 
+/*
+ * __wt_cache_clean_server --
+ *	Thread writing dirty pages from the eviction queue, without discarding
+ * them.
+ */
+void *
+__wt_cache_clean_server(void *arg)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *session;
+	u_int cleaned;
+	int ret;
+
+	conn = arg;
+	cache = conn->cache;
+	ret = 0;
+
+	/*
+	 * We need a session handle because we're writing pages.  Start with
+	 * the default session to keep error handling simple.
+	 */
+	session = &conn->default_session;
+	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &session));
+
+	while (F_ISSET(conn, WT_SERVER_RUN)) {
+		__wt_cond_wait_timed(session, cache->clean_cond, 100000);
+		if (!F_ISSET(conn, WT_SERVER_RUN))
+			break;
+
+		/*
+		 * If we wrote pages and the cache is still too dirty, the
+		 * queue has run out of dirty pages: wake the eviction server
+		 * to walk the files for more.  If we wrote nothing, the dirty
+		 * pages aren't candidates yet, and waking the server would
+		 * only find the same pages again.
+		 */
+		WT_ERR(__evict_clean(session, &cleaned));
+		if (cleaned != 0 &&
+		    __evict_dirty_over(session, cache->eviction_dirty_target))
+			__wt_evict_server_wake(session);
+	}
+
+	if (0) {
+err:		__wt_err(session, ret, "cache clean server error");
+	}
+	if (session != &conn->default_session)
+		(void)session->iface.close(&session->iface, NULL);
+	return (NULL);
+}
+
 /*
  * __evict_worker --
  *	Evict pages from memory.
@@ -339,12 +800,20 @@ __evict_worker(WT_SESSION_IMPL *session)
 		/* Walk the eviction-request queue. */
 		WT_RET(__evict_request_walk(session));
 
+		/*
+		 * Once the files are being closed, only serve requests, unless
+		 * a thread closing a file is waiting for space in the cache.
+		 */
+		if (cache->evict_lru_stop && cache->evict_waiters == 0)
+			break;
+
 		/*
 		 * Keep evicting until we hit the target cache usage.
 		 */
 		bytes_inuse = __wt_cache_bytes_inuse(cache);
 		bytes_max = conn->cache_size;
-		if (bytes_inuse < cache->eviction_target * (bytes_max / 100))
+		if (bytes_inuse < cache->eviction_target * (bytes_max / 100) &&
+		    !__evict_quota_over(session))
 			break;
 
 		WT_RET(__evict_lru(session));
@@ -358,7 +827,7 @@ __evict_worker(WT_SESSION_IMPL *session)
 		bytes_inuse = __wt_cache_bytes_inuse(cache);
 		if (bytes_start == bytes_inuse) {
 			if (loop == 10) {
-				WT_STAT_INCR(conn->stats, cache_evict_slow);
+				WT_CSTAT_INCR(session, cache_evict_slow);
 				WT_VERBOSE(session, evictserver,
 				    "unable to reach eviction goal");
 				break;
@@ -369,6 +838,20 @@ __evict_worker(WT_SESSION_IMPL *session)
 	return (0);
 }
 
+/*
+ * __evict_quota_over --
+ *	Return if any file holds more of the cache than its quota.
+ */
+static int
+__evict_quota_over(WT_SESSION_IMPL *session)
+{
+	/*
+	 * Files are counted as their cache use crosses their quota, there's
+	 * no need to look at the files.
+	 */
+	return (S2C(session)->cache->quota_over != 0);
+}
+
 /*
  * __evict_request_walk --
  *	Walk the eviction request queue.
@@ -413,25 +896,37 @@ __evict_request_walk(WT_SESSION_IMPL *session)
 			WT_ASSERT(session, ref->page == er->page);
 			WT_ASSERT(session, ref->state == WT_REF_EVICTING);
 
-			WT_VERBOSE(session, evictserver,
-			    "forcing eviction of page %p", er->page);
-
-			/*
-			 * At this point, the page is marked with
-			 * WT_REF_EVICTING, which stalls new readers.  Take a
-			 * brief pause before attempting to evict it to give
-			 * existing readers a chance to drop their references.
-			 */
-			__wt_yield();
-
 			/*
-			 * If eviction fails, it will free up the page: hope it
-			 * works next time.  Application threads may be holding
-			 * a reference while trying to get another (e.g., if
-			 * they have two cursors open), so blocking
-			 * indefinitely leads to deadlock.
+			 * If a checkpoint is writing the file, give the page
+			 * back to readers, the page will be requested again
+			 * if it's still too large.
 			 */
-			ret = __wt_rec_evict(session, er->page, 0);
+			if (F_ISSET(er->btree, WT_BTREE_NO_EVICTION)) {
+				ref->state = WT_REF_MEM;
+				ret = 0;
+			} else {
+				WT_VERBOSE(session, evictserver,
+				    "forcing eviction of page %p", er->page);
+
+				/*
+				 * At this point, the page is marked with
+				 * WT_REF_EVICTING, which stalls new readers.
+				 * Take a brief pause before attempting to
+				 * evict it to give existing readers a chance
+				 * to drop their references.
+				 */
+				__wt_yield();
+
+				/*
+				 * If eviction fails, it will free up the page:
+				 * hope it works next time.  Application threads
+				 * may be holding a reference while trying to
+				 * get another (e.g., if they have two cursors
+				 * open), so blocking indefinitely leads to
+				 * deadlock.
+				 */
+				ret = __wt_rec_evict(session, er->page, 0);
+			}
 		} else {
 			/*
 			 * If we're about to do a walk of the file tree (and
@@ -472,6 +967,9 @@ __evict_file(WT_SESSION_IMPL *session, WT_EVICT_REQ *er)
 {
 	WT_PAGE *next_page, *page;
 	WT_REF *ref;
+	int ret;
+
+	ret = 0;
 
 	WT_VERBOSE(session, evictserver,
 	    "file request: %s",
@@ -491,16 +989,24 @@ __evict_file(WT_SESSION_IMPL *session, WT_EVICT_REQ *er)
 	while (F_ISSET(er, WT_EVICT_REQ_CLOSE) && er->btree->lru_count > 0)
 		__wt_yield();
 
+	/*
+	 * If this is a close, no transaction can read the file and any that
+	 * updated it have resolved: reconciliation can write the newest
+	 * committed updates, there are no older readers to keep them from.
+	 */
+	if (F_ISSET(er, WT_EVICT_REQ_CLOSE))
+		F_SET(session, WT_SESSION_EVICT_CLOSE);
+
 	/*
 	 * We can't evict the page just returned to us, it marks our place in
 	 * the tree.  So, always stay one page ahead of the page being returned.
 	 */
 	next_page = NULL;
-	WT_RET(__wt_tree_np(session, &next_page, 1, 1));
+	WT_ERR(__wt_tree_np(session, &next_page, 1, 1));
 	for (;;) {
 		if ((page = next_page) == NULL)
 			break;
-		WT_RET(__wt_tree_np(session, &next_page, 1, 1));
+		WT_ERR(__wt_tree_np(session, &next_page, 1, 1));
 
 		/*
 		 * Close: discarding all of the file's pages from the cache.
@@ -514,11 +1020,19 @@ __evict_file(WT_SESSION_IMPL *session, WT_EVICT_REQ *er)
 		 * dirty because new material was added: reconciling it clears
 		 * the empty flag, and then we evict it.
 		 */
-		if (__wt_page_is_modified(page))
-			WT_RET(__wt_rec_write(session, page, NULL));
+		if (__wt_page_is_modified(page)) {
+			if (!F_ISSET(er, WT_EVICT_REQ_CLOSE))
+				session->write_page = page;
+			ret = __wt_rec_write(session, page, NULL);
+			session->write_page = NULL;
+			WT_ERR(ret);
+		}
 		if (!F_ISSET(er, WT_EVICT_REQ_CLOSE))
 			continue;
 
+		/* If the connection is closing, save the working set. */
+		WT_ERR(__wt_cache_warm_page(session, page));
+
 		/*
 		 * We do not attempt to evict pages expected to be merged into
 		 * their parents, with the single exception that the root page
@@ -527,10 +1041,11 @@ __evict_file(WT_SESSION_IMPL *session, WT_EVICT_REQ *er)
 		if (WT_PAGE_IS_ROOT(page) ||
 		    !F_ISSET(page, WT_PAGE_REC_EMPTY |
 		    WT_PAGE_REC_SPLIT | WT_PAGE_REC_SPLIT_MERGE))
-			WT_RET(__wt_rec_evict(session, page, WT_REC_SINGLE));
+			WT_ERR(__wt_rec_evict(session, page, WT_REC_SINGLE));
 	}
 
-	return (0);
+err:	F_CLR(session, WT_SESSION_EVICT_CLOSE);
+	return (ret);
 }
 
 /*
@@ -541,84 +1056,178 @@ static int
 __evict_lru(WT_SESSION_IMPL *session)
 {
 	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_EVICT_WORKER *worker;
+	u_int i;
 
-	cache = S2C(session)->cache;
+	conn = S2C(session);
+	cache = conn->cache;
 
 	/* Get some more pages to consider for eviction. */
-	WT_RET(__evict_walk(session));
+	WT_RET(__evict_walk(session, WT_EVICT_QUEUE_LRU));
 
-	/* Sort the list into LRU order and restart. */
+	/*
+	 * Restart at the oldest page in the queue.  The server takes a group
+	 * of pages each pass; if there are eviction workers, the queue holds
+	 * a group for each of them.
+	 */
 	__wt_spin_lock(session, &cache->lru_lock);
-	__evict_lru_sort(session);
-
-	cache->evict_current = cache->evict;
+	cache->evict_taken = 0;
+	cache->evict_candidates = WT_EVICT_GROUP / 2;
+	if (cache->eviction_workers != 0)
+		cache->evict_candidates *= cache->eviction_workers;
 	__wt_spin_unlock(session, &cache->lru_lock);
 
-	/* Reconcile and discard some pages. */
-	__evict_pages(session);
+	/*
+	 * Reconcile and discard some pages.  If there are eviction workers,
+	 * wake them up and sleep until they have emptied the queue: the
+	 * timeout covers the queue being emptied by application threads.
+	 */
+	if (cache->eviction_workers == 0) {
+		__evict_pages(session);
+		return (0);
+	}
+	for (i = 0, worker = cache->workers;
+	    i < cache->eviction_workers; ++i, ++worker)
+		__wt_cond_signal(session, worker->cond);
+	while (F_ISSET(conn, WT_SERVER_RUN) && !__evict_queue_empty(cache))
+		__wt_cond_wait_timed(session, cache->evict_worker_cond, 10000);
 
 	return (0);
 }
 
 /*
  * __evict_walk --
- *	Fill in the array by walking the next set of pages.
+ *	Fill in the eviction queue by walking the next set of files.
  */
 static int
-__evict_walk(WT_SESSION_IMPL *session)
+__evict_walk(WT_SESSION_IMPL *session, uint32_t flags)
 {
-	WT_CONNECTION_IMPL *conn;
 	WT_BTREE *btree;
 	WT_CACHE *cache;
-	u_int elem, i;
-	int ret;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t hot_in, hot_out;
+	u_int files;
+	int quota_only, ret;
 
 	conn = S2C(session);
 	cache = S2C(session)->cache;
+	quota_only = 0;
 	ret = 0;
 
-	/*
-	 * We hold a spinlock for the entire walk -- it's slow, but (1) how
-	 * often do new files get added or removed to/from the system, and (2)
-	 * it's all in-memory stuff, so it's not that slow.
-	 */
-	__wt_spin_lock(session, &conn->spinlock);
+	if (cache->evict == NULL) {
+		WT_RET(__wt_calloc_def(
+		    session, WT_EVICT_QUEUE_MAX, &cache->evict));
+		WT_RET(__wt_calloc_def(
+		    session, WT_EVICT_CLEAN_MAX, &cache->clean));
+	}
 
 	/*
-	 * Resize the array in which we're tracking pages, as necessary, then
-	 * get some pages from each underlying file.  In practice, a realloc
-	 * is rarely needed, so it is worth avoiding the LRU lock.
+	 * While too much of the cache is dirty, dirty leaf pages found by the
+	 * walk are queued for the cleaners; otherwise, give the pages in the
+	 * cleaner queue back, they can be evicted.
 	 */
-	elem = WT_EVICT_WALK_BASE + (conn->btqcnt * WT_EVICT_WALK_PER_TABLE);
-	if (elem > cache->evict_entries) {
-		/* Save the offset of the eviction point. */
+	if (__evict_dirty_over(session, cache->eviction_dirty_target))
+		LF_SET(WT_EVICT_QUEUE_CLEAN);
+	else if (cache->clean_count != 0) {
 		__wt_spin_lock(session, &cache->lru_lock);
-		i = (u_int)(cache->evict_current - cache->evict);
-		WT_ERR(__wt_realloc(session, &cache->evict_allocated,
-		    elem * sizeof(WT_EVICT_LIST), &cache->evict));
-		cache->evict_entries = elem;
-		if (cache->evict_current != NULL)
-			cache->evict_current = cache->evict + i;
+		__evict_clr_queue(session, cache->clean, &cache->clean_count);
 		__wt_spin_unlock(session, &cache->lru_lock);
 	}
+	if (!LF_ISSET(WT_EVICT_QUEUE_LRU))
+		goto walk;
 
-	i = WT_EVICT_WALK_BASE;
-	TAILQ_FOREACH(btree, &conn->btqh, q) {
-		/* Reference the correct WT_BTREE handle. */
-		WT_SET_BTREE_IN_SESSION(session, btree);
+	/*
+	 * The scan-resistant policies limit the hot set (the 2Q Am queue, or
+	 * the CLOCK-Pro hot pages) to a fixed share of the pages in the cache,
+	 * until it's reached, only cold pages are evicted.
+	 */
+	hot_in = cache->evict_hot_in;
+	hot_out = cache->evict_hot_out;
+	cache->evict_hot_full = hot_in > hot_out &&
+	    (hot_in - hot_out) * 100 >=
+	    __wt_cache_pages_inuse(cache) * WT_EVICT_HOT_PCT;
 
-		ret = __evict_walk_file(session, &i);
+	/*
+	 * File priorities skew the pages' keys by a percentage of the pages in
+	 * the cache.
+	 */
+	cache->evict_priority_gen = __wt_cache_pages_inuse(cache) / 100;
 
-		WT_CLEAR_BTREE_IN_SESSION(session);
+	/*
+	 * If the cache is below its target, we're only evicting pages of files
+	 * over their quota: empty the eviction queue of other files' pages.
+	 * The cleaner queue is left alone, the cleaners may be working on it.
+	 */
+	quota_only = __wt_cache_bytes_inuse(cache) <
+	    cache->eviction_target * (conn->cache_size / 100);
+
+	/*
+	 * Keep the oldest pages from the last pass, discard the rest, their
+	 * files will be walked again.
+	 */
+	__wt_spin_lock(session, &cache->lru_lock);
+	if (quota_only)
+		__evict_clr_queue(session, cache->evict, &cache->evict_count);
+	else
+		__evict_heap_trim(session);
+	__wt_spin_unlock(session, &cache->lru_lock);
+
+	/*
+	 * Visit files in turn, starting where the last pass stopped, until the
+	 * queue is full or we've visited every file once.  A walk for the
+	 * cleaners only stops when the cleaner queue is full.
+	 */
+walk:	for (files = 0;; ++files) {
+		if (LF_ISSET(WT_EVICT_QUEUE_LRU) ? cache->evict_count +
+		    WT_EVICT_WALK_PER_TABLE > WT_EVICT_QUEUE_MAX :
+		    cache->clean_count >= WT_EVICT_CLEAN_MAX)
+			break;
+
+		/*
+		 * Step to the next file holding the connection spinlock:
+		 * handles are removed from the connection's list under the
+		 * spinlock, and the handle of the last file walked is cleared
+		 * when it's removed.  Pin the file with its LRU count before
+		 * releasing the spinlock, threads closing or checkpointing the
+		 * file, or removing its handle, wait for the count to drain.
+		 */
+		__wt_spin_lock(session, &conn->spinlock);
+		if (files >= conn->btqcnt) {
+			__wt_spin_unlock(session, &conn->spinlock);
+			break;
+		}
+		if ((btree = cache->evict_file) == NULL ||
+		    (btree = TAILQ_NEXT(btree, q)) == NULL)
+			btree = TAILQ_FIRST(&conn->btqh);
+		cache->evict_file = btree;
+		WT_ATOMIC_ADD(btree->lru_count, 1);
+		__wt_spin_unlock(session, &conn->spinlock);
+
+		/*
+		 * Skip files being closed or checkpointed, files holding no
+		 * more than their minimum, and when evicting for quotas, files
+		 * within their quota.  The file's flags are checked after it's
+		 * pinned: threads set them before waiting for the pins.
+		 */
+		if (F_ISSET(btree, WT_BTREE_OPEN) &&
+		    !F_ISSET(btree, WT_BTREE_NO_EVICTION) &&
+		    (btree->cache_min == 0 ||
+		    __wt_btree_bytes_inuse(btree) > btree->cache_min) &&
+		    (!quota_only || __wt_btree_over_quota(btree))) {
+			/* Reference the correct WT_BTREE handle. */
+			WT_SET_BTREE_IN_SESSION(session, btree);
+
+			ret = __evict_walk_file(session, flags);
 
+			WT_CLEAR_BTREE_IN_SESSION(session);
+		}
+
+		WT_ATOMIC_ADD(btree->lru_count, -1);
 		if (ret != 0)
 			break;
 	}
 
-	if (0) {
-err:		__wt_spin_unlock(session, &cache->lru_lock);
-	}
-	__wt_spin_unlock(session, &conn->spinlock);
 	return (ret);
 }
 
@@ -627,28 +1236,34 @@ err:		__wt_spin_unlock(session, &cache->lru_lock);
  *	Get a few page eviction candidates from a single underlying file.
  */
 static int
-__evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp)
+__evict_walk_file(WT_SESSION_IMPL *session, uint32_t flags)
 {
 	WT_BTREE *btree;
 	WT_CACHE *cache;
-	WT_EVICT_LIST *end, *evict, *start;
+	WT_EVICT_LIST evict, *heap;
 	WT_PAGE *page;
-	int restarts, ret;
+	uint64_t oldest;
+	uint32_t *countp;
+	u_int slots, visited;
+	int candidate, restarts, ret;
 
 	btree = session->btree;
 	cache = S2C(session)->cache;
-	start = cache->evict + *slotp;
-	end = start + WT_EVICT_WALK_PER_TABLE;
+	oldest = __wt_txn_oldest(session);
 
 	/*
 	 * Get the next WT_EVICT_WALK_PER_TABLE entries.
 	 *
 	 * We can't evict the page just returned to us, it marks our place in
 	 * the tree.  So, always stay one page ahead of the page being returned.
+	 * A walk for the cleaners may find few dirty pages, it gives up after
+	 * visiting a fixed number of pages.
 	 */
-	for (evict = start, restarts = ret = 0;
-	    evict < end && restarts <= 1 && ret == 0;
+	for (slots = visited = restarts = ret = 0;
+	    slots < WT_EVICT_WALK_PER_TABLE && restarts <= 1 && ret == 0 &&
+	    (LF_ISSET(WT_EVICT_QUEUE_LRU) || visited < WT_EVICT_CLEAN_WALK);
 	    ret = __wt_tree_np(session, &btree->evict_page, 1, 1)) {
+		++visited;
 		if ((page = btree->evict_page) == NULL) {
 			++restarts;
 			continue;
@@ -668,52 +1283,62 @@ __evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp)
 		    F_ISSET(page, WT_PAGE_EVICT_LRU | WT_PAGE_REC_SPLIT_MERGE))
 			continue;
 
+		/*
+		 * Skip dirty pages whose last write skipped updates a running
+		 * transaction can't see, until that transaction resolves:
+		 * they can't be cleaned or evicted, writing them again would
+		 * only skip the same updates.
+		 */
+		if (page->modify != NULL &&
+		    page->modify->rec_oldest == oldest &&
+		    __wt_page_is_modified(page))
+			continue;
+
+		/*
+		 * Let the replacement policy decide if the page is a candidate
+		 * for eviction.  Dirty leaf pages go to the cleaners instead,
+		 * while there's room: once written, a later walk finds them
+		 * clean.  Internal pages are written when their children are
+		 * evicted, leave them alone.
+		 */
+		candidate = LF_ISSET(WT_EVICT_QUEUE_LRU) &&
+		    __evict_visit(cache, page);
+		if (LF_ISSET(WT_EVICT_QUEUE_CLEAN) &&
+		    cache->clean_count < WT_EVICT_CLEAN_MAX &&
+		    page->type != WT_PAGE_COL_INT &&
+		    page->type != WT_PAGE_ROW_INT &&
+		    __wt_page_is_modified(page)) {
+			heap = cache->clean;
+			countp = &cache->clean_count;
+		} else if (candidate) {
+			heap = cache->evict;
+			countp = &cache->evict_count;
+		} else
+			continue;
+
 		WT_VERBOSE(session, evictserver,
 		    "select: %p, size %" PRIu32, page, page->memory_footprint);
 
 		WT_ASSERT(session, page->ref->state == WT_REF_EVICT_WALK);
 
-		/* Mark the page on the list */
+		/*
+		 * Mark the page on the list, and add it to the queue.  This
+		 * is done holding the LRU lock: another thread evicting the
+		 * page's parent must find it in the queue to clear it.
+		 */
+		evict.page = page;
+		evict.btree = btree;
+		evict.read_gen = __evict_key(cache, btree, page);
+		__wt_spin_lock(session, &cache->lru_lock);
 		F_SET(page, WT_PAGE_EVICT_LRU);
-
-		__evict_clr(session, evict);
-		evict->page = page;
-		evict->btree = btree;
-		++evict;
+		__evict_heap_push(heap, countp, &evict);
+		__wt_spin_unlock(session, &cache->lru_lock);
+		++slots;
 	}
 
-	*slotp += (u_int)(evict - start);
 	return (ret);
 }
 
-/*
- * __evict_lru_sort --
- *	Sort the list of pages queued for eviction into LRU order.
- */
-static void
-__evict_lru_sort(WT_SESSION_IMPL *session)
-{
-	WT_CACHE *cache;
-
-	/*
-	 * We have an array of page eviction references that may contain NULLs,
-	 * as well as duplicate entries.
-	 *
-	 * First, sort the array by WT_REF address, then delete any duplicates.
-	 * The reason is because we might evict the page but leave a duplicate
-	 * entry in the "saved" area of the array, and that would be a NULL
-	 * dereference on the next run.  (If someone ever tries to remove this
-	 * duplicate cleanup for better performance, you can't fix it just by
-	 * checking the WT_REF state -- that only works if you are discarding
-	 * a page from a single level of the tree; if you are discarding a
-	 * page and its parent, the duplicate of the page's WT_REF might have
-	 * been free'd before a subsequent review of the eviction array.)
-	 */
-	cache = S2C(session)->cache;
-	qsort(cache->evict,
-	    cache->evict_entries, sizeof(WT_EVICT_LIST), __evict_lru_cmp);
-}
-
 /*
  * __evict_get_page --
  *	Get a page for eviction.
@@ -723,15 +1348,21 @@ __evict_get_page(
     WT_SESSION_IMPL *session, int is_app, WT_BTREE **btreep, WT_PAGE **pagep)
 {
 	WT_CACHE *cache;
-	WT_EVICT_LIST *evict;
+	WT_EVICT_LIST evict;
 	WT_REF *ref;
-	int candidates;
+	uint32_t candidates;
 
 	cache = S2C(session)->cache;
 	*btreep = NULL;
 	*pagep = NULL;
 
-	candidates = (is_app ? WT_EVICT_GROUP : WT_EVICT_GROUP / 2);
+	/*
+	 * Application threads can take more pages than the eviction threads,
+	 * they only evict pages when the eviction threads can't keep up.
+	 */
+	candidates = cache->evict_candidates;
+	if (is_app)
+		candidates += WT_EVICT_GROUP / 2;
 
 	/*
 	 * Avoid the LRU lock if no pages are available.  If there are pages
@@ -741,22 +1372,32 @@ __evict_get_page(
 	 * server.
 	 */
 	for (;;) {
-		if (cache->evict_current == NULL ||
-		    cache->evict_current >= cache->evict + candidates)
+		if (cache->evict_count == 0 ||
+		    cache->evict_taken >= candidates)
 			return;
 		if (__wt_spin_trylock(session, &cache->lru_lock) == 0)
 			break;
 		__wt_yield();
 	}
 
-	/* Get the next page queued for eviction. */
-	while ((evict = cache->evict_current) != NULL &&
-	    evict >= cache->evict && evict < cache->evict + candidates &&
-	    evict->page != NULL) {
-		WT_ASSERT(session, evict->btree != NULL);
+	/* Get the oldest page queued for eviction. */
+	while (cache->evict_count > 0 && cache->evict_taken < candidates) {
+		/*
+		 * Remove the entry so we never try and reconcile the same page
+		 * on reconciliation error.  Skip entries cleared since they
+		 * were queued.
+		 */
+		__evict_heap_pop(cache->evict, &cache->evict_count, &evict);
+		if (evict.page == NULL)
+			continue;
+		WT_ASSERT(session, evict.btree != NULL);
 
-		/* Move to the next item. */
-		++cache->evict_current;
+		/* A checkpoint is writing the file: leave its pages alone. */
+		if (F_ISSET(evict.btree, WT_BTREE_NO_EVICTION)) {
+			__evict_clr(session, &evict);
+			continue;
+		}
+		++cache->evict_taken;
 
 		/*
 		 * Switch the page state to evicting while holding the eviction
@@ -765,42 +1406,54 @@ __evict_get_page(
 		 * request queue for forced eviction, this operation will fail
 		 * and we will move on.
 		 */
-		ref = evict->page->ref;
-		if (!WT_ATOMIC_CAS(ref->state, WT_REF_MEM, WT_REF_EVICTING))
+		ref = evict.page->ref;
+		if (!WT_ATOMIC_CAS(ref->state, WT_REF_MEM, WT_REF_EVICTING)) {
+			__evict_clr(session, &evict);
 			continue;
+		}
 
 		/*
 		 * Increment the LRU count in the btree handle to prevent it
 		 * from being closed under us.
 		 */
-		WT_ATOMIC_ADD(evict->btree->lru_count, 1);
-
-		*btreep = evict->btree;
-		*pagep = evict->page;
+		WT_ATOMIC_ADD(evict.btree->lru_count, 1);
 
-		/*
-		 * Remove the entry so we never try and reconcile the same page
-		 * on reconciliation error.
-		 */
-		__evict_clr(session, evict);
+		*btreep = evict.btree;
+		*pagep = evict.page;
+		__evict_clr(session, &evict);
 		break;
 	}
 
 	if (is_app && *pagep == NULL)
-		cache->evict_current = NULL;
+		cache->evict_taken = candidates;
 	__wt_spin_unlock(session, &cache->lru_lock);
 }
 
 /*
  * __wt_evict_lru_page --
- *	Called by both eviction and application threads to evict a page.
+ *	Called by both eviction and application threads to evict a page,
+ * returning if a page was actually evicted.
  */
 int
-__wt_evict_lru_page(WT_SESSION_IMPL *session, int is_app)
+__wt_evict_lru_page(WT_SESSION_IMPL *session, int is_app, int *evictedp)
+{
+	return (__evict_lru_page(session, is_app, evictedp));
+}
+
+/*
+ * __evict_lru_page --
+ *	Evict a page from the eviction queue, returning if it was evicted.
+ */
+static int
+__evict_lru_page(WT_SESSION_IMPL *session, int is_app, int *evictedp)
 {
 	WT_BTREE *btree, *saved_btree;
+	WT_CACHE *cache;
 	WT_PAGE *page;
 
+	cache = S2C(session)->cache;
+	*evictedp = 0;
+
 	__evict_get_page(session, is_app, &btree, &page);
 	if (page == NULL)
 		return (WT_NOTFOUND);
@@ -822,10 +1475,14 @@ __wt_evict_lru_page(WT_SESSION_IMPL *session, int is_app)
 	 * at it.
 	 */
 	page->read_gen = __wt_cache_read_gen(session);
-	(void)__wt_rec_evict(session, page, 0);
+	*evictedp = __wt_rec_evict(session, page, 0) == 0;
 
 	WT_ATOMIC_ADD(btree->lru_count, -1);
 
+	/* Wake a thread waiting for space in the cache. */
+	if (*evictedp && cache->evict_waiters != 0)
+		__wt_cond_signal(session, cache->evict_waiter_cond);
+
 	WT_CLEAR_BTREE_IN_SESSION(session);
 	session->btree = saved_btree;
 
@@ -833,54 +1490,188 @@ __wt_evict_lru_page(WT_SESSION_IMPL *session, int is_app)
 }
 
 /*
- * __evict_page --
- *	Reconcile and discard cache pages.
+ * __evict_dirty_over --
+ *	Return if the cache's dirty bytes are over a percentage of the cache.
  */
-static void
-__evict_pages(WT_SESSION_IMPL *session)
+static int
+__evict_dirty_over(WT_SESSION_IMPL *session, u_int pct)
 {
-	while (__wt_evict_lru_page(session, 0) == 0)
-		;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+	return (__wt_cache_bytes_dirty(conn->cache) >
+	    pct * (conn->cache_size / 100) ? 1 : 0);
 }
 
 /*
- * __evict_lru_cmp --
- *	Qsort function: sort WT_EVICT_LIST array based on the page's read
- *	generation.
+ * __evict_dirty --
+ *	Queue dirty pages for the cleaner threads, if the cache is over its
+ * dirty target.
  */
 static int
-__evict_lru_cmp(const void *a, const void *b)
+__evict_dirty(WT_SESSION_IMPL *session)
 {
-	WT_PAGE *a_page, *b_page;
-	uint64_t a_lru, b_lru;
+	WT_CACHE *cache;
+	u_int cleaned;
 
-	/*
-	 * There may be NULL references in the array; sort them as greater than
-	 * anything else so they migrate to the end of the array.
-	 */
-	a_page = ((WT_EVICT_LIST *)a)->page;
-	b_page = ((WT_EVICT_LIST *)b)->page;
-	if (a_page == NULL)
-		return (b_page == NULL ? 0 : 1);
-	if (b_page == NULL)
-		return (-1);
+	cache = S2C(session)->cache;
 
-	/* Sort the LRU in ascending order. */
-	a_lru = a_page->read_gen;
-	b_lru = b_page->read_gen;
+	if (cache->evict_lru_stop ||
+	    !__evict_dirty_over(session, cache->eviction_dirty_target))
+		return (0);
 
 	/*
-	 * Bias in favor of leaf pages.  Otherwise, we can waste time
-	 * considering parent pages for eviction while their child pages are
-	 * still in memory.
-	 *
-	 * Bump the LRU generation by a small fixed amount: the idea being that
-	 * if we have enough good leaf page candidates, we should evict them
-	 * first, but not completely ignore an old internal page.
+	 * Dirty pages are queued for the cleaners by the eviction walk: walk
+	 * the files for more only once they've taken most of the queue, and
+	 * then only for dirty pages, the eviction queue is left alone.  If
+	 * there are no cleaner threads, write the pages in this thread.
 	 */
-	if (a_page->type == WT_PAGE_ROW_INT || a_page->type == WT_PAGE_COL_INT)
-		a_lru += WT_EVICT_GROUP;
-	if (b_page->type == WT_PAGE_ROW_INT || b_page->type == WT_PAGE_COL_INT)
-		b_lru += WT_EVICT_GROUP;
-	return (a_lru > b_lru ? 1 : (a_lru < b_lru ? -1 : 0));
+	if (cache->clean_count < WT_EVICT_CLEAN_MAX / 2)
+		WT_RET(__evict_walk(session, WT_EVICT_QUEUE_CLEAN));
+	if (cache->eviction_cleaners == 0)
+		return (__evict_clean(session, &cleaned));
+	__wt_cond_signal(session, cache->clean_cond);
+	return (0);
+}
+
+/*
+ * __evict_clean --
+ *	Write dirty pages from the cleaner queue until the cache is below its
+ * dirty target, returning the number of pages written.
+ */
+static int
+__evict_clean(WT_SESSION_IMPL *session, u_int *cleanedp)
+{
+	WT_BTREE *btree, *saved_btree;
+	WT_CACHE *cache;
+	WT_PAGE *page;
+	int ret;
+
+	cache = S2C(session)->cache;
+	*cleanedp = 0;
+
+	while (__evict_dirty_over(session, cache->eviction_dirty_target)) {
+		__evict_get_dirty(session, &btree, &page);
+		if (page == NULL)
+			break;
+
+		/* If there may be more dirty pages, share the work. */
+		if (cache->eviction_cleaners > 1)
+			__wt_cond_signal(session, cache->clean_cond);
+
+		saved_btree = session->btree;
+		WT_SET_BTREE_IN_SESSION(session, btree);
+
+		/*
+		 * Write the page the way a checkpoint does, leaving it in
+		 * memory: it stays in the cache, and once clean, eviction can
+		 * discard it without writing it.  As with eviction, a failure
+		 * isn't fatal, the page is still dirty and will be written
+		 * again, as it is if a queued write of the page fails.
+		 */
+		session->write_page = page;
+		ret = __wt_rec_write(session, page, NULL);
+		session->write_page = NULL;
+
+		/* The page can be queued again. */
+		__wt_spin_lock(session, &cache->lru_lock);
+		F_CLR(page, WT_PAGE_EVICT_LRU);
+		__wt_spin_unlock(session, &cache->lru_lock);
+		__wt_hazard_clear(session, page);
+		WT_ATOMIC_ADD(btree->lru_count, -1);
+
+		WT_CLEAR_BTREE_IN_SESSION(session);
+		session->btree = saved_btree;
+
+		if (ret == 0) {
+			++*cleanedp;
+			WT_CSTAT_INCR(session, cache_clean_pages);
+		} else {
+			/*
+			 * A busy page is expected, the write is retried when
+			 * the page is queued again; report anything else.
+			 */
+			WT_CSTAT_INCR(session, cache_clean_fail);
+			if (ret == EBUSY)
+				WT_VERBOSE(session, evictserver,
+				    "clean: page %p: %s",
+				    page, wiredtiger_strerror(ret));
+			else
+				__wt_err(session, ret,
+				    "cache cleaner: page %p write", page);
+		}
+	}
+	return (0);
+}
+
+/*
+ * __evict_get_dirty --
+ *	Get the oldest dirty page from the cleaner queue, to be written without
+ * discarding it.
+ */
+static void
+__evict_get_dirty(
+    WT_SESSION_IMPL *session, WT_BTREE **btreep, WT_PAGE **pagep)
+{
+	WT_CACHE *cache;
+	WT_EVICT_LIST evict;
+	WT_PAGE *page;
+
+	cache = S2C(session)->cache;
+	*btreep = NULL;
+	*pagep = NULL;
+
+	if (cache->clean_count == 0)
+		return;
+
+	__wt_spin_lock(session, &cache->lru_lock);
+	while (cache->clean_count > 0) {
+		__evict_heap_pop(cache->clean, &cache->clean_count, &evict);
+		if ((page = evict.page) == NULL)
+			continue;
+
+		/* A checkpoint is writing the file: leave its pages alone. */
+		if (F_ISSET(evict.btree, WT_BTREE_NO_EVICTION) ||
+		    !__wt_page_is_modified(page)) {
+			__evict_clr(session, &evict);
+			continue;
+		}
+
+		/*
+		 * Take a hazard reference, as a reader would: eviction can't
+		 * discard or reconcile the page while we write it, readers and
+		 * writers carry on.  If the page is being evicted, give up on
+		 * it.  The page stays marked as queued until it's written, so
+		 * no other cleaner chooses it, and the LRU count makes a
+		 * checkpoint or close of the file wait for the write.
+		 */
+		if (__wt_hazard_set(session, page->ref
+#ifdef HAVE_DIAGNOSTIC
+		    , __FILE__, __LINE__
+#endif
+		    ) != 0) {
+			__evict_clr(session, &evict);
+			continue;
+		}
+		WT_ATOMIC_ADD(evict.btree->lru_count, 1);
+		*btreep = evict.btree;
+		*pagep = page;
+		break;
+	}
+	__wt_spin_unlock(session, &cache->lru_lock);
+}
+
+/*
+ * __evict_pages --
+ *	Reconcile and discard cache pages.
+ */
+static void
+__evict_pages(WT_SESSION_IMPL *session)
+{
+	int evicted, ret;
+
+	while ((ret = __evict_lru_page(session, 0, &evicted)) == 0)
+		;
+	if (ret != WT_NOTFOUND && ret != EBUSY)
+		__wt_err(session, ret, "eviction server: page eviction");
 }
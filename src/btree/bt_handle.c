@@ -7,6 +7,7 @@
 
 #include "wt_internal.h"
 
+static int __btree_cache_conf(WT_SESSION_IMPL *, const char *);
 static int __btree_conf(WT_SESSION_IMPL *, uint32_t);
 static int __btree_get_last_recno(WT_SESSION_IMPL *);
 static int __btree_page_sizes(WT_SESSION_IMPL *, const char *);
@@ -78,25 +79,42 @@ __wt_btree_close(WT_SESSION_IMPL *session)
 	btree = session->btree;
 	ret = 0;
 
-	/* Clear any cache. */
+	/*
+	 * Clear any cache, once the read-ahead threads have read the pages
+	 * queued for them.
+	 */
+	while (btree->read_ahead_pending > 0)
+		__wt_cond_wait_timed(
+		    session, S2C(session)->cache->read_done_cond, 10000);
 	if (btree->root_page != NULL)
 		WT_TRET(__wt_evict_file_serial(session, 1));
 	WT_ASSERT(session, btree->root_page == NULL);
 
+	/* The file no longer holds any of the cache, it's within its quota. */
+	if (WT_ATOMIC_CAS(btree->quota_over, 1, 0))
+		WT_ATOMIC_ADD(S2C(session)->cache->quota_over, -1);
+
 	/* After all pages are evicted, update the root's address. */
 	if (btree->root_update) {
 		/*
 		 * Release the original blocks held by the root, that is,
-		 * the blocks listed in the schema file.
+		 * the blocks listed in the schema file.  If a checkpoint set
+		 * the root address, the checkpoint released the original
+		 * blocks, and the root's blocks are released when the root
+		 * page is written again.
 		 */
-		WT_RET(__wt_btree_free_root(session));
+		if (!btree->root_ckpt)
+			WT_RET(__wt_btree_free_root(session));
 
 		WT_RET(__wt_btree_set_root(session, btree->filename,
-		    btree->root_addr.addr, btree->root_addr.size));
+		    btree->root_addr.addr, btree->root_addr.size, NULL));
 		if (btree->root_addr.addr != NULL)
 			__wt_free(session, btree->root_addr.addr);
 		btree->root_update = 0;
 	}
+	btree->root_ckpt = 0;
+	__wt_free(session, btree->ckpt_addr.addr);
+	btree->ckpt_addr.size = 0;
 
 	/* Close the underlying block manager reference. */
 	WT_TRET(__wt_bm_close(session));
@@ -127,7 +145,7 @@ __btree_conf(WT_SESSION_IMPL *session, uint32_t flags)
 	WT_CONNECTION_IMPL *conn;
 	WT_NAMED_COLLATOR *ncoll;
 	uint32_t bitcnt;
-	int fixed;
+	int fixed, ret;
 	const char *config;
 
 	btree = session->btree;
@@ -180,13 +198,23 @@ __btree_conf(WT_SESSION_IMPL *session, uint32_t flags)
 		}
 	}
 
+	/* Log records identify the file by ID, older files don't have one. */
+	if ((ret = __wt_config_getones(session, config, "id", &cval)) == 0)
+		btree->id = (uint32_t)cval.val;
+	else if (ret != WT_NOTFOUND)
+		return (ret);
+
+	/* Cache priority and quotas, older files don't have them. */
+	WT_RET(__btree_cache_conf(session, config));
+
 	/* Page sizes */
 	WT_RET(__btree_page_sizes(session, config));
 
 	/* Huffman encoding */
 	WT_RET(__wt_btree_huffman_open(session, config));
 
-	WT_RET(__wt_stat_alloc_btree_stats(session, &btree->stats));
+	WT_RET(__wt_stat_alloc_btree_stats(
+	    session, WT_STAT_SLOTS, &btree->stats));
 
 	/* Take the config string: it will be freed with the btree handle. */
 	btree->config = config;
@@ -329,7 +357,7 @@ __btree_root_init_empty(WT_SESSION_IMPL *session)
 		ref->addr = NULL;
 		ref->state = WT_REF_MEM;
 		WT_ERR(__wt_row_ikey_alloc(
-		    session, 0, "", 1, (WT_IKEY **)&(ref->u.key)));
+		    session, root, 0, "", 1, (WT_IKEY **)&(ref->u.key)));
 		break;
 	WT_ILLEGAL_VALUE(session);
 	}
@@ -347,7 +375,7 @@ __btree_root_init_empty(WT_SESSION_IMPL *session)
 	 * up sane.
 	 */
 	WT_ERR(__wt_page_modify_init(session, leaf));
-	__wt_page_modify_set(leaf);
+	__wt_page_modify_set(session, leaf);
 
 	return (0);
 
@@ -405,6 +433,41 @@ __btree_get_last_recno(WT_SESSION_IMPL *session)
 	return (0);
 }
 
+/*
+ * __btree_cache_conf --
+ *	Configure the file's cache priority and quotas.
+ */
+static int
+__btree_cache_conf(WT_SESSION_IMPL *session, const char *config)
+{
+	WT_BTREE *btree;
+	WT_CONFIG_ITEM cval;
+	int ret;
+
+	btree = session->btree;
+
+	if ((ret = __wt_config_getones(
+	    session, config, "cache_priority", &cval)) == 0)
+		btree->cache_priority = (int)cval.val;
+	else if (ret != WT_NOTFOUND)
+		return (ret);
+	if ((ret = __wt_config_getones(
+	    session, config, "cache_min", &cval)) == 0)
+		btree->cache_min = (uint64_t)cval.val;
+	else if (ret != WT_NOTFOUND)
+		return (ret);
+	if ((ret = __wt_config_getones(
+	    session, config, "cache_max", &cval)) == 0)
+		btree->cache_max = (uint64_t)cval.val;
+	else if (ret != WT_NOTFOUND)
+		return (ret);
+
+	if (btree->cache_max != 0 && btree->cache_min > btree->cache_max)
+		WT_RET_MSG(session, EINVAL,
+		    "cache_min must not be larger than cache_max");
+	return (0);
+}
+
 /*
  * __btree_page_sizes --
  *	Verify the page sizes.
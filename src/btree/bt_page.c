@@ -12,6 +12,8 @@ static int  __inmem_col_int(WT_SESSION_IMPL *, WT_PAGE *, size_t *);
 static int  __inmem_col_var(WT_SESSION_IMPL *, WT_PAGE *, size_t *);
 static int  __inmem_row_int(WT_SESSION_IMPL *, WT_PAGE *, size_t *);
 static int  __inmem_row_leaf(WT_SESSION_IMPL *, WT_PAGE *, size_t *);
+static void __page_in_stall(WT_SESSION_IMPL *, time_t, long, int);
+static int  __page_in_wait(WT_SESSION_IMPL *, int, int *);
 
 /*
  * __wt_page_in --
@@ -26,7 +28,14 @@ __wt_page_in_func(
 #endif
     )
 {
-	int wake, read_lockout;
+	time_t stall_secs;
+	long stall_nsecs;
+	u_int debt;
+	int ckpt_stall, evicted, read_lockout, readpage, wake;
+
+	stall_secs = 0;
+	stall_nsecs = 0;
+	ckpt_stall = 0;
 
 	/*
 	 * Only wake the eviction server the first time through here (if the
@@ -34,8 +43,10 @@ __wt_page_in_func(
 	 * are just wasting effort and making a busy mutex busier.
 	 */
 	wake = 1;
+	readpage = 0;
 
 	for (;;) {
+		read_lockout = 0;
 		switch (ref->state) {
 		case WT_REF_DISK:
 			/*
@@ -44,12 +55,35 @@ __wt_page_in_func(
 			 */
 			__wt_eviction_check(session, &read_lockout, wake);
 			wake = 0;
+			if (read_lockout)
+				break;
 
-			if (read_lockout || !WT_ATOMIC_CAS(ref->state,
+			/*
+			 * If the cache is over its eviction target, pay for the
+			 * page by evicting pages first.  If there's nothing to
+			 * evict, the eviction server is behind: read anyway,
+			 * the cache isn't full.  Only pages actually evicted
+			 * pay down the debt, the loop ends when the queue is
+			 * empty.
+			 */
+			for (debt = __wt_eviction_debt(session); debt > 0;) {
+				if (__wt_evict_lru_page(
+				    session, 1, &evicted) != 0) {
+					wake = 1;
+					break;
+				}
+				if (evicted) {
+					WT_CSTAT_INCR(session, cache_evict_app);
+					--debt;
+				}
+			}
+
+			if (!WT_ATOMIC_CAS(ref->state,
 			    WT_REF_DISK, WT_REF_READING))
 				break;
 
-			WT_RET(__wt_cache_read(session, parent, ref));
+			WT_RET(__wt_cache_read(session, parent, ref, 0));
+			readpage = 1;
 			continue;
 		case WT_REF_EVICTING:
 		case WT_REF_LOCKED:
@@ -66,6 +100,12 @@ __wt_page_in_func(
 			 * the page's LRU and return.  The expected reason we
 			 * can't get a hazard reference is because the page is
 			 * being evicted; yield and try again.
+			 *
+			 * Don't update the LRU if we just read the page, it was
+			 * set when the page was built: the replacement policies
+			 * need to distinguish pages read and never accessed
+			 * again (for example, by a scan), from pages accessed
+			 * repeatedly.
 			 */
 			if (__wt_hazard_set(session, ref
 #ifdef HAVE_DIAGNOSTIC
@@ -73,22 +113,104 @@ __wt_page_in_func(
 #endif
 			    ) == 0) {
 				WT_ASSERT(session, !WT_PAGE_IS_ROOT(ref->page));
-				ref->page->read_gen =
-				    __wt_cache_read_gen(session);
+				if (!readpage)
+					ref->page->read_gen =
+					    __wt_cache_read_gen(session);
+				if (stall_secs != 0)
+					__page_in_stall(session, stall_secs,
+					    stall_nsecs, ckpt_stall);
 				return (0);
 			}
 			break;
 		WT_ILLEGAL_VALUE(session);
 		}
 
-		/*
-		 * Find a page to evict -- if that fails, we don't care why,
-		 * but we may need to wake the eviction server again if the
-		 * cache is still full.
-		 */
-		if (__wt_evict_lru_page(session, 1) != 0)
-			wake = 1;
+		/* Time the wait, noting if a checkpoint is running. */
+		if (stall_secs == 0) {
+			WT_RET(__wt_epoch(session, &stall_secs, &stall_nsecs));
+			ckpt_stall = S2C(session)->ckpt_running;
+		}
+
+		WT_RET(__page_in_wait(session, read_lockout, &wake));
+	}
+}
+
+/*
+ * __page_in_wait --
+ *	Wait for a page that's busy, or for space in a full cache.
+ */
+static int
+__page_in_wait(WT_SESSION_IMPL *session, int read_lockout, int *wakep)
+{
+	WT_CACHE *cache;
+	int evicted;
+
+	cache = S2C(session)->cache;
+
+	/*
+	 * The page is being read or evicted by another thread: that won't take
+	 * long, yield.
+	 */
+	if (!read_lockout) {
+		__wt_yield();
+		return (0);
 	}
+
+	/*
+	 * The cache is full: evict a page.  If there's nothing to evict, wake
+	 * the eviction server the next time we check, and sleep until it, or
+	 * another thread, evicts a page: spinning takes processor time from
+	 * the threads evicting pages.
+	 */
+	if (__wt_evict_lru_page(session, 1, &evicted) == 0) {
+		if (evicted)
+			WT_CSTAT_INCR(session, cache_evict_app);
+		return (0);
+	}
+	*wakep = 1;
+
+	WT_CSTAT_INCR(session, cache_evict_app_wait);
+	(void)WT_ATOMIC_ADD(cache->evict_waiters, 1);
+	__wt_cond_wait_timed(session, cache->evict_waiter_cond, 10000);
+	(void)WT_ATOMIC_ADD(cache->evict_waiters, -1);
+
+	/*
+	 * Threads wake one at a time: if there's room in the cache, pass the
+	 * wakeup on.
+	 */
+	if (cache->evict_waiters != 0 &&
+	    __wt_cache_bytes_inuse(cache) <= S2C(session)->cache_size)
+		__wt_cond_signal(session, cache->evict_waiter_cond);
+	return (0);
+}
+
+/*
+ * __page_in_stall --
+ *	Record how long a thread waited for a page.
+ */
+static void
+__page_in_stall(WT_SESSION_IMPL *session, time_t secs, long nsecs, int ckpt)
+{
+	time_t stop_secs;
+	long stop_nsecs;
+	uint64_t usecs;
+
+	if (__wt_epoch(session, &stop_secs, &stop_nsecs) != 0)
+		return;
+	usecs = (uint64_t)((stop_secs - secs) * WT_MILLION +
+	    (stop_nsecs - nsecs) / 1000);
+
+	if (usecs < 1000)
+		WT_CSTAT_INCR(session, cache_stall_lt1ms);
+	else if (usecs < 10000)
+		WT_CSTAT_INCR(session, cache_stall_lt10ms);
+	else if (usecs < 100000)
+		WT_CSTAT_INCR(session, cache_stall_lt100ms);
+	else
+		WT_CSTAT_INCR(session, cache_stall_ge100ms);
+
+	if (ckpt)
+		__wt_checkpoint_stall(session, usecs);
 }
 
 /*
@@ -123,6 +245,8 @@ __wt_page_inmem(WT_SESSION_IMPL *session,
 	 * write generation wasn't set, that is, remained 0).
 	 */
 	page->read_gen = __wt_cache_read_gen(session);
+	page->evict_gen = page->read_gen;
+	page->evict_state = WT_EVICT_STATE_TEST;
 
 	switch (page->type) {
 	case WT_PAGE_COL_FIX:
@@ -149,7 +273,16 @@ __wt_page_inmem(WT_SESSION_IMPL *session,
 	*pagep = page;
 	return (0);
 
-err:	__wt_free(session, page);
+err:	/*
+	 * Free any keys instantiated in the page's arena.  The page was never
+	 * counted as read into the cache, only the arena's bytes: don't count
+	 * it as evicted.
+	 */
+	if (page->memory_footprint != 0)
+		__wt_cache_page_inmem_decr(
+		    session, page, page->memory_footprint);
+	__wt_page_arena_discard(session, page);
+	__wt_free(session, page);
 	return (ret);
 }
 
@@ -397,11 +530,9 @@ __inmem_row_int(WT_SESSION_IMPL *session, WT_PAGE *page, size_t *inmem_sizep)
 		/*
 		 * Allocate and initialize the instantiated key.
 		 */
-		WT_ERR(__wt_row_ikey_alloc(session,
+		WT_ERR(__wt_row_ikey_alloc(session, page,
 		    WT_PAGE_DISK_OFFSET(page, cell),
 		    current->data, current->size, (WT_IKEY **)&ref->u.key));
-		if (inmem_sizep != NULL)
-			*inmem_sizep += sizeof(WT_IKEY) + current->size;
 
 		/*
 		 * Swap buffers if it's not an overflow key, we have a new
@@ -7,12 +7,15 @@
 
 #include "wt_internal.h"
 
+static int __read_next(WT_SESSION_IMPL *, WT_CACHE *, WT_READ_REQ *);
+
 /*
  * __wt_cache_read --
  *	Read a page from the file.
  */
 int
-__wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
+__wt_cache_read(
+    WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref, int read_ahead)
 {
 	WT_ITEM tmp;
 	WT_PAGE *page;
@@ -46,6 +49,7 @@ __wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
 	    "page %p, %s", page, __wt_page_type_string(page->type));
 
 	WT_ASSERT(session, page != NULL);
+	page->read_ahead = read_ahead ? 1 : 0;
 	ref->page = page;
 	WT_PUBLISH(ref->state, WT_REF_MEM);
 	return (0);
@@ -54,3 +58,157 @@ err:	ref->state = WT_REF_DISK;
 	__wt_buf_free(session, &tmp);
 	return (ret);
 }
+
+/*
+ * __wt_cache_read_ahead --
+ *	Queue reads of the pages following a leaf page in a cursor scan.
+ */
+int
+__wt_cache_read_ahead(WT_SESSION_IMPL *session, WT_PAGE *page, int next)
+{
+	WT_BTREE *btree;
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_PAGE *parent;
+	WT_READ_REQ *req;
+	WT_REF *ref;
+	uint32_t i, queued, slot;
+
+	btree = session->btree;
+	conn = S2C(session);
+	cache = conn->cache;
+
+	if (WT_PAGE_IS_ROOT(page))
+		return (0);
+
+	/* Don't push pages out of a cache that's already being evicted. */
+	if (__wt_cache_bytes_inuse(cache) >
+	    cache->eviction_trigger * (conn->cache_size / 100))
+		return (0);
+
+	/*
+	 * The pages are the siblings of the current page: the cursor holds a
+	 * hazard reference on the current page, so the parent can't be evicted
+	 * while we look at it, and once a page is marked for reading, it can't
+	 * be evicted until the read is done.
+	 */
+	parent = page->parent;
+	slot = (uint32_t)(page->ref - parent->u.intl.t);
+	queued = 0;
+	for (i = 1; i <= cache->read_ahead; ++i) {
+		if (next) {
+			if (slot + i >= parent->entries)
+				break;
+			ref = &parent->u.intl.t[slot + i];
+		} else {
+			if (slot < i)
+				break;
+			ref = &parent->u.intl.t[slot - i];
+		}
+		if (ref->state != WT_REF_DISK ||
+		    !WT_ATOMIC_CAS(ref->state, WT_REF_DISK, WT_REF_READING))
+			continue;
+
+		__wt_spin_lock(session, &cache->read_lock);
+		if (cache->read_queue_count == cache->read_queue_max) {
+			__wt_spin_unlock(session, &cache->read_lock);
+			WT_PUBLISH(ref->state, WT_REF_DISK);
+			break;
+		}
+		req = &cache->read_queue[(cache->read_queue_head +
+		    cache->read_queue_count) % cache->read_queue_max];
+		req->btree = btree;
+		req->parent = parent;
+		req->ref = ref;
+		++cache->read_queue_count;
+		(void)WT_ATOMIC_ADD(btree->read_ahead_pending, 1);
+		__wt_spin_unlock(session, &cache->read_lock);
+		++queued;
+	}
+
+	if (queued != 0) {
+		WT_CSTAT_INCRV(session, read_ahead_queued, queued);
+		__wt_cond_signal(session, cache->read_cond);
+	}
+	return (0);
+}
+
+/*
+ * __wt_cache_read_server --
+ *	Thread reading pages ahead of cursor scans.
+ */
+void *
+__wt_cache_read_server(void *arg)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_READ_REQ req;
+	WT_SESSION_IMPL *session;
+	int ret;
+
+	conn = arg;
+	cache = conn->cache;
+	ret = 0;
+
+	/*
+	 * We need a session handle because we're reading files.  Start with
+	 * the default session to keep error handling simple.
+	 */
+	session = &conn->default_session;
+	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &session));
+
+	while (F_ISSET(conn, WT_SERVER_RUN)) {
+		__wt_cond_wait_timed(session, cache->read_cond, 100000);
+		while (__read_next(session, cache, &req)) {
+			/*
+			 * A failed read leaves the page on disk, the scan will
+			 * read it and handle the error.
+			 */
+			session->btree = req.btree;
+			if ((ret = __wt_cache_read(
+			    session, req.parent, req.ref, 1)) != 0)
+				__wt_err(session, ret, "read-ahead failed");
+			session->btree = NULL;
+
+			/* Wake a thread closing the file, if it's waiting. */
+			if (WT_ATOMIC_ADD(
+			    req.btree->read_ahead_pending, -1) == 0)
+				__wt_cond_signal(
+				    session, cache->read_done_cond);
+		}
+	}
+	ret = 0;
+
+	if (0) {
+err:		__wt_err(session, ret, "cache read server error");
+	}
+	if (session != &conn->default_session)
+		(void)session->iface.close(&session->iface, NULL);
+	return (NULL);
+}
+
+/*
+ * __read_next --
+ *	Take the oldest read-ahead request from the queue.
+ */
+static int
+__read_next(WT_SESSION_IMPL *session, WT_CACHE *cache, WT_READ_REQ *reqp)
+{
+	int more;
+
+	__wt_spin_lock(session, &cache->read_lock);
+	if (cache->read_queue_count == 0) {
+		__wt_spin_unlock(session, &cache->read_lock);
+		return (0);
+	}
+	*reqp = cache->read_queue[cache->read_queue_head];
+	cache->read_queue_head =
+	    (cache->read_queue_head + 1) % cache->read_queue_max;
+	more = --cache->read_queue_count != 0;
+	__wt_spin_unlock(session, &cache->read_lock);
+
+	/* If there's more work, wake another thread to share it. */
+	if (more)
+		__wt_cond_signal(session, cache->read_cond);
+	return (1);
+}
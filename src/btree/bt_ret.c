@@ -37,10 +37,10 @@ __wt_kv_return(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int key_ret)
 
 		/*
 		 * If the cursor references a WT_INSERT item, take the related
-		 * WT_UPDATE item.
+		 * WT_UPDATE item, if one is visible.
 		 */
-		if (cbt->ins != NULL) {
-			upd = cbt->ins->upd;
+		if (cbt->ins != NULL &&
+		    (upd = __wt_txn_read(session, cbt->ins->upd)) != NULL) {
 			cursor->value.data = WT_UPDATE_DATA(upd);
 			cursor->value.size = upd->size;
 			return (0);
@@ -53,10 +53,10 @@ __wt_kv_return(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int key_ret)
 
 		/*
 		 * If the cursor references a WT_INSERT item, take the related
-		 * WT_UPDATE item.
+		 * WT_UPDATE item, if one is visible.
 		 */
-		if (cbt->ins != NULL) {
-			upd = cbt->ins->upd;
+		if (cbt->ins != NULL &&
+		    (upd = __wt_txn_read(session, cbt->ins->upd)) != NULL) {
 			cursor->value.data = WT_UPDATE_DATA(upd);
 			cursor->value.size = upd->size;
 			return (0);
@@ -70,7 +70,8 @@ __wt_kv_return(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int key_ret)
 		 * If the cursor references a WT_INSERT item, take the key and
 		 * related WT_UPDATE item.   Otherwise, take the key from the
 		 * original page, and the value from any related WT_UPDATE item,
-		 * or the page if the key was never updated.
+		 * or the page if the key was never updated (or none of the key's
+		 * updates are visible).
 		 */
 		if (cbt->ins == NULL) {
 			if (key_ret) {
@@ -82,13 +83,13 @@ __wt_kv_return(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int key_ret)
 					WT_RET(__wt_row_key(
 					    session, page, rip, &cursor->key));
 			}
-			upd = WT_ROW_UPDATE(page, rip);
+			upd = __wt_txn_read(session, WT_ROW_UPDATE(page, rip));
 		} else {
 			if (key_ret) {
 				cursor->key.data = WT_INSERT_KEY(cbt->ins);
 				cursor->key.size = WT_INSERT_KEY_SIZE(cbt->ins);
 			}
-			upd = cbt->ins->upd;
+			upd = __wt_txn_read(session, cbt->ins->upd);
 		}
 		if (upd != NULL) {
 			cursor->value.data = WT_UPDATE_DATA(upd);
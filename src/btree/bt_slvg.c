@@ -166,7 +166,7 @@ __wt_salvage(WT_SESSION_IMPL *session, const char *cfg[])
 	 * salvage freeing the previous root page when it reads those blocks
 	 * from the file.
 	 */
-	WT_ERR(__wt_btree_set_root(session, btree->filename, NULL, 0));
+	WT_ERR(__wt_btree_set_root(session, btree->filename, NULL, 0, NULL));
 
 	/*
 	 * Step 2:
@@ -1061,7 +1061,7 @@ __slvg_col_build_internal(
 	page->entries = leaf_cnt;
 	page->type = WT_PAGE_COL_INT;
 	WT_RET(__wt_page_modify_init(session, page));
-	__wt_page_modify_set(page);
+	__wt_page_modify_set(session, page);
 
 	for (ref = page->u.intl.t, i = 0; i < ss->pages_next; ++i) {
 		if ((trk = ss->pages[i]) == NULL)
@@ -1179,7 +1179,7 @@ __slvg_col_build_leaf(
 
 	/* Write the new version of the leaf page to disk. */
 	WT_ERR(__wt_page_modify_init(session, page));
-	__wt_page_modify_set(page);
+	__wt_page_modify_set(session, page);
 	WT_ERR(__wt_rec_write(session, page, cookie));
 
 	/* Reset the page. */
@@ -1647,7 +1647,7 @@ __slvg_row_build_internal(
 	page->entries = leaf_cnt;
 	page->type = WT_PAGE_ROW_INT;
 	WT_ERR(__wt_page_modify_init(session, page));
-	__wt_page_modify_set(page);
+	__wt_page_modify_set(session, page);
 
 	for (ref = page->u.intl.t, i = 0; i < ss->pages_next; ++i) {
 		if ((trk = ss->pages[i]) == NULL)
@@ -1676,7 +1676,7 @@ __slvg_row_build_internal(
 			WT_ERR(__slvg_row_build_leaf(
 			    session, trk, page, ref, ss));
 		} else
-			WT_ERR(__wt_row_ikey_alloc(session, 0,
+			WT_ERR(__wt_row_ikey_alloc(session, page, 0,
 			    trk->row_start.data,
 			    trk->row_start.size,
 			    (WT_IKEY **)&ref->u.key));
@@ -1816,11 +1816,11 @@ __slvg_row_build_leaf(WT_SESSION_IMPL *session,
 	rip = page->u.row.d + skip_start;
 	if (__wt_off_page(page, rip->key)) {
 		ikey = rip->key;
-		WT_ERR(__wt_row_ikey_alloc(session, 0,
+		WT_ERR(__wt_row_ikey_alloc(session, parent, 0,
 		    WT_IKEY_DATA(ikey), ikey->size, (WT_IKEY **)&ref->u.key));
 	} else {
 		WT_ERR(__wt_row_key(session, page, rip, key));
-		WT_ERR(__wt_row_ikey_alloc(session, 0,
+		WT_ERR(__wt_row_ikey_alloc(session, parent, 0,
 		    key->data, key->size, (WT_IKEY **)&ref->u.key));
 	}
 
@@ -1866,7 +1866,7 @@ __slvg_row_build_leaf(WT_SESSION_IMPL *session,
 
 		/* Write the new version of the leaf page to disk. */
 		WT_ERR(__wt_page_modify_init(session, page));
-		__wt_page_modify_set(page);
+		__wt_page_modify_set(session, page);
 		WT_ERR(__wt_rec_write(session, page, cookie));
 
 		/* Reset the page. */
@@ -27,6 +27,8 @@ __wt_btree_stat_init(WT_SESSION_IMPL *session)
 	WT_RET(__wt_bm_stat(session));
 
 	WT_BSTAT_SET(session, file_allocsize, btree->allocsize);
+	WT_BSTAT_SET(
+	    session, file_cache_bytes, __wt_btree_bytes_inuse(btree));
 	WT_BSTAT_SET(session, file_fixed_len, btree->bitcnt);
 	WT_BSTAT_SET(session, file_maxintlpage, btree->maxintlpage);
 	WT_BSTAT_SET(session, file_maxintlitem, btree->maxintlitem);
@@ -7,41 +7,315 @@
 
 #include "wt_internal.h"
 
+/*
+ * WT_SYNC --
+ *	State shared by the threads syncing a tree.
+ */
+typedef struct {
+	WT_CONNECTION_IMPL *conn;
+	WT_BTREE *btree;		/* Tree being synced */
+	WT_PAGE *root;			/* Root page */
+
+	uint32_t next;			/* Next root slot to write */
+	int error;			/* First thread error */
+} WT_SYNC;
+
+static int   __checkpoint_write(WT_SESSION_IMPL *, WT_PAGE *);
+static void  __evict_pause(WT_SESSION_IMPL *);
+static void *__sync_thread(void *);
+
 /*
  * __wt_btree_sync --
  *	Sync the tree.
+ *
+ * Dirty pages are written by the calling thread, with eviction paused in
+ * the file: other files are evicted as usual.  With threads=N, N threads
+ * each write the dirty subtree below one of the root's slots at a time;
+ * the calling thread then writes the remaining internal pages, children
+ * before their parents.
  */
 int
 __wt_btree_sync(WT_SESSION_IMPL *session, const char *cfg[])
 {
+	WT_BTREE *btree;
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_PAGE *page;
+	WT_SYNC sync;
+	pthread_t *tids;
+	u_int i, nthreads;
+	int ret;
+
+	btree = session->btree;
+	conn = S2C(session);
+	tids = NULL;
+	ret = 0;
+
+	WT_RET(__wt_config_gets(session, cfg, "threads", &cval));
+	nthreads = (u_int)cval.val;
+
+	/*
+	 * One sync or checkpoint at a time: they write the same pages, and a
+	 * checkpoint records the root address of the pages it writes.
+	 */
+	__wt_writelock(session, conn->ckpt_rwlock);
+	if ((page = btree->root_page) == NULL)
+		goto done;
+	__evict_pause(session);
+
+	/*
+	 * Root slots are claimed in order, and a thread owns the subtree below
+	 * its slot: the only page the threads share is the root, written once
+	 * they're done.
+	 */
+	if (nthreads > page->entries)
+		nthreads = page->entries;
+	if (nthreads > 1 &&
+	    (page->type == WT_PAGE_COL_INT || page->type == WT_PAGE_ROW_INT)) {
+		WT_CLEAR(sync);
+		sync.conn = conn;
+		sync.btree = btree;
+		sync.root = page;
+
+		WT_ERR(__wt_calloc_def(session, nthreads, &tids));
+		for (i = 0; i < nthreads; ++i)
+			if ((ret = __wt_thread_create(
+			    &tids[i], __sync_thread, &sync)) != 0)
+				break;
+		nthreads = i;
+		for (i = 0; i < nthreads; ++i)
+			WT_TRET(__wt_thread_join(tids[i]));
+		WT_ERR(ret);
+		WT_ERR(sync.error);
+	}
+
+	WT_ERR(__checkpoint_write(session, page));
+
+	/* Wait for any of the pages queued for the write threads. */
+	WT_ERR(__wt_bm_flush(session));
+
+err:	F_CLR(btree, WT_BTREE_NO_EVICTION);
+done:	__wt_rwunlock(session, conn->ckpt_rwlock);
+	__wt_free(session, tids);
+	return (ret);
+}
+
+/*
+ * __sync_thread --
+ *	Thread writing the dirty subtrees below the root's slots.
+ */
+static void *
+__sync_thread(void *arg)
+{
+	WT_REF *ref;
+	WT_SESSION_IMPL *session;
+	WT_SYNC *sync;
+	uint32_t slot;
+	int ret;
+
+	sync = arg;
+	session = NULL;
+	ret = 0;
+
+	WT_ERR(__wt_open_session(sync->conn, 1, NULL, NULL, &session));
+	session->btree = sync->btree;
+	while (sync->error == 0 &&
+	    (slot = WT_ATOMIC_ADD(sync->next, 1) - 1) < sync->root->entries) {
+		ref = &sync->root->u.intl.t[slot];
+		switch (ref->state) {
+		case WT_REF_DISK:
+		case WT_REF_READING:
+			break;
+		default:
+			WT_ERR(__checkpoint_write(session, ref->page));
+			break;
+		}
+	}
+
+err:	if (ret != 0) {
+		sync->error = ret;
+		__wt_err(session != NULL ?
+		    session : &sync->conn->default_session, ret,
+		    "sync thread error");
+	}
+	if (session != NULL) {
+		session->btree = NULL;
+		(void)session->iface.close(&session->iface, NULL);
+	}
+	return (NULL);
+}
+
+/*
+ * __evict_pause --
+ *	Pause eviction in the session's file.
+ */
+static void
+__evict_pause(WT_SESSION_IMPL *session)
+{
+	WT_BTREE *btree;
+	WT_CACHE *cache;
+
+	btree = session->btree;
+	cache = S2C(session)->cache;
+
+	/*
+	 * Reconciliation and eviction can't run on the same pages: pause
+	 * eviction in the file.  The eviction server checks for page requests
+	 * holding the LRU lock, acquire it once to wait for any request it's
+	 * working on, then wait for threads evicting pages from the LRU queue.
+	 * Application threads keep reading and updating the file.
+	 */
+	F_SET(btree, WT_BTREE_NO_EVICTION);
+	__wt_spin_lock(session, &cache->lru_lock);
+	__wt_spin_unlock(session, &cache->lru_lock);
+	while (btree->lru_count > 0)
+		__wt_yield();
+}
+
+/*
+ * __checkpoint_write --
+ *	Write a page's dirty subtree, children before their parents.
+ */
+static int
+__checkpoint_write(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_REF *ref;
+	uint32_t i;
 	int ret;
 
-	WT_UNUSED(cfg);
+	/*
+	 * Eviction is paused in the file, pages can't leave the cache while
+	 * we walk the tree and we don't need hazard references.  Pages being
+	 * read are clean, skip them.
+	 */
+	switch (page->type) {
+	case WT_PAGE_COL_INT:
+	case WT_PAGE_ROW_INT:
+		WT_REF_FOREACH(page, ref, i)
+			switch (ref->state) {
+			case WT_REF_DISK:
+			case WT_REF_READING:
+				break;
+			default:
+				WT_RET(__checkpoint_write(session, ref->page));
+				break;
+			}
+		break;
+	}
+
+	/* The page stays in memory: track its writes to completion. */
+	if (__wt_page_is_modified(page)) {
+		session->write_page = page;
+		ret = __wt_rec_write(session, page, NULL);
+		session->write_page = NULL;
+		WT_RET(ret);
+	}
+	return (0);
+}
+
+/*
+ * __wt_btree_checkpoint --
+ *	Write the tree's dirty pages and record its root address.  The caller
+ * resolves the checkpoint in the block manager once the root is durable, if
+ * a root was recorded.
+ */
+int
+__wt_btree_checkpoint(WT_SESSION_IMPL *session, int force)
+{
+	WT_BTREE *btree;
+	WT_PAGE *next, *page;
+	uint32_t size;
+	int recorded, ret;
+	const uint8_t *addr;
+
+	btree = session->btree;
+	recorded = ret = 0;
+
+	if ((page = btree->root_page) == NULL)
+		return (0);
+	WT_RET(__wt_bm_checkpoint_start(session));
+
+	__evict_pause(session);
+
+	/* Force a new root, even if nothing has changed. */
+	if (force) {
+		WT_ERR(__wt_page_modify_init(session, page));
+		__wt_page_modify_set(session, page);
+	}
+
+	WT_ERR(__checkpoint_write(session, page));
+
+	/*
+	 * Find the root's address.  If the root page split, write the new
+	 * root page (as eviction does when the file is closed), until there's
+	 * a single root page.  If the root was never written, the tree hasn't
+	 * changed since the file was opened.
+	 */
+	for (;;) {
+		switch (F_ISSET(page, WT_PAGE_REC_MASK)) {
+		case 0:
+			goto err;
+		case WT_PAGE_REC_EMPTY:
+			addr = NULL;
+			size = 0;
+			break;
+		case WT_PAGE_REC_REPLACE:
+			addr = page->modify->u.replace.addr;
+			size = page->modify->u.replace.size;
+			break;
+		case WT_PAGE_REC_SPLIT:
+			next = page->modify->u.split;
+			if (F_ISSET(next, WT_PAGE_REC_SPLIT_MERGE) ||
+			    __wt_page_is_modified(next)) {
+				WT_ERR(__wt_page_modify_init(session, next));
+				__wt_page_modify_set(session, next);
+				F_CLR(next, WT_PAGE_REC_SPLIT_MERGE);
+				session->write_page = next;
+				ret = __wt_rec_write(session, next, NULL);
+				session->write_page = NULL;
+				WT_ERR(ret);
+			}
+			page = next;
+			continue;
+		WT_ILLEGAL_VALUE_ERR(session);
+		}
+		break;
+	}
+
+	/* If the root hasn't changed since the last checkpoint, we're done. */
+	if (btree->root_ckpt && size == btree->ckpt_addr.size &&
+	    (size == 0 || memcmp(addr, btree->ckpt_addr.addr, size) == 0))
+		goto err;
 
 	/*
-	 * Ask the eviction thread to flush any dirty pages.
-	 *
-	 * Reconciliation is just another reader of the page, so it's probably
-	 * possible to do this work in the current thread, rather than poking
-	 * the eviction thread.  The trick is for the sync thread to acquire
-	 * hazard references on each dirty page, which would block the eviction
-	 * thread from attempting to evict the pages.
-	 *
-	 * I'm not doing it for a few reasons: (1) I don't want sync to update
-	 * the page's read-generation number, and eviction already knows how to
-	 * do that, (2) I don't want more than a single sync running at a time,
-	 * and calling eviction makes it work that way without additional work,
-	 * (3) sync and eviction cannot operate on the same page at the same
-	 * time and I'd rather they didn't operate in the same file at the same
-	 * time, and using eviction makes it work that way without additional
-	 * synchronization, (4) eventually we'll have async write I/O, and this
-	 * approach results in one less page writer in the system, (5) the code
-	 * already works that way.   None of these problems can't be fixed, but
-	 * I don't see a reason to change at this time, either.
+	 * Flush the file before recording the root that references its pages.
+	 * The original root's blocks are freed by the first checkpoint, after
+	 * that, the root recorded in the schema file is the root page's last
+	 * replacement, and it's freed when the root page is written again.
 	 */
-	do {
-		ret = __wt_evict_file_serial(session, 0);
-	} while (ret == WT_RESTART);
+	WT_ERR(__wt_bm_sync(session));
+	if (!btree->root_ckpt)
+		WT_ERR(__wt_btree_free_root(session));
+	WT_ERR(__wt_btree_set_root(
+	    session, btree->filename, addr, size, &S2C(session)->ckpt_lsn));
+	btree->root_ckpt = 1;
+	recorded = 1;
+
+	__wt_free(session, btree->ckpt_addr.addr);
+	btree->ckpt_addr.size = 0;
+	if (addr != NULL) {
+		WT_ERR(__wt_strndup(
+		    session, (char *)addr, size, &btree->ckpt_addr.addr));
+		btree->ckpt_addr.size = size;
+	}
 
+	/*
+	 * If no new root was recorded, the last durable root still references
+	 * the blocks freed before the checkpoint started: they can't be reused
+	 * yet.
+	 */
+err:	if (!recorded)
+		WT_TRET(__wt_bm_checkpoint_resolve(session, 1));
+	F_CLR(btree, WT_BTREE_NO_EVICTION);
 	return (ret);
 }
@@ -0,0 +1,695 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The working set is a text file: a line for each file, then a line for each
+ * page, internal pages first, then leaf pages from the most recently used.
+ *
+ *	F <name> <filename>
+ *	I|L <file slot> <bytes in the cache> <hex address cookie>
+ *
+ * Fields are separated by tabs.
+ */
+#define	WT_WARM_FILENAME	"WiredTiger.warm"
+#define	WT_WARM_FILENAME_SET	"WiredTiger.warm.set"
+#define	WT_WARM_LINE_MAX	(2 * WT_BM_MAX_ADDR_COOKIE + 1024)
+
+/*
+ * WT_WARM_CHILD --
+ *	A child page to read, sorted by its file offset.
+ */
+typedef struct {
+	off_t	 offset;			/* File offset */
+	uint32_t slot;				/* Parent's slot */
+} WT_WARM_CHILD;
+
+static int  __warm_addr_cmp(const void *, const void *);
+static int  __warm_file(WT_SESSION_IMPL *, WT_WARM *, WT_WARM_FILE *);
+static int  __warm_file_cmp(const void *, const void *);
+static int  __warm_file_grow(WT_SESSION_IMPL *, WT_WARM *);
+static int  __warm_full(WT_SESSION_IMPL *, WT_WARM *);
+static int  __warm_load(WT_SESSION_IMPL *, WT_WARM *, FILE *, int *);
+static int  __warm_offset_cmp(const void *, const void *);
+static int  __warm_page(
+		WT_SESSION_IMPL *, WT_WARM *, WT_WARM_FILE *, WT_PAGE *);
+static int  __warm_page_grow(WT_SESSION_IMPL *, WT_WARM *, uint32_t);
+static int  __warm_save_cmp(const void *, const void *);
+static int  __warm_write(WT_SESSION_IMPL *, WT_WARM *);
+
+/*
+ * __wt_cache_warm_create --
+ *	Configure saving the cache's working set.  The working set saved by the
+ * last connection is read when the database has been opened.
+ */
+int
+__wt_cache_warm_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_CACHE *cache;
+	WT_CONFIG_ITEM cval;
+	WT_SESSION_IMPL *session;
+	WT_WARM *warm;
+
+	cache = conn->cache;
+	session = &conn->default_session;
+
+	WT_RET(__wt_config_gets(session, cfg, "cache_warm", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, 1, &warm));
+	cache->warm = warm;
+
+	WT_RET(__wt_config_gets(session, cfg, "cache_warm_fill", &cval));
+	warm->fill = (u_int)cval.val;
+	WT_RET(__wt_config_gets(session, cfg, "cache_warm_threads", &cval));
+	warm->nthreads = (u_int)cval.val;
+	WT_RET(__wt_calloc_def(session, warm->nthreads, &warm->tids));
+	WT_RET(__wt_cond_alloc(session, "cache warm server", 1, &warm->cond));
+	return (0);
+}
+
+/*
+ * __wt_cache_warm_destroy --
+ *	Discard the cache's working set.  The threads have exited.
+ */
+void
+__wt_cache_warm_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_SESSION_IMPL *session;
+	WT_WARM *warm;
+	u_int i;
+
+	session = &conn->default_session;
+	if (conn->cache == NULL || (warm = conn->cache->warm) == NULL)
+		return;
+
+	for (i = 0; i < warm->nfiles; ++i) {
+		__wt_free(session, warm->files[i].name);
+		__wt_free(session, warm->files[i].filename);
+	}
+	__wt_free(session, warm->files);
+	__wt_free(session, warm->pages);
+	__wt_buf_free(session, &warm->addrs);
+	if (warm->cond != NULL)
+		(void)__wt_cond_destroy(session, warm->cond);
+	__wt_free(session, warm->tids);
+	__wt_free(session, conn->cache->warm);
+}
+
+/*
+ * __wt_cache_warm_start --
+ *	Read the working set saved by the last connection, and start the threads
+ * reading its pages back into the cache.
+ */
+int
+__wt_cache_warm_start(WT_CONNECTION_IMPL *conn)
+{
+	FILE *fp;
+	WT_SESSION_IMPL *session;
+	WT_WARM *warm;
+	u_int i;
+	int exist, loaded, ret;
+	const char *path;
+
+	session = &conn->default_session;
+	path = NULL;
+	ret = 0;
+
+	if ((warm = conn->cache->warm) == NULL)
+		return (0);
+
+	WT_RET(__wt_exist(session, WT_WARM_FILENAME, &exist));
+	if (!exist)
+		return (0);
+
+	/*
+	 * Remove the file once it's read: the pages are read from the files as
+	 * they are now, and a working set saved by an earlier connection would
+	 * be warmed after a connection that didn't save one.
+	 */
+	WT_RET(__wt_filename(session, WT_WARM_FILENAME, &path));
+	if ((fp = fopen(path, "r")) == NULL)
+		ret = __wt_errno();
+	else {
+		ret = __warm_load(session, warm, fp, &loaded);
+		if (fclose(fp) != 0 && ret == 0)
+			ret = __wt_errno();
+	}
+	WT_TRET(__wt_remove(session, WT_WARM_FILENAME));
+	__wt_free(session, path);
+	WT_RET(ret);
+
+	/* The threads keep the files open, only start them if there's work. */
+	if (!loaded) {
+		warm->npages = 0;
+		return (0);
+	}
+	for (i = 0; i < warm->nthreads; ++i)
+		WT_RET(__wt_thread_create(
+		    &warm->tids[i], __wt_cache_warm_server, conn));
+	return (0);
+}
+
+/*
+ * __wt_cache_warm_stop --
+ *	Stop the threads reading the working set, and start saving the pages of
+ * the files as they're closed.
+ */
+int
+__wt_cache_warm_stop(WT_CONNECTION_IMPL *conn)
+{
+	WT_SESSION_IMPL *session;
+	WT_WARM *warm;
+	u_int i;
+	int ret;
+
+	session = &conn->default_session;
+	ret = 0;
+
+	if (conn->cache == NULL || (warm = conn->cache->warm) == NULL)
+		return (0);
+
+	/*
+	 * The pages read by the threads are saved too: the threads hold their
+	 * files open, closing their sessions can close the files.
+	 */
+	warm->npages = 0;
+	warm->addrs.size = 0;
+	warm->saving = 1;
+
+	warm->stop = 1;
+	for (i = 0; i < warm->nthreads; ++i)
+		if (warm->tids[i] != 0) {
+			__wt_cond_signal(session, warm->cond);
+			WT_TRET(__wt_thread_join(warm->tids[i]));
+			warm->tids[i] = 0;
+		}
+	return (ret);
+}
+
+/*
+ * __wt_cache_warm_page --
+ *	Save a page's address in the working set, the page's file is being
+ * closed.
+ */
+int
+__wt_cache_warm_page(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_BTREE *btree;
+	WT_WARM *warm;
+	WT_WARM_FILE *wf;
+	WT_WARM_PAGE *wp;
+	uint32_t addr_size;
+	const uint8_t *addr;
+
+	btree = session->btree;
+
+	if ((warm = S2C(session)->cache->warm) == NULL || !warm->saving)
+		return (0);
+
+	/*
+	 * Pages that will be merged into their parents don't have addresses of
+	 * their own, and the schema file is read when the database is opened.
+	 */
+	if (WT_PAGE_IS_ROOT(page) || __wt_page_is_modified(page) ||
+	    F_ISSET(page,
+	    WT_PAGE_REC_EMPTY | WT_PAGE_REC_SPLIT | WT_PAGE_REC_SPLIT_MERGE) ||
+	    strcmp(btree->filename, WT_SCHEMA_FILENAME) == 0)
+		return (0);
+
+	/* A page written since it was read has a new address. */
+	if (page->modify != NULL && F_ISSET(page, WT_PAGE_REC_REPLACE)) {
+		addr = page->modify->u.replace.addr;
+		addr_size = page->modify->u.replace.size;
+	} else
+		__wt_get_addr(page->parent, page->ref, &addr, &addr_size);
+	if (addr == NULL)
+		return (0);
+
+	/*
+	 * The eviction server discards the pages of closing files, one file at
+	 * a time: add a file when its first page is saved.
+	 */
+	if (warm->nfiles == 0 || strcmp(
+	    warm->files[warm->nfiles - 1].filename, btree->filename) != 0) {
+		WT_RET(__warm_file_grow(session, warm));
+		wf = &warm->files[warm->nfiles];
+		WT_RET(__wt_strdup(session, btree->name, &wf->name));
+		WT_RET(__wt_strdup(session, btree->filename, &wf->filename));
+		++warm->nfiles;
+	}
+
+	WT_RET(__warm_page_grow(session, warm, addr_size));
+	wp = &warm->pages[warm->npages++];
+	wp->read_gen = page->read_gen;
+	wp->file = warm->nfiles - 1;
+	wp->size = page->memory_footprint;
+	wp->internal =
+	    page->type == WT_PAGE_COL_INT || page->type == WT_PAGE_ROW_INT;
+	wp->addr_off = warm->addrs.size;
+	wp->addr_size = addr_size;
+	memcpy((uint8_t *)warm->addrs.mem + warm->addrs.size, addr, addr_size);
+	warm->addrs.size += addr_size;
+
+	WT_CSTAT_INCR(session, cache_warm_saved);
+	return (0);
+}
+
+/*
+ * __wt_cache_warm_save --
+ *	Write the working set, the connection's files have been closed.
+ */
+int
+__wt_cache_warm_save(WT_CONNECTION_IMPL *conn)
+{
+	WT_SESSION_IMPL *session;
+	WT_WARM *warm;
+	int ret;
+
+	session = &conn->default_session;
+
+	if (conn->cache == NULL ||
+	    (warm = conn->cache->warm) == NULL || !warm->saving)
+		return (0);
+	warm->saving = 0;
+	if (warm->npages == 0)
+		return (0);
+
+	/*
+	 * The working set only makes the next open faster: report a failure to
+	 * write it, but don't fail the close.
+	 */
+	if ((ret = __warm_write(session, warm)) != 0)
+		__wt_err(session, ret,
+		    "unable to save the cache's working set");
+	return (0);
+}
+
+/*
+ * __warm_write --
+ *	Write the working set to a temporary file, then rename it into place.
+ */
+static int
+__warm_write(WT_SESSION_IMPL *session, WT_WARM *warm)
+{
+	FILE *fp;
+	WT_ITEM *tmp;
+	WT_WARM_FILE *wf;
+	WT_WARM_PAGE *wp;
+	uint32_t i;
+	int ret;
+	const char *path;
+
+	fp = NULL;
+	tmp = NULL;
+	path = NULL;
+	ret = 0;
+
+	/* Internal pages first, then leaf pages, most recently used first. */
+	for (i = 0, wp = warm->pages; i < warm->npages; ++i, ++wp)
+		wp->addr = (uint8_t *)warm->addrs.mem + wp->addr_off;
+	qsort(warm->pages,
+	    warm->npages, sizeof(WT_WARM_PAGE), __warm_save_cmp);
+
+	WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+	WT_ERR(__wt_filename(session, WT_WARM_FILENAME_SET, &path));
+	WT_ERR_TEST((fp = fopen(path, "w")) == NULL, __wt_errno());
+
+	for (i = 0, wf = warm->files; i < warm->nfiles; ++i, ++wf)
+		(void)fprintf(fp, "F\t%s\t%s\n", wf->name, wf->filename);
+	for (i = 0, wp = warm->pages; i < warm->npages; ++i, ++wp) {
+		WT_ERR(__wt_raw_to_hex(session, wp->addr, wp->addr_size, tmp));
+		(void)fprintf(fp, "%c\t%u\t%" PRIu32 "\t%s\n",
+		    wp->internal ? 'I' : 'L',
+		    wp->file, wp->size, (const char *)tmp->data);
+	}
+	if (fflush(fp) != 0 || ferror(fp))
+		ret = __wt_errno();
+
+err:	if (fp != NULL && fclose(fp) != 0 && ret == 0)
+		ret = __wt_errno();
+	if (ret == 0)
+		ret = __wt_rename(
+		    session, WT_WARM_FILENAME_SET, WT_WARM_FILENAME);
+	else if (fp != NULL)
+		(void)__wt_remove(session, WT_WARM_FILENAME_SET);
+	__wt_free(session, path);
+	__wt_scr_free(&tmp);
+	return (ret);
+}
+
+/*
+ * __warm_load --
+ *	Read a saved working set, taking pages in the order they were saved
+ * until they would fill the configured percentage of the cache.
+ */
+static int
+__warm_load(WT_SESSION_IMPL *session, WT_WARM *warm, FILE *fp, int *loadedp)
+{
+	WT_ITEM *tmp;
+	WT_WARM_FILE *wf;
+	WT_WARM_PAGE *wp;
+	uint64_t budget, bytes;
+	uint32_t i, size;
+	u_int file;
+	int ret;
+	char line[WT_WARM_LINE_MAX], *hex, *p;
+
+	*loadedp = 0;
+	ret = 0;
+
+	budget = warm->fill * (S2C(session)->cache_size / 100);
+	bytes = 0;
+
+	WT_RET(__wt_scr_alloc(session, 0, &tmp));
+	while (fgets(line, (int)sizeof(line), fp) != NULL) {
+		if ((p = strchr(line, '\n')) == NULL)
+			goto corrupt;
+		*p = '\0';
+
+		switch (line[0]) {
+		case 'F':
+			if (line[1] != '\t' ||
+			    (p = strchr(line + 2, '\t')) == NULL)
+				goto corrupt;
+			*p++ = '\0';
+			WT_ERR(__warm_file_grow(session, warm));
+			wf = &warm->files[warm->nfiles];
+			WT_ERR(__wt_strdup(session, line + 2, &wf->name));
+			WT_ERR(__wt_strdup(session, p, &wf->filename));
+			++warm->nfiles;
+			break;
+		case 'I':
+		case 'L':
+			if (line[1] != '\t')
+				goto corrupt;
+			file = (u_int)strtoul(line + 2, &p, 10);
+			if (*p != '\t' || file >= warm->nfiles)
+				goto corrupt;
+			size = (uint32_t)strtoul(p + 1, &p, 10);
+			if (*p != '\t')
+				goto corrupt;
+			hex = p + 1;
+
+			/* Pages are saved most important first. */
+			if (bytes + size > budget)
+				goto done;
+			bytes += size;
+
+			if (__wt_hex_to_raw(session, hex, tmp) != 0)
+				goto corrupt;
+			WT_ERR(__warm_page_grow(session, warm, tmp->size));
+			wp = &warm->pages[warm->npages++];
+			wp->file = file;
+			wp->size = size;
+			wp->internal = line[0] == 'I';
+			wp->addr_off = warm->addrs.size;
+			wp->addr_size = tmp->size;
+			memcpy((uint8_t *)warm->addrs.mem +
+			    warm->addrs.size, tmp->data, tmp->size);
+			warm->addrs.size += tmp->size;
+			break;
+		default:
+			goto corrupt;
+		}
+	}
+	if (ferror(fp)) {
+		ret = __wt_errno();
+		goto err;
+	}
+
+	/* Sort each file's pages by address, and find each file's pages. */
+done:	for (i = 0, wp = warm->pages; i < warm->npages; ++i, ++wp)
+		wp->addr = (uint8_t *)warm->addrs.mem + wp->addr_off;
+	qsort(warm->pages,
+	    warm->npages, sizeof(WT_WARM_PAGE), __warm_file_cmp);
+	for (i = 0, wp = warm->pages; i < warm->npages; ++i, ++wp) {
+		wf = &warm->files[wp->file];
+		if (wf->npages++ == 0)
+			wf->pages = wp;
+	}
+	*loadedp = warm->npages != 0;
+
+	if (0) {
+corrupt:	__wt_errx(session, "%s: corrupted, the cache won't be warmed",
+		    WT_WARM_FILENAME);
+	}
+err:	__wt_scr_free(&tmp);
+	return (ret);
+}
+
+/*
+ * __wt_cache_warm_server --
+ *	Thread reading the pages of the saved working set into the cache.
+ */
+void *
+__wt_cache_warm_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *session;
+	WT_WARM *warm;
+	WT_WARM_FILE *wf;
+	uint32_t slot;
+	int ret;
+
+	conn = arg;
+	warm = conn->cache->warm;
+	ret = 0;
+
+	/*
+	 * We need a session handle because we're reading files.  Start with
+	 * the default session to keep error handling simple.
+	 */
+	session = &conn->default_session;
+	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &session));
+
+	/*
+	 * Files are claimed in turn.  A file that can't be read is skipped:
+	 * it may have been dropped since the working set was saved.
+	 */
+	while (!warm->stop &&
+	    (slot = WT_ATOMIC_ADD(warm->next_file, 1) - 1) < warm->nfiles) {
+		wf = &warm->files[slot];
+		if (wf->npages == 0)
+			continue;
+		if ((ret = __warm_file(session, warm, wf)) != 0 &&
+		    ret != WT_NOTFOUND)
+			__wt_err(session, ret,
+			    "cache warm: %s", wf->filename);
+		ret = 0;
+	}
+
+	/*
+	 * Closing the last reference to a file discards its pages: keep the
+	 * files open until the connection closes.
+	 */
+	while (!warm->stop)
+		__wt_cond_wait_timed(session, warm->cond, 100000);
+
+	if (0) {
+err:		__wt_err(session, ret, "cache warm server error");
+	}
+	if (session != &conn->default_session)
+		(void)session->iface.close(&session->iface, NULL);
+	return (NULL);
+}
+
+/*
+ * __warm_file --
+ *	Read a file's saved pages into the cache.
+ */
+static int
+__warm_file(WT_SESSION_IMPL *session, WT_WARM *warm, WT_WARM_FILE *wf)
+{
+	WT_ITEM *uri;
+	int ret;
+
+	ret = 0;
+
+	WT_RET(__wt_scr_alloc(session, 0, &uri));
+	WT_ERR(__wt_buf_fmt(session, uri, "file:%s", wf->filename));
+	WT_ERR(__wt_session_get_btree(
+	    session, wf->name, uri->data, NULL, NULL, 0));
+
+	/*
+	 * Pages can only be read through their parents: walk down from the
+	 * root, reading the children with saved addresses.
+	 */
+	if (session->btree->root_page != NULL)
+		ret = __warm_page(session, warm, wf, session->btree->root_page);
+	WT_TRET(__wt_session_release_btree(session));
+	session->btree = NULL;
+
+err:	__wt_scr_free(&uri);
+	return (ret);
+}
+
+/*
+ * __warm_page --
+ *	Read the saved children of an internal page, in file order.
+ */
+static int
+__warm_page(WT_SESSION_IMPL *session,
+    WT_WARM *warm, WT_WARM_FILE *wf, WT_PAGE *page)
+{
+	WT_PAGE *child;
+	WT_REF *ref;
+	WT_WARM_CHILD *children;
+	WT_WARM_PAGE key;
+	uint32_t i, n;
+	int ret;
+
+	ret = 0;
+
+	WT_RET(__wt_calloc_def(session, page->entries, &children));
+	for (i = n = 0; i < page->entries; ++i) {
+		__wt_get_addr(
+		    page, &page->u.intl.t[i], &key.addr, &key.addr_size);
+		if (key.addr == NULL || bsearch(&key, wf->pages,
+		    wf->npages, sizeof(WT_WARM_PAGE), __warm_addr_cmp) == NULL)
+			continue;
+		WT_ERR(__wt_bm_addr_offset(
+		    session, key.addr, key.addr_size, &children[n].offset));
+		children[n++].slot = i;
+	}
+	qsort(children, n, sizeof(WT_WARM_CHILD), __warm_offset_cmp);
+
+	for (i = 0; i < n && !warm->stop && !__warm_full(session, warm); ++i) {
+		ref = &page->u.intl.t[children[i].slot];
+		if (ref->state == WT_REF_DISK)
+			WT_CSTAT_INCR(session, cache_warm_read);
+		WT_ERR(__wt_page_in(session, page, ref));
+		child = ref->page;
+		if (child->type == WT_PAGE_COL_INT ||
+		    child->type == WT_PAGE_ROW_INT)
+			ret = __warm_page(session, warm, wf, child);
+		__wt_page_release(session, child);
+		WT_ERR(ret);
+	}
+
+err:	__wt_free(session, children);
+	return (ret);
+}
+
+/*
+ * __warm_file_grow --
+ *	Make room for another file, growing the array geometrically.
+ */
+static int
+__warm_file_grow(WT_SESSION_IMPL *session, WT_WARM *warm)
+{
+	if ((warm->nfiles + 1) * sizeof(WT_WARM_FILE) > warm->files_alloc)
+		WT_RET(__wt_realloc(session, &warm->files_alloc,
+		    WT_MAX(10 * sizeof(WT_WARM_FILE), 2 * warm->files_alloc),
+		    &warm->files));
+	return (0);
+}
+
+/*
+ * __warm_page_grow --
+ *	Make room for another page and its address cookie, growing the arrays
+ * geometrically: a working set can have hundreds of thousands of pages.
+ */
+static int
+__warm_page_grow(WT_SESSION_IMPL *session, WT_WARM *warm, uint32_t addr_size)
+{
+	size_t size;
+
+	if ((warm->npages + 1) * sizeof(WT_WARM_PAGE) > warm->pages_alloc)
+		WT_RET(__wt_realloc(session, &warm->pages_alloc,
+		    WT_MAX(1000 * sizeof(WT_WARM_PAGE), 2 * warm->pages_alloc),
+		    &warm->pages));
+	if ((size = warm->addrs.size + addr_size) > warm->addrs.memsize)
+		WT_RET(__wt_buf_grow(session,
+		    &warm->addrs, WT_MAX(size, 2 * warm->addrs.memsize)));
+	return (0);
+}
+
+/*
+ * __warm_full --
+ *	Return if the cache is full enough to stop reading.
+ */
+static int
+__warm_full(WT_SESSION_IMPL *session, WT_WARM *warm)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+	return (__wt_cache_bytes_inuse(conn->cache) >=
+	    warm->fill * (conn->cache_size / 100));
+}
+
+/*
+ * __warm_addr_cmp --
+ *	Qsort/bsearch function: sort pages by address cookie.
+ */
+static int
+__warm_addr_cmp(const void *a, const void *b)
+{
+	const WT_WARM_PAGE *pa, *pb;
+	int cmp;
+
+	pa = a;
+	pb = b;
+	if ((cmp = memcmp(pa->addr,
+	    pb->addr, WT_MIN(pa->addr_size, pb->addr_size))) != 0)
+		return (cmp);
+	return (pa->addr_size < pb->addr_size ? -1 :
+	    (pa->addr_size > pb->addr_size ? 1 : 0));
+}
+
+/*
+ * __warm_file_cmp --
+ *	Qsort function: sort pages by file, then by address cookie.
+ */
+static int
+__warm_file_cmp(const void *a, const void *b)
+{
+	const WT_WARM_PAGE *pa, *pb;
+
+	pa = a;
+	pb = b;
+	if (pa->file != pb->file)
+		return (pa->file < pb->file ? -1 : 1);
+	return (__warm_addr_cmp(a, b));
+}
+
+/*
+ * __warm_save_cmp --
+ *	Qsort function: sort internal pages first, then pages from the most
+ * recently used.
+ */
+static int
+__warm_save_cmp(const void *a, const void *b)
+{
+	const WT_WARM_PAGE *pa, *pb;
+
+	pa = a;
+	pb = b;
+	if (pa->internal != pb->internal)
+		return (pa->internal ? -1 : 1);
+	if (pa->read_gen != pb->read_gen)
+		return (pa->read_gen > pb->read_gen ? -1 : 1);
+	return (0);
+}
+
+/*
+ * __warm_offset_cmp --
+ *	Qsort function: sort child pages by file offset.
+ */
+static int
+__warm_offset_cmp(const void *a, const void *b)
+{
+	const WT_WARM_CHILD *ca, *cb;
+
+	ca = a;
+	cb = b;
+	return (ca->offset < cb->offset ? -1 :
+	    (ca->offset > cb->offset ? 1 : 0));
+}
@@ -8,7 +8,7 @@
 #include "wt_internal.h"
 
 static int __col_insert_alloc(
-    WT_SESSION_IMPL *, uint64_t, u_int, WT_INSERT **, size_t *);
+    WT_SESSION_IMPL *, WT_PAGE *, uint64_t, u_int, WT_INSERT **, size_t *);
 
 /*
  * __wt_col_modify --
@@ -18,7 +18,7 @@ int
 __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 {
 	WT_BTREE *btree;
-	WT_INSERT *ins, *ins_copy;
+	WT_INSERT *ins;
 	WT_INSERT_HEAD **inshead, *new_inshead, **new_inslist;
 	WT_ITEM *value, _value;
 	WT_PAGE *page;
@@ -79,11 +79,20 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 	 * the WT_INSERT structure.
 	 */
 	if (cbt->compare == 0 && cbt->ins != NULL) {
-		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
+		WT_ERR(
+		    __wt_update_alloc(session, page, value, &upd, &upd_size));
+
+		/*
+		 * Link the new entry to the current head of the update list:
+		 * the serialized function only swaps the new entry into place
+		 * if the list head hasn't changed since we read it.
+		 */
+		upd->next = cbt->ins->upd;
+		WT_ERR(__wt_txn_modify(session, upd));
 
 		/* Insert the WT_UPDATE structure. */
 		ret = __wt_update_serial(session, page,
-		    cbt->write_gen, &cbt->ins->upd, NULL, 0, &upd, upd_size);
+		    &cbt->ins->upd, NULL, 0, upd);
 	} else {
 		/* There may be no insert list, allocate as necessary. */
 		new_inshead_size = new_inslist_size = 0;
@@ -119,8 +128,10 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 		if (*inshead == NULL) {
 			new_inshead_size = sizeof(WT_INSERT_HEAD);
 			WT_RET(__wt_calloc_def(session, 1, &new_inshead));
-			for (i = 0; i < WT_SKIP_MAXDEPTH; i++)
+			for (i = 0; i < WT_SKIP_MAXDEPTH; i++) {
 				cbt->ins_stack[i] = &new_inshead->head[i];
+				cbt->next_stack[i] = NULL;
+			}
 			cbt->ins_head = new_inshead;
 		}
 
@@ -132,45 +143,42 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 		 * to reference it.
 		 */
 		WT_ERR(__col_insert_alloc(
-		    session, recno, skipdepth, &ins, &ins_size));
-		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
+		    session, page, recno, skipdepth, &ins, &ins_size));
+		WT_ERR(
+		    __wt_update_alloc(session, page, value, &upd, &upd_size));
+		WT_ERR(__wt_txn_modify(session, upd));
 		ins->upd = upd;
-		ins_size += upd_size;
 		cbt->ins = ins;
 
 		/*
 		 * Insert or append the WT_INSERT structure.
 		 */
 		if (op == 1) {
-			/*
-			 * The serialized function clears ins: take a copy of
-			 * the pointer so we can look up the record number.
-			 */
-			ins_copy = ins;
-
 			WT_ERR(__wt_col_append_serial(session,
 			    page, inshead, cbt->ins_stack,
 			    &new_inslist, new_inslist_size,
-			    &new_inshead, new_inshead_size,
-			    &ins, ins_size, skipdepth));
+			    &new_inshead, new_inshead_size, ins, skipdepth));
 
 			/* Put the new recno into the cursor. */
-			cbt->recno = WT_INSERT_RECNO(ins_copy);
+			cbt->recno = WT_INSERT_RECNO(ins);
 		} else
 			WT_ERR(__wt_insert_serial(session,
-			    page, cbt->write_gen,
-			    inshead, cbt->ins_stack,
+			    page, inshead, cbt->ins_stack, cbt->next_stack,
 			    &new_inslist, new_inslist_size,
-			    &new_inshead, new_inshead_size,
-			    &ins, ins_size, skipdepth));
+			    &new_inshead, new_inshead_size, ins, skipdepth));
 	}
 
+	/*
+	 * Return unused structures to the page's arena, newest allocation
+	 * first.
+	 */
 	if (ret != 0) {
-err:		if (ins != NULL)
-			__wt_free(session, ins);
-		if (upd != NULL)
-			__wt_free(session, upd);
+err:		if (upd != NULL)
+			__wt_page_arena_free(session, page, upd, upd_size);
+		if (ins != NULL)
+			__wt_page_arena_free(session, page, ins, ins_size);
 	}
+	__wt_txn_modify_end(session, upd, ret);
 
 	__wt_free(session, new_inslist);
 	__wt_free(session, new_inshead);
@@ -180,11 +188,11 @@ err:		if (ins != NULL)
 
 /*
  * __col_insert_alloc --
- *	Column-store insert: allocate a WT_INSERT structure from the session's
- *	buffer and fill it in.
+ *	Column-store insert: allocate a WT_INSERT structure from the page's
+ *	arena and fill it in.
  */
 static int
-__col_insert_alloc(WT_SESSION_IMPL *session,
+__col_insert_alloc(WT_SESSION_IMPL *session, WT_PAGE *page,
     uint64_t recno, u_int skipdepth, WT_INSERT **insp, size_t *ins_sizep)
 {
 	WT_INSERT *ins;
@@ -195,7 +203,7 @@ __col_insert_alloc(WT_SESSION_IMPL *session,
 	 * the record number into place.
 	 */
 	ins_size = sizeof(WT_INSERT) + skipdepth * sizeof(WT_INSERT *);
-	WT_RET(__wt_calloc(session, 1, ins_size, &ins));
+	WT_RET(__wt_page_arena_alloc(session, page, ins_size, &ins));
 
 	WT_INSERT_RECNO(ins) = recno;
 
@@ -213,7 +221,7 @@ __wt_col_append_serial_func(WT_SESSION_IMPL *session)
 {
 	WT_BTREE *btree;
 	WT_PAGE *page;
-	WT_INSERT *ins, *new_ins, ***ins_stack;
+	WT_INSERT *ins, *new_ins, ***ins_stack, *next_stack[WT_SKIP_MAXDEPTH];
 	WT_INSERT_HEAD **inshead, **new_inslist, *new_inshead;
 	uint64_t recno;
 	u_int i, skipdepth;
@@ -225,21 +233,37 @@ __wt_col_append_serial_func(WT_SESSION_IMPL *session)
 	__wt_col_append_unpack(session, &page, &inshead, &ins_stack,
 	    &new_inslist, &new_inshead, &new_ins, &skipdepth);
 
+	/*
+	 * Appends allocate record numbers and update the list's tail pointers,
+	 * they are done holding the page lock.
+	 */
+	WT_PAGE_LOCK(session, page);
+
 	/*
 	 * If the page does not yet have an insert array, our caller passed
-	 * us one.
+	 * us one.  If another thread installed an insert array first, our
+	 * insert head references the array we allocated, restart.
 	 */
-	if (page->modify->append == NULL) {
-		page->modify->append = new_inslist;
+	if (new_inslist != NULL) {
+		if (page->modify->append != NULL) {
+			ret = WT_RESTART;
+			goto done;
+		}
+		WT_PUBLISH(page->modify->append, new_inslist);
 		__wt_col_append_new_inslist_taken(session, page);
 	}
 
 	/*
 	 * If the insert head does not yet have an insert list, our caller
-	 * passed us one.
+	 * passed us one.  If another thread installed an insert list first,
+	 * restart.
 	 */
-	if (*inshead == NULL) {
-		*inshead = new_inshead;
+	if (new_inshead != NULL) {
+		if (*inshead != NULL) {
+			ret = WT_RESTART;
+			goto done;
+		}
+		WT_PUBLISH(*inshead, new_inshead);
 		__wt_col_append_new_inshead_taken(session, page);
 	}
 
@@ -253,7 +277,7 @@ __wt_col_append_serial_func(WT_SESSION_IMPL *session)
 	 */
 	if ((recno = WT_INSERT_RECNO(new_ins)) == 0)
 		recno = WT_INSERT_RECNO(new_ins) = ++btree->last_recno;
-	ins = __col_insert_search(*inshead, ins_stack, recno);
+	ins = __col_insert_search(*inshead, ins_stack, next_stack, recno);
 
 	/* If we find the record number, there's been a race. */
 	if (ins != NULL && WT_INSERT_RECNO(ins) == recno) {
@@ -273,18 +297,26 @@ __wt_col_append_serial_func(WT_SESSION_IMPL *session)
 	 * to the next elements in the insert list, then flush memory.  Second,
 	 * update the skiplist elements that reference the new WT_INSERT item,
 	 * this ensures the list is never inconsistent.
+	 *
+	 * Other threads inserting into the list without the page lock may
+	 * change the skiplist elements, the compare-and-swap is a full barrier
+	 * and fails if that happens.  Fail on the bottom level restarts the
+	 * append, fail on any other level means the levels below are enough.
 	 */
 	for (i = 0; i < skipdepth; i++)
-		new_ins->next[i] = *ins_stack[i];
-	WT_WRITE_BARRIER();
+		new_ins->next[i] = next_stack[i];
 	for (i = 0; i < skipdepth; i++) {
-		if ((*inshead)->tail[i] == NULL ||
-		    ins_stack[i] == &(*inshead)->tail[i]->next[i])
+		if (!WT_ATOMIC_CAS(*ins_stack[i], new_ins->next[i], new_ins)) {
+			if (i == 0) {
+				ret = WT_RESTART;
+				goto done;
+			}
+			break;
+		}
+		if (new_ins->next[i] == NULL)
 			(*inshead)->tail[i] = new_ins;
-		*ins_stack[i] = new_ins;
 	}
 
-	__wt_col_append_new_ins_taken(session, page);
-
-done:	__wt_session_serialize_wrapup(session, page, ret);
+done:	WT_PAGE_UNLOCK(session, page);
+	__wt_session_serialize_wrapup(session, page, ret);
 }
@@ -75,17 +75,13 @@ __wt_col_search(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_modify)
 	}
 
 	/*
-	 * Copy the leaf page's write generation value before reading the page.
-	 * Use a read memory barrier to ensure we read the value before we read
-	 * any of the page's contents.
+	 * Initialize the page's modification information before modifying the
+	 * page: it holds the per-page lock serializing changes to the page's
+	 * skiplist tails.
 	 */
-	if (is_modify) {
-		/* Initialize the page's modification information */
+	if (is_modify)
 		WT_RET(__wt_page_modify_init(session, page));
 
-		WT_ORDERED_READ(cbt->write_gen, page->modify->write_gen);
-	}
-
 	cbt->page = page;
 	cbt->recno = recno;
 	cbt->compare = 0;
@@ -118,8 +114,8 @@ __wt_col_search(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_modify)
 	 * For that reason, don't set the cursor's WT_INSERT_HEAD/WT_INSERT pair
 	 * until we know we have a useful entry.
 	 */
-	if ((ins =
-	    __col_insert_search(ins_head, cbt->ins_stack, recno)) != NULL)
+	if ((ins = __col_insert_search(
+	    ins_head, cbt->ins_stack, cbt->next_stack, recno)) != NULL)
 		if (recno == WT_INSERT_RECNO(ins)) {
 			cbt->ins_head = ins_head;
 			cbt->ins = ins;
@@ -136,8 +132,8 @@ past_end:
 	 * past the end of the table.
 	 */
 	cbt->ins_head = WT_COL_APPEND(page);
-	if ((cbt->ins =
-	    __col_insert_search(cbt->ins_head, cbt->ins_stack, recno)) == NULL)
+	if ((cbt->ins = __col_insert_search(cbt->ins_head,
+	    cbt->ins_stack, cbt->next_stack, recno)) == NULL)
 		cbt->compare = -1;
 	else {
 		cbt->recno = WT_INSERT_RECNO(cbt->ins);
@@ -25,10 +25,8 @@ static int  __rec_root_dirty_update(WT_SESSION_IMPL *, WT_PAGE *, int);
 int
 __wt_rec_evict(WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t flags)
 {
-	WT_CONNECTION_IMPL *conn;
 	int ret, single;
 
-	conn = S2C(session);
 	ret = 0;
 
 	WT_VERBOSE(session, evict,
@@ -54,18 +52,18 @@ __wt_rec_evict(WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t flags)
 	/* Count evictions of internal pages during normal operation. */
 	if (!single &&
 	    (page->type == WT_PAGE_COL_INT || page->type == WT_PAGE_ROW_INT))
-		WT_STAT_INCR(conn->stats, cache_evict_internal);
+		WT_CSTAT_INCR(session, cache_evict_internal);
 
 	/* Update the parent and discard the page. */
 	if (F_ISSET(page, WT_PAGE_REC_MASK) == 0) {
-		WT_STAT_INCR(conn->stats, cache_evict_unmodified);
+		WT_CSTAT_INCR(session, cache_evict_unmodified);
 
 		if (WT_PAGE_IS_ROOT(page))
 			WT_ERR(__rec_root_clean_update(session, page, single));
 		else
 			WT_ERR(__rec_page_clean_update(session, page, single));
 	} else {
-		WT_STAT_INCR(conn->stats, cache_evict_modified);
+		WT_CSTAT_INCR(session, cache_evict_modified);
 
 		if (WT_PAGE_IS_ROOT(page))
 			WT_ERR(__rec_root_dirty_update(session, page, single));
@@ -268,10 +266,14 @@ __rec_root_dirty_update(WT_SESSION_IMPL *session, WT_PAGE *page, int single)
 	 * only time we see multiple splits in here is when we've bulk-loaded
 	 * something huge, and now we're evicting the index page referencing all
 	 * of those leaf pages.
+	 *
+	 * A checkpoint may have already written the new root page: leave its
+	 * reconciliation state alone in that case, so the blocks it wrote are
+	 * freed when the page is written again.
 	 */
 	WT_RET(__wt_page_modify_init(session, next));
-	__wt_page_modify_set(next);
-	F_CLR(next, WT_PAGE_REC_MASK);
+	__wt_page_modify_set(session, next);
+	F_CLR(next, WT_PAGE_REC_SPLIT_MERGE);
 
 	WT_RET(__wt_rec_write(session, next, NULL));
 
@@ -375,6 +377,14 @@ __rec_review(WT_SESSION_IMPL *session,
 	if (!LF_ISSET(WT_REC_SINGLE))
 		WT_RET(__hazard_exclusive(session, ref, top));
 
+	/*
+	 * A page isn't clean until its queued writes complete: if one fails,
+	 * the page is dirty again and must still be in memory.
+	 */
+	if (!LF_ISSET(WT_REC_SINGLE) &&
+	    page->modify != NULL && page->modify->write_pending != 0)
+		return (EBUSY);
+
 	/*
 	 * Recurse through the page's subtree: this happens first because we
 	 * have to write pages in depth-first order, otherwise we'll dirty
@@ -440,10 +450,27 @@ __rec_review(WT_SESSION_IMPL *session,
 	    WT_PAGE_REC_EMPTY | WT_PAGE_REC_SPLIT | WT_PAGE_REC_SPLIT_MERGE))
 		return (EBUSY);
 
-	/* If the page is dirty, write it so we know the final state. */
+	/*
+	 * If the page is dirty, write it so we know the final state.  If the
+	 * page is still dirty after being written, it has updates that aren't
+	 * yet visible to every running transaction: it can't be evicted.
+	 */
 	if (__wt_page_is_modified(page) &&
-	    !F_ISSET(page, WT_PAGE_REC_SPLIT_MERGE))
+	    !F_ISSET(page, WT_PAGE_REC_SPLIT_MERGE)) {
+		/*
+		 * Don't write the page again if the last write skipped updates
+		 * and the transaction that needed them is still running: the
+		 * write would skip them again.
+		 */
+		if (page->modify->rec_oldest != WT_TXN_NONE &&
+		    page->modify->rec_oldest == __wt_txn_oldest(session)) {
+			WT_CSTAT_INCR(session, cache_evict_readers);
+			return (EBUSY);
+		}
 		WT_RET(__wt_rec_write(session, page, NULL));
+		if (__wt_page_is_modified(page))
+			return (EBUSY);
+	}
 
 	/*
 	 * Repeat the eviction tests.
@@ -524,9 +551,22 @@ __hazard_exclusive(WT_SESSION_IMPL *session, WT_REF *ref, int top)
 
 	session->excl[session->excl_next++] = ref;
 
-	/* Walk the list of hazard references to search for a match. */
+	/*
+	 * If pages are pinned by reference counts, check the page's count,
+	 * otherwise walk the list of hazard references to search for a match.
+	 */
 	conn = S2C(session);
-	elem = conn->session_size * conn->hazard_size;
+	if (F_ISSET(conn, WT_EPOCH_RECLAIM)) {
+		if (ref->page->pins == 0)
+			return (0);
+		WT_BSTAT_INCR(session, rec_hazard);
+		WT_CSTAT_INCR(session, cache_evict_hazard);
+
+		WT_VERBOSE(session,
+		    evict, "page %p pinned, request failed", ref->page);
+		return (EBUSY);
+	}
+	elem = conn->session_size * conn->hazard_max;
 	for (i = 0, hp = conn->hazard; i < elem; ++i, ++hp)
 		if (hp->page == ref->page) {
 			WT_BSTAT_INCR(session, rec_hazard);
@@ -140,6 +140,13 @@ typedef struct {
 	int     key_pfx_compress_conf;	/* If prefix compression configured */
 	int	key_sfx_compress;	/* If can suffix-compress next key */
 	int     key_sfx_compress_conf;	/* If suffix compression configured */
+
+	/*
+	 * Only updates visible to every running transaction are written: if
+	 * newer updates are skipped, the page stays dirty.
+	 */
+	uint64_t txn_oldest;		/* Oldest ID a transaction can't see */
+	int	 upd_skipped;		/* Skipped an update */
 } WT_RECONCILE;
 
 static void __rec_cell_build_addr(
@@ -164,6 +171,7 @@ static int  __rec_row_leaf_insert(WT_SESSION_IMPL *, WT_INSERT *);
 static int  __rec_row_merge(WT_SESSION_IMPL *, WT_PAGE *);
 static int  __rec_split(WT_SESSION_IMPL *session);
 static int  __rec_split_col(WT_SESSION_IMPL *, WT_PAGE *, WT_PAGE **);
+static int  __rec_split_discard(WT_SESSION_IMPL *, WT_PAGE *, WT_PAGE *);
 static int  __rec_split_finish(WT_SESSION_IMPL *);
 static int  __rec_split_fixup(WT_SESSION_IMPL *);
 static int  __rec_split_init(WT_SESSION_IMPL *, WT_PAGE *, uint64_t, uint32_t);
@@ -185,6 +193,42 @@ __rec_track_cell(
 	    WT_PT_BLOCK_EVICT, page, unpack->data, unpack->size) : 0);
 }
 
+/*
+ * __rec_txn_read --
+ *	Return the newest update in a list that's visible to every running
+ * transaction, or NULL if there isn't one.
+ */
+static inline WT_UPDATE *
+__rec_txn_read(WT_RECONCILE *r, WT_UPDATE *upd)
+{
+	for (; upd != NULL; upd = upd->next) {
+		if (upd->txnid == WT_TXN_ABORTED)
+			continue;
+		if (upd->txnid < r->txn_oldest)
+			return (upd);
+		r->upd_skipped = 1;
+	}
+	return (NULL);
+}
+
+/*
+ * __rec_child_inmem --
+ *	Return if a child page is in memory.  A checkpoint reconciles internal
+ * pages while application threads read in their children: a page still being
+ * read is clean, use its on-disk address.
+ */
+static inline int
+__rec_child_inmem(WT_REF *ref)
+{
+	switch (ref->state) {
+	case WT_REF_DISK:
+	case WT_REF_READING:
+		return (0);
+	default:
+		return (1);
+	}
+}
+
 /*
  * __wt_rec_write --
  *	Reconcile an in-memory page into its on-disk format, and write it.
@@ -193,6 +237,8 @@ int
 __wt_rec_write(
     WT_SESSION_IMPL *session, WT_PAGE *page, WT_SALVAGE_COOKIE *salvage)
 {
+	WT_RECONCILE *r;
+
 	WT_VERBOSE(session, reconcile,
 	    "page %p %s", page, __wt_page_type_string(page->type));
 
@@ -243,6 +289,23 @@ __wt_rec_write(
 	/* Wrap up overflow tracking, discarding what we can. */
 	WT_RET(__wt_rec_track_wrapup(session, page, 0));
 
+	/*
+	 * If we skipped updates some transaction can't see yet, the page isn't
+	 * clean: leave it marked dirty so it's written again.  Otherwise, the
+	 * page's bytes are no longer dirty, unless the page was modified while
+	 * it was being written.
+	 */
+	r = session->reconcile;
+	if (r->upd_skipped) {
+		--page->modify->disk_gen;
+		page->modify->rec_oldest = r->txn_oldest;
+	} else {
+		page->modify->rec_oldest = WT_TXN_NONE;
+		__wt_cache_dirty_decr(session, page);
+		if (__wt_page_is_modified(page))
+			__wt_cache_dirty_incr(session, page);
+	}
+
 	/*
 	 * If this page has a parent, mark the parent dirty.
 	 *
@@ -256,7 +319,7 @@ __wt_rec_write(
 	 */
 	if (!WT_PAGE_IS_ROOT(page)) {
 		WT_RET(__wt_page_modify_init(session, page->parent));
-		__wt_page_modify_set(page->parent);
+		__wt_page_modify_set(session, page->parent);
 	}
 
 	return (0);
@@ -306,6 +369,10 @@ __rec_write_init(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	r->page = page;
 
+	/* Updates made by transactions older than any running one are safe. */
+	r->txn_oldest = __wt_txn_oldest(session);
+	r->upd_skipped = 0;
+
 	return (0);
 }
 
@@ -1029,7 +1096,7 @@ __wt_rec_bulk_wrapup(WT_CURSOR_BULK *cbulk)
 
 	/* Mark the page's parent dirty. */
 	WT_RET(__wt_page_modify_init(session, page->parent));
-	__wt_page_modify_set(page->parent);
+	__wt_page_modify_set(session, page->parent);
 
 	return (0);
 }
@@ -1220,7 +1287,7 @@ __rec_col_merge(WT_SESSION_IMPL *session, WT_PAGE *page)
 		 * Deleted/split pages are merged into the parent and discarded.
 		 */
 		val_set = 0;
-		if (ref->state != WT_REF_DISK) {
+		if (__rec_child_inmem(ref)) {
 			rp = ref->page;
 			switch (F_ISSET(rp, WT_PAGE_REC_MASK)) {
 			case WT_PAGE_REC_EMPTY:
@@ -1294,6 +1361,7 @@ __rec_col_fix(WT_SESSION_IMPL *session, WT_PAGE *page)
 	WT_INSERT *ins;
 	WT_INSERT_HEAD *append;
 	WT_RECONCILE *r;
+	WT_UPDATE *upd;
 	uint64_t recno;
 	uint32_t entry, nrecs;
 
@@ -1302,9 +1370,10 @@ __rec_col_fix(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	/* Update any changes to the original on-page data items. */
 	WT_SKIP_FOREACH(ins, WT_COL_UPDATE_SINGLE(page))
-		__bit_setv_recno(
-		    page, WT_INSERT_RECNO(ins), btree->bitcnt,
-		    ((uint8_t *)WT_UPDATE_DATA(ins->upd))[0]);
+		if ((upd = __rec_txn_read(r, ins->upd)) != NULL)
+			__bit_setv_recno(
+			    page, WT_INSERT_RECNO(ins), btree->bitcnt,
+			    ((uint8_t *)WT_UPDATE_DATA(upd))[0]);
 
 	/* Allocate the memory. */
 	WT_RET(__rec_split_init(session,
@@ -1334,8 +1403,10 @@ __rec_col_fix(WT_SESSION_IMPL *session, WT_PAGE *page)
 				    r->first_free, entry, btree->bitcnt, 0);
 
 			if (nrecs > 0) {
+				upd = __rec_txn_read(r, ins->upd);
 				__bit_setv(r->first_free, entry, btree->bitcnt,
-				    ((uint8_t *)WT_UPDATE_DATA(ins->upd))[0]);
+				    upd == NULL ? 0 :
+				    ((uint8_t *)WT_UPDATE_DATA(upd))[0]);
 				--nrecs;
 				++entry;
 				++r->recno;
@@ -1654,24 +1725,16 @@ __rec_col_var(
 		 */
 		for (n = 0;
 		    n < nrepeat; n += repeat_count, src_recno += repeat_count) {
+			/*
+			 * Write the newest update every transaction can see,
+			 * or the original value if there isn't one.
+			 */
 			if (ins != NULL && WT_INSERT_RECNO(ins) == src_recno) {
-				upd = ins->upd;
+				upd = __rec_txn_read(r, ins->upd);
 				ins = WT_SKIP_NEXT(ins);
-
-				deleted = WT_UPDATE_DELETED_ISSET(upd);
-				if (!deleted) {
-					data = WT_UPDATE_DATA(upd);
-					size = upd->size;
-				}
-
 				repeat_count = 1;
 			} else {
 				upd = NULL;
-				deleted = orig_deleted;
-				if (!deleted) {
-					data = orig.data;
-					size = orig.size;
-				}
 
 				/*
 				 * The repeat count is the number of records up
@@ -1685,6 +1748,19 @@ __rec_col_var(
 					repeat_count =
 					    WT_INSERT_RECNO(ins) - src_recno;
 			}
+			if (upd != NULL) {
+				deleted = WT_UPDATE_DELETED_ISSET(upd);
+				if (!deleted) {
+					data = WT_UPDATE_DATA(upd);
+					size = upd->size;
+				}
+			} else {
+				deleted = orig_deleted;
+				if (!deleted) {
+					data = orig.data;
+					size = orig.size;
+				}
+			}
 
 			/*
 			 * Handle RLE accounting and comparisons.
@@ -1746,8 +1822,9 @@ __rec_col_var(
 			 */
 			if (src_recno < n)
 				deleted = 1;
+			else if ((upd = __rec_txn_read(r, ins->upd)) == NULL)
+				deleted = 1;
 			else {
-				upd = ins->upd;
 				deleted = WT_UPDATE_DELETED_ISSET(upd);
 				if (!deleted) {
 					data = WT_UPDATE_DATA(upd);
@@ -1901,7 +1978,7 @@ __rec_row_int(WT_SESSION_IMPL *session, WT_PAGE *page)
 		 * is on the split-created internal page.
 		 */
 		val_set = 0;
-		if (ref->state != WT_REF_DISK) {
+		if (__rec_child_inmem(ref)) {
 			rp = ref->page;
 			switch (F_ISSET(rp, WT_PAGE_REC_MASK)) {
 			case WT_PAGE_REC_EMPTY:
@@ -2052,7 +2129,7 @@ __rec_row_merge(WT_SESSION_IMPL *session, WT_PAGE *page)
 		 * Deleted/split pages are merged into the parent and discarded.
 		 */
 		val_set = 0;
-		if (ref->state != WT_REF_DISK) {
+		if (__rec_child_inmem(ref)) {
 			rp = ref->page;
 			switch (F_ISSET(rp, WT_PAGE_REC_MASK)) {
 			case WT_PAGE_REC_EMPTY:
@@ -2222,7 +2299,8 @@ __rec_row_leaf(
 		/* Build value cell. */
 		if ((val_cell = __wt_row_value(page, rip)) != NULL)
 			__wt_cell_unpack(val_cell, unpack);
-		if ((upd = WT_ROW_UPDATE(page, rip)) == NULL) {
+		upd = __rec_txn_read(r, WT_ROW_UPDATE(page, rip));
+		if (upd == NULL) {
 			/*
 			 * Copy the item off the page -- however, when the page
 			 * was read into memory, there may not have been a value
@@ -2407,8 +2485,9 @@ __rec_row_leaf_insert(WT_SESSION_IMPL *session, WT_INSERT *ins)
 	val = &r->v;
 
 	for (; ins != NULL; ins = WT_SKIP_NEXT(ins)) {
-		upd = ins->upd;				/* Build value cell. */
-		if (WT_UPDATE_DELETED_ISSET(upd))
+						/* Build value cell. */
+		if ((upd = __rec_txn_read(r, ins->upd)) == NULL ||
+		    WT_UPDATE_DELETED_ISSET(upd))
 			continue;
 		if (upd->size == 0)
 			val->len = 0;
@@ -2450,6 +2529,49 @@ __rec_row_leaf_insert(WT_SESSION_IMPL *session, WT_INSERT *ins)
 	return (0);
 }
 
+/*
+ * __rec_split_discard --
+ *	Track the blocks referenced by a split page for discard, and discard
+ * the split page.
+ */
+static int
+__rec_split_discard(WT_SESSION_IMPL *session, WT_PAGE *page, WT_PAGE *split)
+{
+	WT_PAGE_MODIFY *mod;
+	WT_REF *ref;
+	uint32_t i;
+
+	/* Discard the split page's leaf-page blocks. */
+	WT_REF_FOREACH(split, ref, i)
+		WT_RET(__wt_rec_track_block(
+		    session, WT_PT_BLOCK, page,
+		    ((WT_ADDR *)ref->addr)->addr,
+		    ((WT_ADDR *)ref->addr)->size));
+
+	/*
+	 * Split pages are usually merged into their parent and never written,
+	 * but a checkpoint writes the split page created for a root page: if
+	 * it did, discard what it wrote as well.
+	 */
+	if ((mod = split->modify) != NULL)
+		switch (F_ISSET(split, WT_PAGE_REC_MASK)) {
+		case WT_PAGE_REC_REPLACE:
+			WT_RET(__wt_rec_track_block(session, WT_PT_BLOCK,
+			    page, mod->u.replace.addr, mod->u.replace.size));
+			__wt_free(session, mod->u.replace.addr);
+			mod->u.replace.size = 0;
+			break;
+		case WT_PAGE_REC_SPLIT:
+			WT_RET(__rec_split_discard(session, page, mod->u.split));
+			mod->u.split = NULL;
+			break;
+		}
+
+	/* Discard the split page itself. */
+	__wt_page_out(session, split, 0);
+	return (0);
+}
+
 /*
  * __rec_write_wrapup  --
  *	Finish the reconciliation.
@@ -2460,7 +2582,6 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_PAGE *page)
 	WT_BOUNDARY *bnd;
 	WT_PAGE_MODIFY *mod;
 	WT_RECONCILE *r;
-	WT_REF *ref;
 	uint32_t i, size;
 	int ret;
 	const uint8_t *addr;
@@ -2501,15 +2622,8 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_PAGE *page)
 		mod->u.replace.size = 0;
 		break;
 	case WT_PAGE_REC_SPLIT:				/* Page split */
-		/* Discard the split page's leaf-page blocks. */
-		WT_REF_FOREACH(mod->u.split, ref, i)
-			WT_RET(__wt_rec_track_block(
-			    session, WT_PT_BLOCK, page,
-			    ((WT_ADDR *)ref->addr)->addr,
-			    ((WT_ADDR *)ref->addr)->size));
-
-		/* Discard the split page itself. */
-		__wt_page_out(session, mod->u.split, 0);
+		/* Discard the split page's blocks and the split page. */
+		WT_RET(__rec_split_discard(session, page, mod->u.split));
 		mod->u.split = NULL;
 		break;
 	case WT_PAGE_REC_SPLIT_MERGE:			/* Page split */
@@ -2683,7 +2797,7 @@ __rec_split_row(WT_SESSION_IMPL *session, WT_PAGE *orig, WT_PAGE **splitp)
 	/* Enter each split page into the new, internal page. */
 	for (ref = page->u.intl.t,
 	    bnd = r->bnd, i = 0; i < r->bnd_next; ++ref, ++bnd, ++i) {
-		WT_ERR(__wt_row_ikey_alloc(session, 0,
+		WT_ERR(__wt_row_ikey_alloc(session, page, 0,
 		    bnd->key.data, bnd->key.size, (WT_IKEY **)&ref->u.key));
 		WT_ERR(__wt_calloc(session, 1, sizeof(WT_ADDR), &ref->addr));
 		((WT_ADDR *)ref->addr)->addr = bnd->addr.addr;
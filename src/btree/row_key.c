@@ -318,7 +318,7 @@ next:		switch (direction) {
 	 * Allocate and initialize a WT_IKEY structure, we're instantiating
 	 * this key.
 	 */
-	WT_ERR(__wt_row_ikey_alloc(session,
+	WT_ERR(__wt_row_ikey_alloc(session, page,
 	    WT_PAGE_DISK_OFFSET(page, rip_arg->key),
 	    retb->data, retb->size, &ikey));
 
@@ -326,11 +326,12 @@ next:		switch (direction) {
 	ret = __wt_row_key_serial(session, page, rip_arg, ikey);
 
 	/*
-	 * Free the WT_IKEY structure if the serialized call didn't use it for
-	 * the key.
+	 * Return the WT_IKEY structure to the page's arena if the serialized
+	 * call didn't use it for the key.
 	 */
 	if (rip_arg->key != ikey)
-		__wt_free(session, ikey);
+		__wt_page_arena_free(
+		    session, page, ikey, sizeof(WT_IKEY) + ikey->size);
 
 	__wt_scr_free(&retb);
 
@@ -389,10 +390,11 @@ __wt_row_value(WT_PAGE *page, WT_ROW *rip)
 
 /*
  * __wt_row_ikey_alloc --
- *	Instantiate a key in a WT_IKEY structure.
+ *	Instantiate a key in a WT_IKEY structure allocated from the page's
+ *	arena.
  */
 int
-__wt_row_ikey_alloc(WT_SESSION_IMPL *session,
+__wt_row_ikey_alloc(WT_SESSION_IMPL *session, WT_PAGE *page,
     uint32_t cell_offset, const void *key, uint32_t size, WT_IKEY **ikeyp)
 {
 	WT_IKEY *ikey;
@@ -401,7 +403,8 @@ __wt_row_ikey_alloc(WT_SESSION_IMPL *session,
 	 * Allocate the WT_IKEY structure and room for the value, then copy
 	 * the value into place.
 	 */
-	WT_RET(__wt_calloc(session, 1, sizeof(WT_IKEY) + size, &ikey));
+	WT_RET(__wt_page_arena_alloc(
+	    session, page, sizeof(WT_IKEY) + size, &ikey));
 	ikey->size = size;
 	ikey->cell_offset = cell_offset;
 	memcpy(WT_IKEY_DATA(ikey), key, size);
@@ -420,19 +423,20 @@ __wt_row_key_serial_func(WT_SESSION_IMPL *session)
 	WT_IKEY *ikey;
 	WT_PAGE *page;
 	WT_ROW *rip;
+	void *key;
 
 	__wt_row_key_unpack(session, &page, &rip, &ikey);
 
 	/*
 	 * We don't care about the page's write generation -- there's a simpler
 	 * test, if the key we're interested in still needs to be instantiated,
-	 * because it can only be in one of two states.
+	 * because it can only be in one of two states.  Another thread may be
+	 * instantiating the same key: swap the key into place only if it still
+	 * references the on-page key we read.
 	 */
-	if (!__wt_off_page(page, rip->key)) {
-		rip->key = ikey;
-		__wt_cache_page_inmem_incr(
-		    session, page, sizeof(WT_IKEY) + ikey->size);
-	}
+	key = rip->key;
+	if (!__wt_off_page(page, key))
+		(void)WT_ATOMIC_CAS(rip->key, key, ikey);
 
 	__wt_session_serialize_wrapup(session, NULL, 0);
 }
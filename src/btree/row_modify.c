@@ -65,12 +65,21 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		} else
 			upd_entry = &cbt->ins->upd;
 
-		/* Allocate room for the new value from per-thread memory. */
-		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
+		/* Allocate room for the new value from the page's arena. */
+		WT_ERR(
+		    __wt_update_alloc(session, page, value, &upd, &upd_size));
+
+		/*
+		 * Link the new entry to the current head of the update list:
+		 * the serialized function only swaps the new entry into place
+		 * if the list head hasn't changed since we read it.
+		 */
+		upd->next = *upd_entry;
+		WT_ERR(__wt_txn_modify(session, upd));
 
 		/* Insert the WT_UPDATE structure. */
-		ret = __wt_update_serial(session, page, cbt->write_gen,
-		    upd_entry, &new_upd, new_upd_size, &upd, upd_size);
+		ret = __wt_update_serial(session, page,
+		    upd_entry, &new_upd, new_upd_size, upd);
 	} else {
 		/*
 		 * Allocate insert array if necessary, and set the array
@@ -107,8 +116,10 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		if (*inshead == NULL) {
 			new_inshead_size = sizeof(WT_INSERT_HEAD);
 			WT_ERR(__wt_calloc_def(session, 1, &new_inshead));
-			for (i = 0; i < WT_SKIP_MAXDEPTH; i++)
+			for (i = 0; i < WT_SKIP_MAXDEPTH; i++) {
 				cbt->ins_stack[i] = &new_inshead->head[i];
+				cbt->next_stack[i] = NULL;
+			}
 			cbt->ins_head = new_inshead;
 		}
 
@@ -120,26 +131,31 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		 * to reference it.
 		 */
 		WT_ERR(__wt_row_insert_alloc(
-		    session, key, skipdepth, &ins, &ins_size));
-		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
+		    session, page, key, skipdepth, &ins, &ins_size));
+		WT_ERR(
+		    __wt_update_alloc(session, page, value, &upd, &upd_size));
+		WT_ERR(__wt_txn_modify(session, upd));
 		ins->upd = upd;
-		ins_size += upd_size;
 		cbt->ins = ins;
 
 		/* Insert the WT_INSERT structure. */
-		ret = __wt_insert_serial(session, page, cbt->write_gen,
-		    inshead, cbt->ins_stack,
+		ret = __wt_insert_serial(session, page,
+		    inshead, cbt->ins_stack, cbt->next_stack,
 		    &new_inslist, new_inslist_size,
-		    &new_inshead, new_inshead_size,
-		    &ins, ins_size, skipdepth);
+		    &new_inshead, new_inshead_size, ins, skipdepth);
 	}
 
+	/*
+	 * Return unused structures to the page's arena, newest allocation
+	 * first.
+	 */
 	if (ret != 0) {
-err:		if (ins != NULL)
-			__wt_free(session, ins);
-		if (upd != NULL)
-			__wt_free(session, upd);
+err:		if (upd != NULL)
+			__wt_page_arena_free(session, page, upd, upd_size);
+		if (ins != NULL)
+			__wt_page_arena_free(session, page, ins, ins_size);
 	}
+	__wt_txn_modify_end(session, upd, ret);
 
 	/* Free any insert, update arrays. */
 	__wt_free(session, new_inslist);
@@ -151,11 +167,11 @@ err:		if (ins != NULL)
 
 /*
  * __wt_row_insert_alloc --
- *	Row-store insert: allocate a WT_INSERT structure from the session's
- *	buffer and fill it in.
+ *	Row-store insert: allocate a WT_INSERT structure from the page's arena
+ *	and fill it in.
  */
 int
-__wt_row_insert_alloc(WT_SESSION_IMPL *session,
+__wt_row_insert_alloc(WT_SESSION_IMPL *session, WT_PAGE *page,
     WT_ITEM *key, u_int skipdepth, WT_INSERT **insp, size_t *ins_sizep)
 {
 	WT_INSERT *ins;
@@ -167,7 +183,7 @@ __wt_row_insert_alloc(WT_SESSION_IMPL *session,
 	 */
 	ins_size = sizeof(WT_INSERT) +
 	    skipdepth * sizeof(WT_INSERT *) + key->size;
-	WT_RET(__wt_calloc(session, 1, ins_size, &ins));
+	WT_RET(__wt_page_arena_alloc(session, page, ins_size, &ins));
 
 	ins->u.key.offset = WT_STORE_SIZE(ins_size - key->size);
 	WT_INSERT_KEY_SIZE(ins) = key->size;
@@ -186,74 +202,96 @@ __wt_row_insert_alloc(WT_SESSION_IMPL *session,
 void
 __wt_insert_serial_func(WT_SESSION_IMPL *session)
 {
-	WT_INSERT *new_ins, ***ins_stack;
-	WT_INSERT_HEAD **inshead, **new_inslist, *new_inshead;
+	WT_INSERT *new_ins, ***ins_stack, **next_stack;
+	WT_INSERT_HEAD **inshead, ***inslistp, **new_inslist, *new_inshead;
 	WT_PAGE *page;
-	uint32_t write_gen;
 	u_int i, skipdepth;
-	int  ret;
-
-	ret = 0;
+	int locked, ret;
 
-	__wt_insert_unpack(session, &page, &write_gen, &inshead,
-	    &ins_stack, &new_inslist, &new_inshead, &new_ins, &skipdepth);
+	locked = ret = 0;
 
-	/* Check the page's write-generation. */
-	WT_ERR(__wt_page_write_gen_check(page, write_gen));
+	__wt_insert_unpack(session, &page, &inshead, &ins_stack,
+	    &next_stack, &new_inslist, &new_inshead, &new_ins, &skipdepth);
 
 	/*
 	 * If the page does not yet have an insert array, our caller passed
-	 * us one.
+	 * us one.  If another thread installed an insert array first, our
+	 * insert head references the array we allocated, restart.
 	 */
-	if (page->type == WT_PAGE_ROW_LEAF) {
-		if (page->u.row.ins == NULL) {
-			page->u.row.ins = new_inslist;
-			__wt_insert_new_inslist_taken(session, page);
-		}
-	} else
-		if (page->modify->update == NULL) {
-			page->modify->update = new_inslist;
-			__wt_insert_new_inslist_taken(session, page);
-		}
+	if (new_inslist != NULL) {
+		inslistp = page->type == WT_PAGE_ROW_LEAF ?
+		    &page->u.row.ins : &page->modify->update;
+		if (!WT_ATOMIC_CAS(*inslistp, NULL, new_inslist))
+			WT_ERR(WT_RESTART);
+		__wt_insert_new_inslist_taken(session, page);
+	}
 
 	/*
 	 * If the insert head does not yet have an insert list, our caller
-	 * passed us one.
+	 * passed us one.  If another thread installed an insert list first,
+	 * our skiplist stack references the list we allocated, restart.
 	 */
-	if (*inshead == NULL) {
-		*inshead = new_inshead;
+	if (new_inshead != NULL) {
+		if (!WT_ATOMIC_CAS(*inshead, NULL, new_inshead))
+			WT_ERR(WT_RESTART);
 		__wt_insert_new_inshead_taken(session, page);
 	}
 
 	/*
-	 * Publish: First, point the new WT_INSERT item's skiplist references
-	 * to the next elements in the insert list, then flush memory.  Second,
-	 * update the skiplist elements that reference the new WT_INSERT item,
-	 * this ensures the list is never inconsistent.
+	 * If our search found no insert list, but another thread has since
+	 * created one, our skiplist stack doesn't reference it, restart.
+	 */
+	if (ins_stack[0] == NULL)
+		WT_ERR(WT_RESTART);
+
+	/*
+	 * Point the new WT_INSERT item's skiplist references to the next
+	 * elements in the insert list, as they were when our search built
+	 * the stack.  If the new item is the last item on any level of the
+	 * skiplist, the list's tail pointers have to be updated, and that
+	 * requires the page lock.
 	 */
 	for (i = 0; i < skipdepth; i++)
-		new_ins->next[i] = *ins_stack[i];
-	WT_WRITE_BARRIER();
+		if ((new_ins->next[i] = next_stack[i]) == NULL)
+			locked = 1;
+	if (locked)
+		WT_PAGE_LOCK(session, page);
+
+	/*
+	 * Publish: update the skiplist elements that reference the new item,
+	 * from the bottom level up, so the list is never inconsistent.  The
+	 * compare-and-swap is a full barrier, the new item's next pointers
+	 * are flushed before the item is linked into the list.
+	 *
+	 * If the element we read during our search has changed, another
+	 * thread inserted an item in the same place.  If that happens on the
+	 * bottom level, the item isn't in the list, restart.  If it happens on
+	 * any other level, the levels below are sufficient, stop: the item is
+	 * in the list, it will just be found a little more slowly.
+	 */
 	for (i = 0; i < skipdepth; i++) {
-		if ((*inshead)->tail[i] == NULL ||
-		    ins_stack[i] == &(*inshead)->tail[i]->next[i])
+		if (!WT_ATOMIC_CAS(*ins_stack[i], new_ins->next[i], new_ins)) {
+			if (i == 0)
+				WT_ERR(WT_RESTART);
+			break;
+		}
+		if (new_ins->next[i] == NULL)
 			(*inshead)->tail[i] = new_ins;
-		*ins_stack[i] = new_ins;
 	}
 
-	__wt_insert_new_ins_taken(session, page);
-
-err:	__wt_session_serialize_wrapup(session, page, ret);
+err:	if (locked)
+		WT_PAGE_UNLOCK(session, page);
+	__wt_session_serialize_wrapup(session, page, ret);
 }
 
 /*
  * __wt_update_alloc --
- *	Allocate a WT_UPDATE structure and associated value from the session's
- *	buffer and fill it in.
+ *	Allocate a WT_UPDATE structure and associated value from the page's
+ *	arena and fill it in.
  */
 int
 __wt_update_alloc(WT_SESSION_IMPL *session,
-    WT_ITEM *value, WT_UPDATE **updp, size_t *sizep)
+    WT_PAGE *page, WT_ITEM *value, WT_UPDATE **updp, size_t *sizep)
 {
 	WT_UPDATE *upd;
 	size_t size;
@@ -263,7 +301,9 @@ __wt_update_alloc(WT_SESSION_IMPL *session,
 	 * the value into place.
 	 */
 	size = value == NULL ? 0 : value->size;
-	WT_RET(__wt_calloc(session, 1, sizeof(WT_UPDATE) + size, &upd));
+	WT_RET(__wt_page_arena_alloc(
+	    session, page, sizeof(WT_UPDATE) + size, &upd));
+	upd->txnid = WT_TXN_NONE;
 	if (value == NULL)
 		WT_UPDATE_DELETED_SET(upd);
 	else {
@@ -286,36 +326,34 @@ __wt_update_serial_func(WT_SESSION_IMPL *session)
 {
 	WT_PAGE *page;
 	WT_UPDATE **new_upd, *upd, **upd_entry;
-	uint32_t write_gen;
 	int ret;
 
 	ret = 0;
 
-	__wt_update_unpack(
-	    session, &page, &write_gen, &upd_entry, &new_upd, &upd);
-
-	/* Check the page's write-generation. */
-	WT_ERR(__wt_page_write_gen_check(page, write_gen));
+	__wt_update_unpack(session, &page, &upd_entry, &new_upd, &upd);
 
 	/*
 	 * If the page needs an update array (column-store pages and inserts on
 	 * row-store pages do not use the update array), our caller passed us
-	 * one of the correct size.   Check the page still needs one (the write
-	 * generation test should have caught that, though).
+	 * one of the correct size.  If another thread installed an update
+	 * array first, our update entry references the array we allocated,
+	 * restart.
 	 */
-	if (new_upd != NULL && page->u.row.upd == NULL) {
-		page->u.row.upd = new_upd;
+	if (new_upd != NULL) {
+		if (!WT_ATOMIC_CAS(page->u.row.upd, NULL, new_upd))
+			WT_ERR(WT_RESTART);
 		__wt_update_new_upd_taken(session, page);
 	}
 
-	upd->next = *upd_entry;
 	/*
-	 * Publish: there must be a barrier to ensure the new entry's next
-	 * pointer is set before we update the linked list.
+	 * Publish: our caller set the new entry's next pointer to the head of
+	 * the list it read.  The compare-and-swap is a full barrier, the next
+	 * pointer is flushed before the list is updated.  If the head of the
+	 * list has changed, another thread updated the entry since our search,
+	 * restart.
 	 */
-	WT_PUBLISH(*upd_entry, upd);
-
-	__wt_update_upd_taken(session, page);
+	if (!WT_ATOMIC_CAS(*upd_entry, upd->next, upd))
+		WT_ERR(WT_RESTART);
 
 err:	__wt_session_serialize_wrapup(session, page, ret);
 }
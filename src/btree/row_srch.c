@@ -20,21 +20,45 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 	WT_ITEM insert_key;
 	int cmp, i;
 
-	/* If there's no insert chain to search, we're done. */
-	if ((ret_ins = WT_SKIP_LAST(inshead)) == NULL)
+	/*
+	 * If there's no insert chain to search, we're done.  Clear the stack
+	 * so modifying threads know it doesn't reference the list, one might
+	 * be created before they get to it.  An insert chain can be empty (if
+	 * the first insert into it was restarted), in which case the stack
+	 * references the chain's head.
+	 */
+	if ((ret_ins = WT_SKIP_LAST(inshead)) == NULL) {
+		for (i = 0; i < WT_SKIP_MAXDEPTH; i++) {
+			cbt->ins_stack[i] =
+			    inshead == NULL ? NULL : &inshead->head[i];
+			cbt->next_stack[i] = NULL;
+		}
 		return (NULL);
+	}
 
 	btree = session->btree;
 
-	/* Fast-path appends. */
+	/*
+	 * Fast-path appends.
+	 *
+	 * We may race with another appending thread, and the list's tail
+	 * pointers may not yet reference its new item.  Build the bottom level
+	 * of the stack from the item we compared, and set the next stack to
+	 * NULL: if we raced, the bottom level's next pointer won't be NULL
+	 * when it's checked by the serialized insert function.
+	 */
 	insert_key.data = WT_INSERT_KEY(ret_ins);
 	insert_key.size = WT_INSERT_KEY_SIZE(ret_ins);
 	(void)WT_BTREE_CMP(session, btree, srch_key, &insert_key, cmp);
 	if (cmp >= 0) {
-		for (i = WT_SKIP_MAXDEPTH - 1; i >= 0; i--)
+		for (i = WT_SKIP_MAXDEPTH - 1; i > 0; i--) {
 			cbt->ins_stack[i] = (inshead->tail[i] != NULL) ?
 			    &inshead->tail[i]->next[i] :
 			    &inshead->head[i];
+			cbt->next_stack[i] = NULL;
+		}
+		cbt->ins_stack[0] = &ret_ins->next[0];
+		cbt->next_stack[0] = NULL;
 		cbt->compare = -cmp;
 		return (ret_ins);
 	}
@@ -46,6 +70,7 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 	ret_ins = NULL;
 	for (i = WT_SKIP_MAXDEPTH - 1, insp = &inshead->head[i]; i >= 0; ) {
 		if (*insp == NULL) {
+			cbt->next_stack[i] = NULL;
 			cbt->ins_stack[i--] = insp--;
 			continue;
 		}
@@ -65,10 +90,14 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 		if (cmp > 0)		/* Keep going at this level */
 			insp = &ret_ins->next[i];
 		else if (cmp == 0)
-			for (; i >= 0; i--)
+			for (; i >= 0; i--) {
+				cbt->next_stack[i] = ret_ins->next[i];
 				cbt->ins_stack[i] = &ret_ins->next[i];
-		else			/* Drop down a level */
+			}
+		else {			/* Drop down a level */
+			cbt->next_stack[i] = ret_ins;
 			cbt->ins_stack[i--] = insp--;
+		}
 	}
 
 	/*
@@ -158,17 +187,13 @@ __wt_row_search(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_modify)
 	}
 
 	/*
-	 * Copy the leaf page's write generation value before reading the page.
-	 * Use a read memory barrier to ensure we read the value before we read
-	 * any of the page's contents.
+	 * Initialize the page's modification information before modifying the
+	 * page: it holds the per-page lock serializing changes to the page's
+	 * skiplist tails.
 	 */
-	if (is_modify) {
-		/* Initialize the page's modification information */
+	if (is_modify)
 		WT_RET(__wt_page_modify_init(session, page));
 
-		WT_ORDERED_READ(cbt->write_gen, page->modify->write_gen);
-	}
-
 	/* Do a binary search of the leaf page. */
 	for (base = 0, limit = page->entries; limit != 0; limit >>= 1) {
 		indx = base + (limit >> 1);
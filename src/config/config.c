@@ -580,11 +580,22 @@ __wt_config_get(WT_SESSION_IMPL *session,
     const char **cfg, WT_CONFIG_ITEM *key, WT_CONFIG_ITEM *value)
 {
 	WT_CONFIG cparser;
+	WT_CONFIG_PARSED *cp;
 	int found, ret;
 
 	for (found = 0; *cfg != NULL; cfg++) {
-		WT_RET(__wt_config_init(session, &cparser, *cfg));
-		if ((ret = __wt_config_getraw(&cparser, key, value)) == 0)
+		/*
+		 * Look the key up in the parsed form of the string if there
+		 * is one, otherwise scan the string.
+		 */
+		WT_RET(__wt_config_cache_get(session, *cfg, &cp));
+		if (cp != NULL)
+			ret = __wt_config_cache_find(cp, *cfg, key, value);
+		else {
+			WT_RET(__wt_config_init(session, &cparser, *cfg));
+			ret = __wt_config_getraw(&cparser, key, value);
+		}
+		if (ret == 0)
 			found = 1;
 		else if (ret != WT_NOTFOUND)
 			return (ret);
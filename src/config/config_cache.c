@@ -0,0 +1,348 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __config_hash --
+ *	Hash a configuration key: keys are matched without regard to case.
+ */
+static inline uint64_t
+__config_hash(const char *key, size_t len)
+{
+	uint64_t hash;
+
+	for (hash = 0xcbf29ce484222325ULL; len > 0; --len, ++key) {
+		hash ^= (uint8_t)tolower((u_char)*key);
+		hash *= 0x100000001b3ULL;
+	}
+	return (hash);
+}
+
+/*
+ * __config_slot --
+ *	Return the hash table slot for a key: either the slot holding the key,
+ * or the empty slot where it belongs.
+ */
+static inline WT_CONFIG_PARSED_ITEM *
+__config_slot(WT_CONFIG_PARSED *cp, const char *key, size_t len)
+{
+	WT_CONFIG_PARSED_ITEM *item;
+	u_int i;
+
+	for (i = (u_int)__config_hash(key, len);; ++i) {
+		item = &cp->slots[i & (cp->nslots - 1)];
+		if (item->klen == 0 || (item->klen == len &&
+		    strncasecmp(cp->copy + item->koff, key, len) == 0))
+			return (item);
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __config_free --
+ *	Free a parsed configuration string.
+ */
+static void
+__config_free(WT_SESSION_IMPL *session, WT_CONFIG_PARSED *cp)
+{
+	if (cp == NULL)
+		return;
+	__wt_free(session, cp->copy);
+	__wt_free(session, cp->slots);
+	__wt_free(session, cp);
+}
+
+/*
+ * __config_parse --
+ *	Parse a configuration string into a hash table of its keys.
+ */
+static int
+__config_parse(
+    WT_SESSION_IMPL *session, const char *str, WT_CONFIG_PARSED **cpp)
+{
+	WT_CONFIG parser;
+	WT_CONFIG_ITEM k, v;
+	WT_CONFIG_PARSED *cp;
+	WT_CONFIG_PARSED_ITEM *item;
+	u_int nkeys;
+	int ret;
+
+	*cpp = NULL;
+
+	WT_RET(__wt_calloc_def(session, 1, &cp));
+	cp->len = strlen(str);
+	WT_ERR(__wt_strndup(session, str, cp->len, &cp->copy));
+	cp->str = str;
+
+	/*
+	 * Count the keys, then size the table so it's never more than half
+	 * full, which keeps the probe sequences short.
+	 */
+	WT_ERR(__wt_config_initn(session, &parser, cp->copy, cp->len));
+	for (nkeys = 0; (ret = __wt_config_next(&parser, &k, &v)) == 0;)
+		++nkeys;
+	if (ret != WT_NOTFOUND)
+		goto err;
+	for (cp->nslots = 8; cp->nslots < nkeys * 2; cp->nslots <<= 1)
+		;
+	WT_ERR(__wt_calloc_def(session, cp->nslots, &cp->slots));
+
+	/*
+	 * Insert the keys: a key can appear more than once, and the last value
+	 * wins, the same as a scan of the string.  Only string and identifier
+	 * keys can be looked up.
+	 */
+	WT_ERR(__wt_config_initn(session, &parser, cp->copy, cp->len));
+	while ((ret = __wt_config_next(&parser, &k, &v)) == 0) {
+		if ((k.type != ITEM_STRING && k.type != ITEM_ID) || k.len == 0)
+			continue;
+		item = __config_slot(cp, k.str, k.len);
+		item->koff = WT_PTRDIFF(k.str, cp->copy);
+		item->klen = k.len;
+		/*
+		 * Values are stored as offsets into the string, except for
+		 * the parser's default value for keys without one.
+		 */
+		item->value = v;
+		if (v.str >= cp->copy && v.str <= cp->copy + cp->len) {
+			item->voff = WT_PTRDIFF(v.str, cp->copy);
+			item->value.str = NULL;
+		}
+	}
+	if (ret != WT_NOTFOUND)
+		goto err;
+
+	*cpp = cp;
+	return (0);
+
+err:	__config_free(session, cp);
+	return (ret);
+}
+
+/*
+ * __config_compiled --
+ *	Return the compiled configuration for a string pointer, if any.
+ */
+static inline WT_CONFIG_PARSED *
+__config_compiled(WT_CONNECTION_IMPL *conn, const char *str)
+{
+	WT_CONFIG_PARSED *cp;
+	u_int cnt, i;
+
+	/*
+	 * The table is searched without locking: entries are published before
+	 * the count, read them in the opposite order.
+	 */
+	WT_ORDERED_READ(cnt, conn->config_compiled_cnt);
+	if (cnt == 0)
+		return (NULL);
+	for (i = (u_int)__wt_hash_fnv64(&str, sizeof(str));; ++i) {
+		WT_ORDERED_READ(
+		    cp, conn->config_compiled[i % WT_CONFIG_COMPILED_SLOTS]);
+		if (cp == NULL || cp->str == str)
+			return (cp);
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __wt_config_cache_get --
+ *	Return the parsed form of a configuration string, or NULL if the string
+ * can't be cached.
+ *
+ * Compiled strings are found by pointer.  Otherwise, the session's cache of
+ * recently parsed strings is keyed by both pointer and contents: applications
+ * commonly pass the same string (or re-use the same buffer) in a loop, and
+ * checking the contents catches a buffer holding a different string.
+ */
+int
+__wt_config_cache_get(
+    WT_SESSION_IMPL *session, const char *str, WT_CONFIG_PARSED **cpp)
+{
+	WT_CONFIG_PARSED *cp, **slot;
+	WT_CONNECTION_IMPL *conn;
+	u_int i;
+
+	*cpp = NULL;
+
+	/*
+	 * Nothing is cached before the connection is set up, and the default
+	 * session is shared by threads calling connection methods, so it has
+	 * no cache of its own.
+	 */
+	if (session == NULL || (conn = S2C(session)) == NULL)
+		return (0);
+	if ((*cpp = __config_compiled(conn, str)) != NULL)
+		return (0);
+	if (session == &conn->default_session)
+		return (0);
+
+	slot = &session->config_cache[0];
+	for (i = 0; i < WT_CONFIG_CACHE_SIZE; ++i) {
+		if ((cp = session->config_cache[i]) == NULL) {
+			slot = &session->config_cache[i];
+			break;
+		}
+		if (cp->str == str && strcmp(cp->copy, str) == 0) {
+			cp->lru = ++session->config_cache_gen;
+			WT_CSTAT_INCR(session, config_cache_hit);
+			*cpp = cp;
+			return (0);
+		}
+		if (cp->lru < (*slot)->lru)
+			slot = &session->config_cache[i];
+	}
+
+	/* Replace an empty slot or the least-recently used entry. */
+	WT_CSTAT_INCR(session, config_cache_miss);
+	WT_RET(__config_parse(session, str, &cp));
+	__config_free(session, *slot);
+	cp->lru = ++session->config_cache_gen;
+	*slot = *cpp = cp;
+	return (0);
+}
+
+/*
+ * __wt_config_cache_find --
+ *	Find a key in a parsed configuration string.
+ */
+int
+__wt_config_cache_find(WT_CONFIG_PARSED *cp,
+    const char *str, WT_CONFIG_ITEM *key, WT_CONFIG_ITEM *value)
+{
+	WT_CONFIG_PARSED_ITEM *item;
+
+	if (key->len == 0)
+		return (WT_NOTFOUND);
+	item = __config_slot(cp, key->str, key->len);
+	if (item->klen == 0)
+		return (WT_NOTFOUND);
+
+	/*
+	 * The cached string has the same contents as the caller's string:
+	 * return a value referencing the caller's copy.
+	 */
+	*value = item->value;
+	if (value->str == NULL)
+		value->str = str + item->voff;
+	return (0);
+}
+
+/*
+ * __wt_config_cache_checked --
+ *	Return if a configuration string has been validated against a check
+ * string, optionally marking it validated.
+ */
+int
+__wt_config_cache_checked(WT_SESSION_IMPL *session,
+    const char *checks, const char *config, int set, int *checkedp)
+{
+	WT_CONFIG_PARSED *cp;
+
+	*checkedp = 0;
+
+	WT_RET(__wt_config_cache_get(session, config, &cp));
+	if (cp == NULL)
+		return (0);
+	/* Compiled strings are shared, and are never modified. */
+	if (set && cp->checked != checks &&
+	    __config_compiled(S2C(session), config) == NULL)
+		cp->checked = checks;
+	*checkedp = (cp->checked == checks);
+	return (0);
+}
+
+/*
+ * __wt_config_cache_discard --
+ *	Discard a session's cache of parsed configuration strings.
+ */
+void
+__wt_config_cache_discard(WT_SESSION_IMPL *session)
+{
+	u_int i;
+
+	for (i = 0; i < WT_CONFIG_CACHE_SIZE; ++i) {
+		__config_free(session, session->config_cache[i]);
+		session->config_cache[i] = NULL;
+	}
+}
+
+/*
+ * __wt_config_compile --
+ *	Validate a configuration string for a method and compile it, returning
+ * a handle that can be passed to the method in place of the string.
+ */
+int
+__wt_config_compile(WT_SESSION_IMPL *session,
+    const char *method, const char *config, const char **compiledp)
+{
+	WT_CONFIG_METHOD *cm;
+	WT_CONFIG_PARSED *cp;
+	WT_CONNECTION_IMPL *conn;
+	u_int i;
+	int ret;
+
+	conn = S2C(session);
+	cp = NULL;
+	ret = 0;
+
+	for (cm = __wt_config_methods; cm->method != NULL; ++cm)
+		if (strcmp(cm->method, method) == 0)
+			break;
+	if (cm->method == NULL)
+		WT_RET_MSG(session, EINVAL, "unknown method '%s'", method);
+	WT_RET(__wt_config_check(session, *cm->checks, config));
+
+	/*
+	 * The handle is the compiled copy of the string: it's a valid
+	 * configuration string wherever it's passed, and it's found in the
+	 * compiled table by pointer.
+	 */
+	WT_RET(__config_parse(session, config, &cp));
+	cp->str = cp->copy;
+	cp->checked = *cm->checks;
+
+	__wt_spin_lock(session, &conn->spinlock);
+	if (conn->config_compiled_cnt == WT_CONFIG_COMPILED_MAX)
+		WT_ERR_MSG(session, ENOMEM,
+		    "too many compiled configuration strings, the maximum "
+		    "is %d", WT_CONFIG_COMPILED_MAX);
+	for (i = (u_int)__wt_hash_fnv64(&cp->str, sizeof(cp->str));; ++i)
+		if (conn->config_compiled[i % WT_CONFIG_COMPILED_SLOTS] == NULL)
+			break;
+	/*
+	 * Readers search the table without locking, publish the entry before
+	 * updating the count they check.
+	 */
+	WT_PUBLISH(conn->config_compiled[i % WT_CONFIG_COMPILED_SLOTS], cp);
+	WT_PUBLISH(conn->config_compiled_cnt, conn->config_compiled_cnt + 1);
+	*compiledp = cp->str;
+	cp = NULL;
+
+err:	__wt_spin_unlock(session, &conn->spinlock);
+	__config_free(session, cp);
+	return (ret);
+}
+
+/*
+ * __wt_config_compile_discard --
+ *	Discard the connection's compiled configuration strings.
+ */
+void
+__wt_config_compile_discard(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	u_int i;
+
+	conn = S2C(session);
+	for (i = 0; i < WT_CONFIG_COMPILED_SLOTS; ++i) {
+		__config_free(session, conn->config_compiled[i]);
+		conn->config_compiled[i] = NULL;
+	}
+	conn->config_compiled_cnt = 0;
+}
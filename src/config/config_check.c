@@ -27,6 +27,11 @@ __wt_config_check(WT_SESSION_IMPL *session,
 	if (config == NULL)
 		return (0);
 
+	/* Skip strings already validated against the same check string. */
+	WT_RET(__wt_config_cache_checked(session, checks, config, 0, &found));
+	if (found)
+		return (0);
+
 	WT_RET(__wt_config_init(session, &parser, config));
 	while ((ret = __wt_config_next(&parser, &k, &v)) == 0) {
 		if (k.type != ITEM_STRING && k.type != ITEM_ID)
@@ -113,8 +118,10 @@ __wt_config_check(WT_SESSION_IMPL *session,
 		}
 	}
 
-	if (ret == WT_NOTFOUND)
-		ret = 0;
+	if (ret == WT_NOTFOUND) {
+		ret = __wt_config_cache_checked(
+		    session, checks, config, 1, &found);
+	}
 
 	return (ret);
 }
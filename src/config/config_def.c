@@ -60,11 +60,23 @@ __wt_confchk_connection_load_extension =
 
 const char *
 __wt_confdfl_connection_open_session =
-    "";
+    "cache_cursors=false";
 
 const char *
 __wt_confchk_connection_open_session =
-    "";
+    "cache_cursors=(type=boolean)";
+
+const char *
+__wt_confdfl_connection_reconfigure =
+    "cache_size=100MB,eviction_dirty_target=40,eviction_dirty_trigger=60,"
+    "eviction_target=80,eviction_trigger=95,hazard_max=30";
+
+const char *
+__wt_confchk_connection_reconfigure =
+    "cache_size=(type=int,min=1MB,max=10TB),eviction_dirty_target=(type=int,"
+    "min=5,max=99),eviction_dirty_trigger=(type=int,min=5,max=99),"
+    "eviction_target=(type=int,min=10,max=99),eviction_trigger=(type=int,"
+    "min=10,max=99),hazard_max=(type=int,min=15)";
 
 const char *
 __wt_confdfl_cursor_close =
@@ -76,8 +88,9 @@ __wt_confchk_cursor_close =
 
 const char *
 __wt_confdfl_file_meta =
-    "allocation_size=512B,block_compressor="",checksum=true,collator="","
-    "columns=(),huffman_key="",huffman_value="",internal_item_max=0,"
+    "allocation_size=512B,block_compressor="",cache_max=0,cache_min=0,"
+    "cache_priority=0,checkpoint_lsn=0,checksum=true,collator="",columns=(),"
+    "huffman_key="",huffman_value="",id=0,internal_item_max=0,"
     "internal_key_truncate=true,internal_page_max=2KB,key_format=u,key_gap=10"
     ",leaf_item_max=0,leaf_page_max=1MB,prefix_compression=true,root="","
     "split_pct=75,type=btree,value_format=u,version=(major=0,minor=0)";
@@ -85,8 +98,10 @@ __wt_confdfl_file_meta =
 const char *
 __wt_confchk_file_meta =
     "allocation_size=(type=int,min=512B,max=128MB),block_compressor=(),"
+    "cache_max=(type=int,min=0),cache_min=(type=int,min=0),"
+    "cache_priority=(type=int,min=-100,max=100),checkpoint_lsn=(),"
     "checksum=(type=boolean),collator=(),columns=(type=list),huffman_key=(),"
-    "huffman_value=(),internal_item_max=(type=int,min=0),"
+    "huffman_value=(),id=(),internal_item_max=(type=int,min=0),"
     "internal_key_truncate=(type=boolean),internal_page_max=(type=int,"
     "min=512B,max=512MB),key_format=(type=format),key_gap=(type=int,min=0),"
     "leaf_item_max=(type=int,min=0),leaf_page_max=(type=int,min=512B,"
@@ -110,7 +125,7 @@ const char *
 __wt_confchk_session_begin_transaction =
     "isolation=(choices=[\"serializable\",\"snapshot\",\"read-committed\","
     "\"read-uncommitted\"]),name=(),priority=(type=int,min=-100,max=100),"
-    "sync=(choices=[\"full\",\"flush\",\"write\",\"none\"])";
+    "sync=(choices=[\"full\",\"background\",\"write\",\"none\"])";
 
 const char *
 __wt_confdfl_session_checkpoint =
@@ -141,21 +156,23 @@ __wt_confchk_session_commit_transaction =
 
 const char *
 __wt_confdfl_session_create =
-    "allocation_size=512B,block_compressor="",checksum=true,colgroups=(),"
-    "collator="",columns=(),columns=(),exclusive=false,filename="","
-    "huffman_key="",huffman_value="",internal_item_max=0,"
-    "internal_key_truncate=true,internal_page_max=2KB,key_format=u,"
-    "key_format=u,key_gap=10,leaf_item_max=0,leaf_page_max=1MB,"
+    "allocation_size=512B,block_compressor="",cache_max=0,cache_min=0,"
+    "cache_priority=0,checksum=true,colgroups=(),collator="",columns=(),"
+    "columns=(),exclusive=false,filename="",huffman_key="",huffman_value="","
+    "internal_item_max=0,internal_key_truncate=true,internal_page_max=2KB,"
+    "key_format=u,key_format=u,key_gap=10,leaf_item_max=0,leaf_page_max=1MB,"
     "prefix_compression=true,split_pct=75,type=btree,value_format=u,"
     "value_format=u";
 
 const char *
 __wt_confchk_session_create =
     "allocation_size=(type=int,min=512B,max=128MB),block_compressor=(),"
-    "checksum=(type=boolean),colgroups=(type=list),collator=(),"
-    "columns=(type=list),columns=(type=list),exclusive=(type=boolean),"
-    "filename=(),huffman_key=(),huffman_value=(),internal_item_max=(type=int,"
-    "min=0),internal_key_truncate=(type=boolean),internal_page_max=(type=int,"
+    "cache_max=(type=int,min=0),cache_min=(type=int,min=0),"
+    "cache_priority=(type=int,min=-100,max=100),checksum=(type=boolean),"
+    "colgroups=(type=list),collator=(),columns=(type=list),"
+    "columns=(type=list),exclusive=(type=boolean),filename=(),huffman_key=(),"
+    "huffman_value=(),internal_item_max=(type=int,min=0),"
+    "internal_key_truncate=(type=boolean),internal_page_max=(type=int,"
     "min=512B,max=512MB),key_format=(type=format),key_format=(type=format),"
     "key_gap=(type=int,min=0),leaf_item_max=(type=int,min=0),"
     "leaf_page_max=(type=int,min=512B,max=512MB),"
@@ -225,10 +242,18 @@ __wt_confchk_session_salvage =
 
 const char *
 __wt_confdfl_session_sync =
-    "";
+    "threads=1";
 
 const char *
 __wt_confchk_session_sync =
+    "threads=(type=int,min=1,max=64)";
+
+const char *
+__wt_confdfl_session_transaction_sync =
+    "";
+
+const char *
+__wt_confchk_session_transaction_sync =
     "";
 
 const char *
@@ -266,21 +291,106 @@ __wt_confchk_table_meta =
 
 const char *
 __wt_confdfl_wiredtiger_open =
-    "buffer_alignment=-1,cache_size=100MB,create=false,direct_io=(),"
-    "error_prefix="",eviction_target=80,eviction_trigger=95,extensions=(),"
+    "buffer_alignment=-1,cache_cursors=false,cache_size=100MB,"
+    "cache_warm=false,cache_warm_fill=80,cache_warm_threads=2,create=false,"
+    "direct_io=(),error_prefix="",eviction_cleaners=0,"
+    "eviction_dirty_target=40,eviction_dirty_trigger=60,eviction_policy=lru,"
+    "eviction_target=80,eviction_trigger=95,eviction_workers=0,extensions=(),"
     "hazard_max=30,home_environment=false,home_environment_priv=false,"
-    "logging=false,multiprocess=false,session_max=50,transactional=false,"
-    "verbose=()";
+    "log_compressor="",log_file_size=100MB,log_flush_bytes=1MB,"
+    "log_flush_period=100,logging=false,multiprocess=false,"
+    "page_reclaim=hazard,read_ahead=0,read_threads=2,recovery_threads=4,"
+    "session_max=50,statistics=true,transactional=false,verbose=(),"
+    "write_threads=0";
 
 const char *
 __wt_confchk_wiredtiger_open =
-    "buffer_alignment=(type=int,min=-1,max=1MB),cache_size=(type=int,min=1MB,"
-    "max=10TB),create=(type=boolean),direct_io=(type=list,choices=[\"data\","
-    "\"log\"]),error_prefix=(),eviction_target=(type=int,min=10,max=99),"
-    "eviction_trigger=(type=int,min=10,max=99),extensions=(type=list),"
-    "hazard_max=(type=int,min=15),home_environment=(type=boolean),"
-    "home_environment_priv=(type=boolean),logging=(type=boolean),"
-    "multiprocess=(type=boolean),session_max=(type=int,min=1),"
+    "buffer_alignment=(type=int,min=-1,max=1MB),cache_cursors=(type=boolean),"
+    "cache_size=(type=int,min=1MB,max=10TB),cache_warm=(type=boolean),"
+    "cache_warm_fill=(type=int,min=1,max=100),cache_warm_threads=(type=int,"
+    "min=1,max=20),create=(type=boolean),direct_io=(type=list,"
+    "choices=[\"data\",\"log\"]),error_prefix=(),eviction_cleaners=(type=int,"
+    "min=0,max=20),eviction_dirty_target=(type=int,min=5,max=99),"
+    "eviction_dirty_trigger=(type=int,min=5,max=99),"
+    "eviction_policy=(choices=[\"lru\",\"2q\",\"clockpro\"]),"
+    "eviction_target=(type=int,min=10,max=99),eviction_trigger=(type=int,"
+    "min=10,max=99),eviction_workers=(type=int,min=0,max=20),"
+    "extensions=(type=list),hazard_max=(type=int,min=15),"
+    "home_environment=(type=boolean),home_environment_priv=(type=boolean),"
+    "log_compressor=(),log_file_size=(type=int,min=1MB,max=2GB),"
+    "log_flush_bytes=(type=int,min=0),log_flush_period=(type=int,min=1,"
+    "max=60000),logging=(type=boolean),multiprocess=(type=boolean),"
+    "page_reclaim=(choices=[\"hazard\",\"epoch\"]),read_ahead=(type=int,min=0"
+    ",max=64),read_threads=(type=int,min=1,max=20),recovery_threads=(type=int"
+    ",min=1,max=64),session_max=(type=int,min=1),statistics=(type=boolean),"
     "transactional=(type=boolean),verbose=(type=list,choices=[\"block\","
     "\"evict\",\"evictserver\",\"fileops\",\"hazard\",\"mutex\",\"read\","
-    "\"readserver\",\"reconcile\",\"salvage\",\"verify\",\"write\"])";
+    "\"readserver\",\"reconcile\",\"recovery\",\"salvage\",\"verify\","
+    "\"write\"]),write_threads=(type=int,min=0,max=64)";
+
+WT_CONFIG_METHOD
+__wt_config_methods[] = {
+	{ "colgroup.meta",
+	    &__wt_confchk_colgroup_meta },
+	{ "connection.add_collator",
+	    &__wt_confchk_connection_add_collator },
+	{ "connection.add_compressor",
+	    &__wt_confchk_connection_add_compressor },
+	{ "connection.add_cursor_type",
+	    &__wt_confchk_connection_add_cursor_type },
+	{ "connection.add_extractor",
+	    &__wt_confchk_connection_add_extractor },
+	{ "connection.close",
+	    &__wt_confchk_connection_close },
+	{ "connection.load_extension",
+	    &__wt_confchk_connection_load_extension },
+	{ "connection.open_session",
+	    &__wt_confchk_connection_open_session },
+	{ "connection.reconfigure",
+	    &__wt_confchk_connection_reconfigure },
+	{ "cursor.close",
+	    &__wt_confchk_cursor_close },
+	{ "file.meta",
+	    &__wt_confchk_file_meta },
+	{ "index.meta",
+	    &__wt_confchk_index_meta },
+	{ "session.begin_transaction",
+	    &__wt_confchk_session_begin_transaction },
+	{ "session.checkpoint",
+	    &__wt_confchk_session_checkpoint },
+	{ "session.close",
+	    &__wt_confchk_session_close },
+	{ "session.commit_transaction",
+	    &__wt_confchk_session_commit_transaction },
+	{ "session.create",
+	    &__wt_confchk_session_create },
+	{ "session.drop",
+	    &__wt_confchk_session_drop },
+	{ "session.dumpfile",
+	    &__wt_confchk_session_dumpfile },
+	{ "session.log_printf",
+	    &__wt_confchk_session_log_printf },
+	{ "session.open_cursor",
+	    &__wt_confchk_session_open_cursor },
+	{ "session.rename",
+	    &__wt_confchk_session_rename },
+	{ "session.rollback_transaction",
+	    &__wt_confchk_session_rollback_transaction },
+	{ "session.salvage",
+	    &__wt_confchk_session_salvage },
+	{ "session.sync",
+	    &__wt_confchk_session_sync },
+	{ "session.transaction_sync",
+	    &__wt_confchk_session_transaction_sync },
+	{ "session.truncate",
+	    &__wt_confchk_session_truncate },
+	{ "session.upgrade",
+	    &__wt_confchk_session_upgrade },
+	{ "session.verify",
+	    &__wt_confchk_session_verify },
+	{ "table.meta",
+	    &__wt_confchk_table_meta },
+	{ "wiredtiger_open",
+	    &__wt_confchk_wiredtiger_open },
+	{ NULL, NULL }
+};
@@ -248,6 +248,77 @@ __conn_is_new(WT_CONNECTION *wt_conn)
 	return (((WT_CONNECTION_IMPL *)wt_conn)->is_new);
 }
 
+/*
+ * __conn_compile_configuration --
+ *	WT_CONNECTION->compile_configuration method.
+ */
+static int
+__conn_compile_configuration(WT_CONNECTION *wt_conn,
+    const char *method, const char *config, const char **compiledp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *session;
+	int ret;
+
+	conn = (WT_CONNECTION_IMPL *)wt_conn;
+	session = &conn->default_session;
+	API_CALL_NOCONF(session, connection, compile_configuration, NULL, NULL);
+
+	ret = __wt_config_compile(session, method, config, compiledp);
+
+	API_END_NOTFOUND_MAP(session, ret);
+}
+
+/*
+ * __conn_reconfigure --
+ *	WT_CONNECTION->reconfigure method.
+ */
+static int
+__conn_reconfigure(WT_CONNECTION *wt_conn, const char *config)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *session;
+	uint32_t hazard_size;
+	int ret;
+	const char *raw_cfg[] = { config, NULL };
+
+	conn = (WT_CONNECTION_IMPL *)wt_conn;
+	hazard_size = 0;
+
+	CONNECTION_API_CALL(conn, session, reconfigure, config, cfg);
+	WT_UNUSED(cfg);
+
+	/*
+	 * Only the values in the application's string change, look them up
+	 * without the defaults.
+	 */
+	if (config == NULL)
+		goto err;
+
+	/*
+	 * Sessions' hazard reference slots are allocated when the connection
+	 * is opened, the number used can't grow beyond that.
+	 */
+	if ((ret =
+	    __wt_config_gets(session, raw_cfg, "hazard_max", &cval)) == 0) {
+		hazard_size = (uint32_t)cval.val;
+		if (hazard_size > conn->hazard_max)
+			WT_ERR_MSG(session, EINVAL,
+			    "hazard_max cannot be reconfigured above %" PRIu32
+			    ", the value when the database was opened",
+			    conn->hazard_max);
+	} else if (ret != WT_NOTFOUND)
+		goto err;
+	ret = 0;
+
+	WT_ERR(__wt_cache_reconfigure(session, raw_cfg));
+	if (hazard_size != 0)
+		conn->hazard_size = hazard_size;
+
+err:	API_END_NOTFOUND_MAP(session, ret);
+}
+
 /*
  * __conn_close --
  *	WT_CONNECTION->close method.
@@ -268,6 +339,12 @@ __conn_close(WT_CONNECTION *wt_conn, const char *config)
 	CONNECTION_API_CALL(conn, session, close, config, cfg);
 	WT_UNUSED(cfg);
 
+	/*
+	 * Stop warming the cache before any file is closed: from now on, the
+	 * pages of closing files are saved as the working set.
+	 */
+	WT_TRET(__wt_cache_warm_stop(conn));
+
 	/* Close open sessions. */
 	for (tp = conn->sessions; (s = *tp) != NULL;) {
 		if (!F_ISSET(s, WT_SESSION_INTERNAL)) {
@@ -285,6 +362,7 @@ __conn_close(WT_CONNECTION *wt_conn, const char *config)
 
 	/* Close open btree handles. */
 	WT_TRET(__wt_conn_btree_remove(conn));
+	WT_TRET(__wt_cache_warm_save(conn));
 
 	/* Free memory for collators */
 	while ((ncoll = TAILQ_FIRST(&conn->collqh)) != NULL)
@@ -344,9 +422,11 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 		__conn_add_compressor,
 		__conn_add_extractor,
 		__conn_close,
+		__conn_reconfigure,
 		__conn_get_home,
 		__conn_is_new,
-		__conn_open_session
+		__conn_open_session,
+		__conn_compile_configuration
 	};
 	static struct {
 		const char *name;
@@ -443,9 +523,18 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	WT_ERR(__wt_config_gets(session, cfg, "cache_size", &cval));
 	conn->cache_size = cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "hazard_max", &cval));
-	conn->hazard_size = (uint32_t)cval.val;
+	conn->hazard_max = conn->hazard_size = (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "cache_cursors", &cval));
+	if (cval.val != 0)
+		F_SET(conn, WT_CACHE_CURSORS);
+	WT_ERR(__wt_config_gets(session, cfg, "page_reclaim", &cval));
+	if (strncmp(cval.str, "epoch", cval.len) == 0)
+		F_SET(conn, WT_EPOCH_RECLAIM);
 	WT_ERR(__wt_config_gets(session, cfg, "session_max", &cval));
 	conn->session_size = (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "statistics", &cval));
+	if (cval.val != 0)
+		F_SET(conn, WT_STATISTICS);
 
 	/* Configure verbose flags. */
 	conn->verbose = 0;
@@ -461,11 +550,6 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	}
 #endif
 
-	WT_ERR(__wt_config_gets(session, cfg, "logging", &cval));
-	if (cval.val != 0)
-		WT_ERR(__wt_open(
-		   session, WT_LOG_FILENAME, 1, 0, 0, &conn->log_fh));
-
 	/* Configure direct I/O and buffer alignment. */
 	WT_ERR(__wt_config_gets(session, cfg, "buffer_alignment", &cval));
 	if (cval.val == -1)
@@ -504,6 +588,11 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 		ret = 0;
 	WT_ERR(ret);
 
+	/* Open the log after the extensions add their compressors. */
+	WT_ERR(__wt_config_gets(session, cfg, "logging", &cval));
+	if (cval.val != 0)
+		WT_ERR(__wt_log_open(session, cfg));
+
 	/*
 	 * Open the connection; if that fails, the connection handle has been
 	 * destroyed by the time the open function returns.
@@ -513,6 +602,20 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 		WT_ERR(ret);
 	}
 
+	/* Replay the log and find the next file ID. */
+	if ((ret = __wt_recover(conn, cfg)) != 0) {
+		(void)conn->iface.close(&conn->iface, NULL);
+		conn = NULL;
+		WT_ERR(ret);
+	}
+
+	/* Read the working set saved by the last connection into the cache. */
+	if ((ret = __wt_cache_warm_start(conn)) != 0) {
+		(void)conn->iface.close(&conn->iface, NULL);
+		conn = NULL;
+		WT_ERR(ret);
+	}
+
 	STATIC_ASSERT(offsetof(WT_CONNECTION_IMPL, iface) == 0);
 	*wt_connp = &conn->iface;
 
@@ -7,6 +7,23 @@
 
 #include "wt_internal.h"
 
+/*
+ * __conn_btree_find --
+ *	Search the connection's hash table for an open btree file handle.
+ */
+static WT_BTREE *
+__conn_btree_find(WT_CONNECTION_IMPL *conn, const char *filename, uint64_t hash)
+{
+	WT_BTREE *btree;
+
+	for (btree = conn->bthash[hash % WT_HASH_ARRAY_SIZE];
+	    btree != NULL; btree = btree->hashnext)
+		if (btree->filename_hash == hash &&
+		    strcmp(filename, btree->filename) == 0)
+			break;
+	return (btree);
+}
+
 /*
  * __wt_conn_btree_open --
  *	Find an open btree file handle, otherwise create a new one and link it
@@ -19,12 +36,13 @@ __wt_conn_btree_open(WT_SESSION_IMPL *session,
 {
 	WT_BTREE *btree;
 	WT_CONNECTION_IMPL *conn;
-	int matched, ret;
+	uint64_t hash;
+	int ret;
 
 	conn = S2C(session);
 	ret = 0;
 
-	WT_STAT_INCR(conn->stats, file_open);
+	WT_CSTAT_INCR(session, file_open);
 
 	/*
 	 * The file configuration string must point to allocated memory: it
@@ -32,19 +50,25 @@ __wt_conn_btree_open(WT_SESSION_IMPL *session,
 	 * is closed.
 	 */
 
-	/* Increment the reference count if we already have the btree open. */
-	matched = 0;
-	__wt_spin_lock(session, &conn->spinlock);
-	TAILQ_FOREACH(btree, &conn->btqh, q) {
-		if (strcmp(filename, btree->filename) == 0) {
-			++btree->refcnt;
-			session->btree = btree;
-			matched = 1;
-			break;
-		}
+	/*
+	 * Increment the reference count if we already have the btree open.
+	 *
+	 * Btree handles are fully initialized before they are published in
+	 * the connection's hash table, and aren't removed until the connection
+	 * closes, so the search doesn't need the connection spinlock.  If the
+	 * search fails, search again holding the spinlock, another thread may
+	 * be inserting the handle, and we insert it ourselves if it's still
+	 * not found.
+	 */
+	hash = __wt_hash_fnv64(filename, strlen(filename));
+	if ((btree = __conn_btree_find(conn, filename, hash)) == NULL) {
+		__wt_spin_lock(session, &conn->spinlock);
+		if ((btree = __conn_btree_find(conn, filename, hash)) != NULL)
+			__wt_spin_unlock(session, &conn->spinlock);
 	}
-	if (matched) {
-		__wt_spin_unlock(session, &conn->spinlock);
+	if (btree != NULL) {
+		(void)WT_ATOMIC_ADD(btree->refcnt, 1);
+		session->btree = btree;
 
 		/*
 		 * Check that the handle is open.  We've already incremented
@@ -113,10 +137,16 @@ __wt_conn_btree_open(WT_SESSION_IMPL *session,
 		/* Lock the handle before it is inserted in the list. */
 		__wt_writelock(session, btree->rwlock);
 
-		/* Add to the connection list. */
+		/*
+		 * Add to the connection list and publish in the hash table:
+		 * the handle must be initialized before it can be found.
+		 */
 		btree->refcnt = 1;
 		TAILQ_INSERT_TAIL(&conn->btqh, btree, q);
 		++conn->btqcnt;
+		btree->filename_hash = hash;
+		btree->hashnext = conn->bthash[hash % WT_HASH_ARRAY_SIZE];
+		WT_PUBLISH(conn->bthash[hash % WT_HASH_ARRAY_SIZE], btree);
 	}
 	__wt_spin_unlock(session, &conn->spinlock);
 
@@ -157,15 +187,14 @@ int
 __wt_conn_btree_close(WT_SESSION_IMPL *session, int locked)
 {
 	WT_BTREE *btree;
-	WT_CONNECTION_IMPL *conn;
 	int inuse, ret;
+	const char *cfg[] = { __wt_confdfl_session_sync, NULL };
 
 	btree = session->btree;
-	conn = S2C(session);
 	ret = 0;
 
 	if (F_ISSET(btree, WT_BTREE_OPEN)) {
-		WT_STAT_DECR(conn->stats, file_open);
+		WT_CSTAT_DECR(session, file_open);
 
 		/*
 		 * If it looks like we are the last reference, sync the file.
@@ -173,21 +202,24 @@ __wt_conn_btree_close(WT_SESSION_IMPL *session, int locked)
 		 * an exclusive lock on the handle).
 		 */
 		if (btree->refcnt == 1)
-			WT_RET(__wt_btree_sync(session, NULL));
+			WT_RET(__wt_btree_sync(session, cfg));
 	}
 
 	/*
 	 * Decrement the reference count.  If we really are the last reference,
 	 * get an exclusive lock on the handle so that we can close it.
+	 *
+	 * Handle lookups don't hold the connection spinlock, so another thread
+	 * can take a new reference before we get the exclusive lock: check the
+	 * reference count again once we have it, and leave the handle open if
+	 * it is back in use.  A thread taking a reference after the check will
+	 * wait for the handle lock, find the handle closed, and reopen it.
 	 */
-	__wt_spin_lock(session, &conn->spinlock);
-	inuse = --btree->refcnt > 0;
-	if (!inuse && !locked)
-		__wt_writelock(session, btree->rwlock);
-	__wt_spin_unlock(session, &conn->spinlock);
-
+	inuse = WT_ATOMIC_ADD(btree->refcnt, -1) > 0;
 	if (!inuse) {
-		if (F_ISSET(btree, WT_BTREE_OPEN)) {
+		if (!locked)
+			__wt_writelock(session, btree->rwlock);
+		if (F_ISSET(btree, WT_BTREE_OPEN) && btree->refcnt == 0) {
 			ret = __wt_btree_close(session);
 			F_CLR(btree, WT_BTREE_OPEN);
 		}
@@ -198,6 +230,53 @@ __wt_conn_btree_close(WT_SESSION_IMPL *session, int locked)
 	return (ret);
 }
 
+/*
+ * __conn_btree_unhash --
+ *	Remove a btree file handle from the connection's hash table.  This is
+ * only done when the connection is closing and there are no other threads
+ * searching the table.
+ */
+static void
+__conn_btree_unhash(WT_CONNECTION_IMPL *conn, WT_BTREE *btree)
+{
+	WT_BTREE **btreep;
+
+	for (btreep = &conn->bthash[btree->filename_hash % WT_HASH_ARRAY_SIZE];
+	    *btreep != NULL; btreep = &(*btreep)->hashnext)
+		if (*btreep == btree) {
+			*btreep = btree->hashnext;
+			break;
+		}
+}
+
+/*
+ * __conn_btree_unlink --
+ *	Remove a btree file handle from the connection's list and hash table.
+ */
+static void
+__conn_btree_unlink(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	/*
+	 * The eviction server steps through the list holding the spinlock,
+	 * and pins each file it walks: once the handle is off the list, wait
+	 * for any walk of the file to finish.
+	 */
+	__wt_spin_lock(session, &conn->spinlock);
+	TAILQ_REMOVE(&conn->btqh, btree, q);
+	--conn->btqcnt;
+	__conn_btree_unhash(conn, btree);
+	if (conn->cache != NULL && conn->cache->evict_file == btree)
+		conn->cache->evict_file = NULL;
+	__wt_spin_unlock(session, &conn->spinlock);
+
+	while (btree->lru_count > 0)
+		__wt_yield();
+}
+
 /*
  * __conn_btree_remove --
  *	Discard a single btree file handle structure.
@@ -241,6 +320,13 @@ __wt_conn_btree_remove(WT_CONNECTION_IMPL *conn)
 	 */
 	WT_RET(__wt_open_session(conn, 1, NULL, NULL, &session));
 
+	/*
+	 * Stop the eviction server choosing pages from the files: it only
+	 * serves the requests to close them from now on.
+	 */
+	if (conn->cache != NULL)
+		conn->cache->evict_lru_stop = 1;
+
 	/*
 	 * Close open btree handles: first, everything but the schema file (as
 	 * closing a normal file may open and write the schema file), then the
@@ -253,8 +339,7 @@ restart:
 		if (strcmp(btree->filename, WT_SCHEMA_FILENAME) == 0)
 			continue;
 
-		TAILQ_REMOVE(&conn->btqh, btree, q);
-		--conn->btqcnt;
+		__conn_btree_unlink(session, btree);
 		WT_TRET(__conn_btree_remove(session, btree));
 		goto restart;
 	}
@@ -270,8 +355,7 @@ restart:
 
 	/* Close the schema file handle. */
 	while ((btree = TAILQ_FIRST(&conn->btqh)) != NULL) {
-		TAILQ_REMOVE(&conn->btqh, btree, q);
-		--conn->btqcnt;
+		__conn_btree_unlink(session, btree);
 		WT_TRET(__conn_btree_remove(session, btree));
 	}
 
@@ -15,6 +15,7 @@ int
 __wt_connection_init(WT_CONNECTION_IMPL *conn)
 {
 	WT_SESSION_IMPL *session;
+	u_int i;
 
 	session = &conn->default_session;
 
@@ -25,17 +26,29 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	TAILQ_INIT(&conn->compqh);		/* Compressor list */
 
 	/* Statistics. */
-	WT_RET(__wt_stat_alloc_connection_stats(session, &conn->stats));
+	WT_RET(__wt_stat_alloc_connection_stats(
+	    session, WT_STAT_SLOTS, &conn->stats));
 
 	/* File handle spinlock. */
 	__wt_spin_init(session, &conn->fh_lock);
 
-	/* Serialized function call spinlock. */
+	/* Eviction request spinlock. */
 	__wt_spin_init(session, &conn->serial_lock);
 
+	/* Page modification spinlocks. */
+	for (i = 0; i < WT_PAGE_LOCKS; ++i)
+		__wt_spin_init(session, &conn->page_lock[i]);
+
 	/* General purpose spinlock. */
 	__wt_spin_init(session, &conn->spinlock);
 
+	/* Epoch-based page reclamation. */
+	__wt_spin_init(session, &conn->epoch_lock);
+	conn->epoch = 1;
+
+	/* Checkpoint lock. */
+	WT_RET(__wt_rwlock_alloc(session, "checkpoint", &conn->ckpt_rwlock));
+
 	return (0);
 }
 
@@ -47,6 +60,7 @@ void
 __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 {
 	WT_SESSION_IMPL *session;
+	u_int i;
 
 	session = &conn->default_session;
 
@@ -62,8 +76,7 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	if (conn->lock_fh != NULL)
 		(void)__wt_close(session, conn->lock_fh);
 
-	if (conn->log_fh != NULL)
-		(void)__wt_close(session, conn->log_fh);
+	(void)__wt_log_close(session);
 
 	/* Remove from the list of connections. */
 	__wt_spin_lock(session, &__wt_process.spinlock);
@@ -72,9 +85,16 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 
 	__wt_spin_destroy(session, &conn->fh_lock);
 	__wt_spin_destroy(session, &conn->serial_lock);
+	for (i = 0; i < WT_PAGE_LOCKS; ++i)
+		__wt_spin_destroy(session, &conn->page_lock[i]);
 	__wt_spin_destroy(session, &conn->spinlock);
+	__wt_spin_destroy(session, &conn->epoch_lock);
+	if (conn->ckpt_rwlock != NULL)
+		(void)__wt_rwlock_destroy(session, conn->ckpt_rwlock);
 
 	/* Free allocated memory. */
+	__wt_config_compile_discard(session);
+	__wt_txn_global_destroy(conn);
 	__wt_free(session, conn->home);
 	__wt_free(session, conn->sessions);
 	__wt_free(session, conn->session_array);
@@ -14,7 +14,11 @@
 int
 __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 {
+	WT_CACHE *cache;
+	WT_EVICT_WORKER *worker;
 	WT_SESSION_IMPL *session;
+	WT_WRITE_QUEUE *wq;
+	u_int i;
 	int ret;
 
 	/* Default session. */
@@ -30,12 +34,18 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	    conn->session_size, sizeof(WT_SESSION_IMPL),
 	    &conn->session_array));
 	WT_ERR(__wt_calloc(session,
-	   conn->session_size * conn->hazard_size, sizeof(WT_HAZARD),
+	   conn->session_size * conn->hazard_max, sizeof(WT_HAZARD),
 	   &conn->hazard));
 
+	/* Transaction table. */
+	WT_ERR(__wt_txn_global_init(conn));
+
 	/* Create the cache. */
 	WT_ERR(__wt_cache_create(conn, cfg));
 
+	/* Create the block write queue. */
+	WT_ERR(__wt_write_queue_create(conn, cfg));
+
 	/*
 	 * Publish: there must be a barrier to ensure the connection structure
 	 * fields are set before other threads read from the pointer.
@@ -46,6 +56,27 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	F_SET(conn, WT_SERVER_RUN);
 	WT_ERR(__wt_thread_create(
 	    &conn->cache_evict_tid, __wt_cache_evict_server, conn));
+	cache = conn->cache;
+	for (i = 0, worker = cache->workers;
+	    i < cache->eviction_workers; ++i, ++worker)
+		WT_ERR(__wt_thread_create(
+		    &worker->tid, __wt_cache_evict_worker, worker));
+	for (i = 0; i < cache->eviction_cleaners; ++i)
+		WT_ERR(__wt_thread_create(
+		    &cache->clean_tids[i], __wt_cache_clean_server, conn));
+	for (i = 0; i < cache->read_threads; ++i)
+		WT_ERR(__wt_thread_create(
+		    &cache->read_tids[i], __wt_cache_read_server, conn));
+	if (conn->log != NULL) {
+		WT_ERR(__wt_thread_create(
+		    &conn->log_flush_tid, __wt_log_flush_server, conn));
+		WT_ERR(__wt_thread_create(
+		    &conn->log_prep_tid, __wt_log_prep_server, conn));
+	}
+	if ((wq = conn->write_queue) != NULL)
+		for (i = 0; i < wq->nthreads; ++i)
+			WT_ERR(__wt_thread_create(
+			    &wq->tids[i], __wt_write_server, conn));
 
 	return (0);
 
@@ -61,8 +92,12 @@ int
 __wt_connection_close(WT_CONNECTION_IMPL *conn)
 {
 	WT_SESSION_IMPL *session;
+	WT_CACHE *cache;
 	WT_DLH *dlh;
+	WT_EVICT_WORKER *worker;
 	WT_FH *fh;
+	WT_WRITE_QUEUE *wq;
+	u_int i;
 	int ret;
 
 	session = &conn->default_session;
@@ -70,10 +105,13 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 
 	/*
 	 * Complain if files weren't closed (ignoring the lock and logging
-	 * files, we'll close them in a minute.
+	 * files, we'll close them in a minute.  The log prep thread may be
+	 * writing the spare log file.
 	 */
 	TAILQ_FOREACH(fh, &conn->fhqh, q) {
-		if (fh == conn->lock_fh || fh == conn->log_fh)
+		if (fh == conn->lock_fh ||
+		    (conn->log != NULL && WT_PREFIX_MATCH(fh->name,
+		    WT_LOG_FILENAME)))
 			continue;
 
 		__wt_errx(session,
@@ -82,15 +120,58 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 		fh = TAILQ_FIRST(&conn->fhqh);
 	}
 
-	/* Shut down the server threads. */
+	/*
+	 * Shut down the server threads.  The eviction workers and cleaners go
+	 * first, they use the eviction server's queue of pages.
+	 */
 	F_CLR(conn, WT_SERVER_RUN);
+	if ((cache = conn->cache) != NULL) {
+		for (i = 0, worker = cache->workers;
+		    i < cache->eviction_workers; ++i, ++worker)
+			if (worker->tid != 0) {
+				__wt_cond_signal(session, worker->cond);
+				WT_TRET(__wt_thread_join(worker->tid));
+			}
+		for (i = 0; i < cache->eviction_cleaners; ++i)
+			if (cache->clean_tids[i] != 0) {
+				__wt_cond_signal(session, cache->clean_cond);
+				WT_TRET(__wt_thread_join(cache->clean_tids[i]));
+			}
+	}
 	if (conn->cache_evict_tid != 0) {
 		__wt_evict_server_wake(session);
 		WT_TRET(__wt_thread_join(conn->cache_evict_tid));
 	}
-
-	/* Discard the cache. */
+	if (cache != NULL)
+		for (i = 0; i < cache->read_threads; ++i)
+			if (cache->read_tids[i] != 0) {
+				__wt_cond_signal(session, cache->read_cond);
+				WT_TRET(__wt_thread_join(cache->read_tids[i]));
+			}
+	if (conn->log_flush_tid != 0) {
+		__wt_cond_signal(session, conn->log->flush_cond);
+		WT_TRET(__wt_thread_join(conn->log_flush_tid));
+	}
+	if (conn->log_prep_tid != 0) {
+		__wt_cond_signal(session, conn->log->prep_cond);
+		WT_TRET(__wt_thread_join(conn->log_prep_tid));
+	}
+	if ((wq = conn->write_queue) != NULL)
+		for (i = 0; i < wq->nthreads; ++i)
+			if (wq->tids[i] != 0) {
+				__wt_cond_signal(session, wq->cond);
+				WT_TRET(__wt_thread_join(wq->tids[i]));
+			}
+
+	/* Discard the cache and the write queue. */
 	__wt_cache_destroy(conn);
+	__wt_write_queue_destroy(conn);
+
+	/* Free any pages waiting for epoch-based reclamation. */
+	__wt_hazard_page_drain(session, 1);
+
+	/* Sync and close the log. */
+	WT_TRET(__wt_log_close(session));
 
 	/* Close extensions. */
 	while ((dlh = TAILQ_FIRST(&conn->dlhqh)) != NULL) {
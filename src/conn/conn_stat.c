@@ -19,4 +19,5 @@ __wt_conn_stat_init(WT_SESSION_IMPL *session)
 	conn = S2C(session);
 
 	__wt_cache_stats_update(conn);
+	WT_STAT_SET(conn->stats, checkpoint_stall_max, conn->ckpt_stall_max);
 }
@@ -0,0 +1,205 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+static int __cursor_cache_close(WT_CURSOR *);
+
+/*
+ * __cursor_cache_uri --
+ *	Return if cursors on a URI can be cached: only cursors on data sources
+ * are worth caching, statistics cursors are a snapshot taken when the cursor
+ * is opened.
+ */
+static inline int
+__cursor_cache_uri(const char *uri)
+{
+	return (WT_PREFIX_MATCH(uri, "colgroup:") ||
+	    WT_PREFIX_MATCH(uri, "file:") ||
+	    WT_PREFIX_MATCH(uri, "index:") ||
+	    WT_PREFIX_MATCH(uri, "table:"));
+}
+
+/*
+ * __cursor_cache_config --
+ *	Return the configuration string used as part of the cache key.
+ */
+static inline const char *
+__cursor_cache_config(const char *config)
+{
+	return (config == NULL ? "" : config);
+}
+
+/*
+ * __wt_cursor_cache_get --
+ *	Return a cached cursor matching a WT_SESSION->open_cursor call.
+ */
+int
+__wt_cursor_cache_get(WT_SESSION_IMPL *session,
+    const char *uri, const char *config, WT_CURSOR **cursorp)
+{
+	WT_CURSOR *cursor;
+	WT_CURSOR_CACHE *cc;
+	uint64_t hash;
+
+	if (!__cursor_cache_uri(uri))
+		return (WT_NOTFOUND);
+	if (session->cursor_cache == NULL)
+		goto miss;
+
+	config = __cursor_cache_config(config);
+	hash = __wt_hash_fnv64(uri, strlen(uri));
+	TAILQ_FOREACH(cc, &session->cursor_cache[hash % WT_HASH_ARRAY_SIZE], q)
+		if (cc->hash == hash && strcmp(uri, cc->uri) == 0 &&
+		    strcmp(config, cc->config) == 0)
+			break;
+	if (cc == NULL)
+		goto miss;
+
+	/* Move the cursor back to the session's list of open cursors. */
+	TAILQ_REMOVE(&session->cursor_cache[hash % WT_HASH_ARRAY_SIZE], cc, q);
+	TAILQ_INSERT_HEAD(&session->cursor_cache_open, cc, q);
+
+	cursor = cc->cursor;
+	cursor->saved_err = 0;
+	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+
+	WT_CSTAT_INCR(session, cursor_cache_hit);
+	*cursorp = cursor;
+	return (0);
+
+miss:	WT_CSTAT_INCR(session, cursor_cache_miss);
+	return (WT_NOTFOUND);
+}
+
+/*
+ * __wt_cursor_cache_add --
+ *	Arrange for a newly opened cursor to be cached when it is closed.
+ */
+int
+__wt_cursor_cache_add(WT_SESSION_IMPL *session,
+    const char *uri, const char *config, const char *cfg[], WT_CURSOR *cursor)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CURSOR_CACHE *cc;
+	u_int i;
+	int ret;
+
+	/*
+	 * Bulk cursors have exclusive access to their file, and dump cursors
+	 * are a wrapper around another cursor, don't cache them.
+	 */
+	if (!__cursor_cache_uri(uri))
+		return (0);
+	WT_RET(__wt_config_gets(session, cfg, "bulk", &cval));
+	if (cval.val != 0)
+		return (0);
+	WT_RET(__wt_config_gets(session, cfg, "dump", &cval));
+	if (cval.len != 0)
+		return (0);
+
+	if (session->cursor_cache == NULL) {
+		WT_RET(__wt_calloc_def(
+		    session, WT_HASH_ARRAY_SIZE, &session->cursor_cache));
+		for (i = 0; i < WT_HASH_ARRAY_SIZE; ++i)
+			TAILQ_INIT(&session->cursor_cache[i]);
+	}
+
+	WT_RET(__wt_calloc_def(session, 1, &cc));
+	WT_ERR(__wt_strdup(session, uri, &cc->uri));
+	WT_ERR(__wt_strdup(
+	    session, __cursor_cache_config(config), &cc->config));
+	cc->hash = __wt_hash_fnv64(uri, strlen(uri));
+	cc->cursor = cursor;
+
+	/* Intercept the cursor's close method. */
+	cc->close = cursor->close;
+	cursor->close = __cursor_cache_close;
+
+	TAILQ_INSERT_HEAD(&session->cursor_cache_open, cc, q);
+	return (0);
+
+err:	__wt_free(session, cc->uri);
+	__wt_free(session, cc->config);
+	__wt_free(session, cc);
+	return (ret);
+}
+
+/*
+ * __cursor_cache_free --
+ *	Close a cached cursor and free its cache entry.
+ */
+static int
+__cursor_cache_free(WT_SESSION_IMPL *session, WT_CURSOR_CACHE *cc)
+{
+	WT_CURSOR *cursor;
+	int ret;
+
+	cursor = cc->cursor;
+	cursor->close = cc->close;
+	ret = cursor->close(cursor);
+
+	__wt_free(session, cc->uri);
+	__wt_free(session, cc->config);
+	__wt_free(session, cc);
+	return (ret);
+}
+
+/*
+ * __cursor_cache_close --
+ *	WT_CURSOR->close method for cached cursors: reset the cursor and park
+ * it in the session's cache.
+ */
+static int
+__cursor_cache_close(WT_CURSOR *cursor)
+{
+	WT_CURSOR_CACHE *cc;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	TAILQ_FOREACH(cc, &session->cursor_cache_open, q)
+		if (cc->cursor == cursor)
+			break;
+	WT_ASSERT(session, cc != NULL);
+	TAILQ_REMOVE(&session->cursor_cache_open, cc, q);
+
+	/*
+	 * If caching has been turned off (the session is closing), or we
+	 * can't reset the cursor, really close it.
+	 */
+	if (!F_ISSET(session, WT_SESSION_CACHE_CURSORS) ||
+	    cursor->reset(cursor) != 0)
+		return (__cursor_cache_free(session, cc));
+
+	TAILQ_INSERT_HEAD(
+	    &session->cursor_cache[cc->hash % WT_HASH_ARRAY_SIZE], cc, q);
+	return (0);
+}
+
+/*
+ * __wt_cursor_cache_discard --
+ *	Close the session's cached cursors.
+ */
+int
+__wt_cursor_cache_discard(WT_SESSION_IMPL *session)
+{
+	WT_CURSOR_CACHE *cc;
+	u_int i;
+	int ret;
+
+	ret = 0;
+	if (session->cursor_cache == NULL)
+		return (0);
+
+	for (i = 0; i < WT_HASH_ARRAY_SIZE; ++i)
+		while ((cc = TAILQ_FIRST(&session->cursor_cache[i])) != NULL) {
+			TAILQ_REMOVE(&session->cursor_cache[i], cc, q);
+			WT_TRET(__cursor_cache_free(session, cc));
+		}
+	return (ret);
+}
@@ -10,6 +10,25 @@
 static int  __curstat_next(WT_CURSOR *cursor);
 static int  __curstat_prev(WT_CURSOR *cursor);
 
+/*
+ * __curstat_value --
+ *	Return the current statistic's value, summed across the shards.
+ */
+static inline uint64_t
+__curstat_value(WT_CURSOR_STAT *cst)
+{
+	WT_STATS *stats;
+	uint64_t v;
+	u_int i;
+
+	for (v = 0, i = 0; i < cst->stats_slots; ++i) {
+		stats = (WT_STATS *)
+		    ((uint8_t *)cst->stats_first + i * cst->stats_size);
+		v += stats[cst->key].v;
+	}
+	return (v);
+}
+
 /*
  * __curstat_print_value --
  *	Convert statistics cursor value to printable format.
@@ -180,7 +199,7 @@ __curstat_next(WT_CURSOR *cursor)
 		F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 		WT_ERR(WT_NOTFOUND);
 	}
-	cst->v = cst->stats_first[cst->key].v;
+	cst->v = __curstat_value(cst);
 	WT_ERR(__curstat_print_value(session, cst->v, &cst->pv));
 	F_SET(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 
@@ -214,7 +233,7 @@ __curstat_prev(WT_CURSOR *cursor)
 		WT_ERR(WT_NOTFOUND);
 	}
 
-	cst->v = cst->stats_first[cst->key].v;
+	cst->v = __curstat_value(cst);
 	WT_ERR(__curstat_print_value(session, cst->v, &cst->pv));
 	F_SET(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 
@@ -257,7 +276,7 @@ __curstat_search(WT_CURSOR *cursor)
 	if (cst->key < 0 || cst->key >= cst->stats_count)
 		WT_ERR(WT_NOTFOUND);
 
-	cst->v = cst->stats_first[cst->key].v;
+	cst->v = __curstat_value(cst);
 	WT_ERR(__curstat_print_value(session, cst->v, &cst->pv));
 	F_SET(cursor, WT_CURSTD_VALUE_SET);
 
@@ -274,6 +293,7 @@ __curstat_close(WT_CURSOR *cursor)
 {
 	WT_CURSOR_STAT *cst;
 	WT_SESSION_IMPL *session;
+	u_int i;
 	int ret;
 
 	ret = 0;
@@ -281,7 +301,9 @@ __curstat_close(WT_CURSOR *cursor)
 	CURSOR_API_CALL(cursor, session, close, cst->btree);
 
 	if (ret == 0 && cst->clear_func)
-		cst->clear_func(cst->stats_first);
+		for (i = 0; i < cst->stats_slots; ++i)
+			cst->clear_func((WT_STATS *)
+			    ((uint8_t *)cst->stats_first + i * cst->stats_size));
 
 	__wt_buf_free(session, &cst->pv);
 
@@ -333,12 +355,17 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 		0			/* uint32_t flags */
 	};
 	WT_BTREE *btree;
+	WT_CACHE *cache;
 	WT_CURSOR_STAT *cst;
 	WT_CONFIG_ITEM cval;
 	WT_CURSOR *cursor;
 	WT_STATS *stats_first;
 	void (*clear_func)(WT_STATS *);
+	size_t stats_size;
+	u_long worker;
+	u_int stats_slots;
 	int clear_on_close, ret, stats_count;
+	char *p;
 
 	btree = NULL;
 	clear_func = NULL;
@@ -356,13 +383,30 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 		btree = session->btree;
 		WT_ERR(__wt_btree_stat_init(session));
 		stats_first = (WT_STATS *)session->btree->stats;
-		stats_count = sizeof(WT_BTREE_STATS) / sizeof(WT_STATS);
+		stats_count = WT_BTREE_STATS_COUNT;
+		stats_slots = WT_STAT_SLOTS;
+		stats_size = sizeof(WT_BTREE_STATS);
 		if (clear_on_close)
 			clear_func = __wt_stat_clear_btree_stats;
+	} else if (WT_PREFIX_MATCH(uri, "eviction_worker:")) {
+		cache = S2C(session)->cache;
+		worker = strtoul(uri + strlen("eviction_worker:"), &p, 10);
+		if (p == uri + strlen("eviction_worker:") ||
+		    *p != '\0' || worker >= cache->eviction_workers)
+			WT_RET_MSG(session, EINVAL,
+			    "statistics:%s: no such eviction worker", uri);
+		stats_first = (WT_STATS *)cache->workers[worker].stats;
+		stats_count = WT_EVICT_WORKER_STATS_COUNT;
+		stats_slots = 1;
+		stats_size = sizeof(WT_EVICT_WORKER_STATS);
+		if (clear_on_close)
+			clear_func = __wt_stat_clear_evict_worker_stats;
 	} else {
 		__wt_conn_stat_init(session);
 		stats_first = (WT_STATS *)S2C(session)->stats;
-		stats_count = sizeof(WT_CONNECTION_STATS) / sizeof(WT_STATS);
+		stats_count = WT_CONNECTION_STATS_COUNT;
+		stats_slots = WT_STAT_SLOTS;
+		stats_size = sizeof(WT_CONNECTION_STATS);
 		if (clear_on_close)
 			clear_func = __wt_stat_clear_connection_stats;
 	}
@@ -382,6 +426,8 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 	cst->btree = btree;
 	cst->stats_first = stats_first;
 	cst->stats_count = stats_count;
+	cst->stats_slots = stats_slots;
+	cst->stats_size = stats_size;
 	cst->notpositioned = 1;
 	cst->clear_func = clear_func;
 
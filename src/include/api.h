@@ -28,8 +28,15 @@ struct __wt_btree_session {
 	WT_BTREE *btree;
 
 	TAILQ_ENTRY(__wt_btree_session) q;
+	TAILQ_ENTRY(__wt_btree_session) hashq;
 };
 
+/*
+ * Open btree handles are found by hashing the file name into an array of
+ * buckets, in both the connection's and the sessions' handle caches.
+ */
+#define	WT_HASH_ARRAY_SIZE	512
+
 /*
  * WT_HAZARD --
  *	A hazard reference.
@@ -65,14 +72,23 @@ struct __wt_session_impl {
 
 	WT_BTREE *btree;		/* Current file */
 	TAILQ_HEAD(__btrees, __wt_btree_session) btrees;
+					/* Hashed btree handles */
+	TAILQ_HEAD(__btrees_hash, __wt_btree_session)
+	    btrees_hash[WT_HASH_ARRAY_SIZE];
 
 	WT_CURSOR *cursor;		/* Current cursor */
 					/* Cursors closed with the session */
 	TAILQ_HEAD(__cursors, __wt_cursor) cursors;
+					/* Cursor cache: open cursors */
+	TAILQ_HEAD(__cursor_cache_open, __wt_cursor_cache) cursor_cache_open;
+					/* Cursor cache: hashed closed cursors */
+	TAILQ_HEAD(__cursor_cache, __wt_cursor_cache) *cursor_cache;
 
 	WT_BTREE *schematab;		/* Schema tables */
 	TAILQ_HEAD(__tables, __wt_table) tables;
 
+	WT_TXN	txn;			/* Transaction state */
+
 	WT_ITEM	logrec_buf;		/* Buffer for log records */
 	WT_ITEM	logprint_buf;		/* Buffer for debug log records */
 
@@ -85,8 +101,19 @@ struct __wt_session_impl {
 	int	wq_ret;			/* Return value */
 
 	WT_HAZARD *hazard;		/* Hazard reference array */
+	volatile uint64_t epoch;	/* Epoch while pinning a page */
+	uint32_t pins;			/* Pages pinned in epoch mode */
+
+	u_int	 stat_slot;		/* Statistics shard */
+
+					/* Parsed configuration strings */
+	WT_CONFIG_PARSED *config_cache[WT_CONFIG_CACHE_SIZE];
+	uint64_t config_cache_gen;	/* Parsed configuration LRU counter */
 
 	void	*reconcile;		/* Reconciliation information */
+	WT_PAGE	*write_page;		/* Page tracking its queued writes */
+
+	u_int	 evict_debt;		/* Eviction owed for pages read */
 
 	WT_REF **excl;			/* Eviction exclusive list */
 	u_int	 excl_next;		/* Next empty slot */
@@ -132,9 +159,19 @@ struct __wt_connection_impl {
 					   application-supplied session */
 
 	WT_SPINLOCK fh_lock;		/* File handle queue spinlock */
-	WT_SPINLOCK serial_lock;	/* Serial function call spinlock */
+	WT_SPINLOCK serial_lock;	/* Eviction request spinlock */
 	WT_SPINLOCK spinlock;		/* General purpose spinlock */
 
+	/*
+	 * Modifications linking entries onto the end of a page's skiplists are
+	 * serialized per page (other modifications are lock-free).  Pages share
+	 * a small array of spinlocks: each page's WT_PAGE_MODIFY structure is
+	 * assigned one of them when it's allocated.
+	 */
+#define	WT_PAGE_LOCKS		17
+	WT_SPINLOCK page_lock[WT_PAGE_LOCKS];
+	u_int	    page_lock_cnt;	/* Next page lock to assign */
+
 					/* Connection queue */
 	TAILQ_ENTRY(__wt_connection_impl) q;
 
@@ -144,7 +181,8 @@ struct __wt_connection_impl {
 	WT_FH *lock_fh;			/* Lock file handle */
 
 	pthread_t cache_evict_tid;	/* Cache eviction server thread ID */
-	pthread_t cache_read_tid;	/* Cache read server thread ID */
+	pthread_t log_flush_tid;	/* Log flush thread ID */
+	pthread_t log_prep_tid;		/* Log prep thread ID */
 
 					/* Locked: btree list */
 	TAILQ_HEAD(__wt_btree_qh, __wt_btree) btqh;
@@ -156,8 +194,14 @@ struct __wt_connection_impl {
 	TAILQ_HEAD(__wt_dlh_qh, __wt_dlh) dlhqh;
 
 	u_int btqcnt;			/* Locked: btree count */
+					/* Btree hash: lock-free reads */
+	WT_BTREE *bthash[WT_HASH_ARRAY_SIZE];
 	u_int next_file_id;		/* Locked: file ID counter */
 
+					/* Compiled configuration strings */
+	WT_CONFIG_PARSED *config_compiled[WT_CONFIG_COMPILED_SLOTS];
+	u_int config_compiled_cnt;	/* Locked: compiled string count */
+
 	/*
 	 * WiredTiger allocates space for 50 simultaneous sessions (threads of
 	 * control) by default.  Growing the number of threads dynamically is
@@ -181,17 +225,45 @@ struct __wt_connection_impl {
 	 *
 	 * The hazard array is separate from the WT_SESSION_IMPL array because
 	 * we need to easily copy and search it when evicting pages from memory.
+	 *
+	 * Each session's slots are allocated when the connection is opened,
+	 * the number a session may use can be reconfigured, up to that size.
 	 */
 	WT_HAZARD *hazard;		/* Hazard references array */
-	uint32_t   hazard_size;
+	uint32_t   hazard_max;		/* Hazard slots allocated per session */
+	uint32_t   hazard_size;		/* Hazard slots used per session */
 	uint32_t   session_size;
 
+	/*
+	 * If configured for epoch-based reclamation, pages are pinned by
+	 * incrementing a reference count in the page rather than setting a
+	 * hazard reference.  Sessions enter the current epoch while pinning a
+	 * page, and discarded pages are kept on a list until every session
+	 * has left the epoch in which the page was discarded.
+	 */
+	volatile uint64_t epoch;	/* Current epoch */
+	WT_SPINLOCK epoch_lock;		/* Locked: discarded page list */
+	WT_PAGE	  *epoch_free;		/* Discarded pages */
+	uint32_t   epoch_free_cnt;	/* Discarded page count */
+
 	WT_CACHE  *cache;		/* Page cache */
 	uint64_t   cache_size;
 
 	WT_CONNECTION_STATS *stats;	/* Connection statistics */
 
-	WT_FH	   *log_fh;		/* Logging file handle */
+	WT_LOG	   *log;		/* Log */
+
+	WT_WRITE_QUEUE *write_queue;	/* Block write queue */
+
+	WT_TXN_GLOBAL txn_global;	/* Global transaction state */
+
+	WT_RWLOCK *ckpt_rwlock;		/* Checkpoint and sync lock */
+	volatile int ckpt_running;	/* Checkpoint running */
+	time_t	   ckpt_secs;		/* Last checkpoint's completion time */
+	long	   ckpt_nsecs;
+	WT_LSN	   ckpt_lsn;		/* Log end when the checkpoint started */
+					/* Longest application wait (usecs) */
+	volatile uint64_t ckpt_stall_max;
 
 					/* Locked: collator list */
 	TAILQ_HEAD(__wt_coll_qh, __wt_named_collator) collqh;
@@ -270,22 +342,34 @@ extern WT_PROCESS __wt_process;
  * DO NOT EDIT: automatically built by dist/api_flags.py.
  * API flags section: BEGIN
  */
+#define	WT_CACHE_CURSORS				0x00000008
 #define	WT_DIRECTIO_DATA				0x00000002
 #define	WT_DIRECTIO_LOG					0x00000001
+#define	WT_EPOCH_RECLAIM				0x00000004
+#define	WT_LOG_FLUSH					0x00000002
+#define	WT_LOG_FSYNC					0x00000001
 #define	WT_PAGE_FREE_IGNORE_DISK			0x00000001
 #define	WT_REC_SINGLE					0x00000001
-#define	WT_SERVER_RUN					0x00000001
-#define	WT_SESSION_INTERNAL				0x00000002
+#define	WT_SERVER_RUN					0x00000002
+#define	WT_SESSION_CACHE_CURSORS			0x00000020
+#define	WT_SESSION_EVICT_CLOSE				0x00000010
+#define	WT_SESSION_INTERNAL				0x00000008
+#define	WT_SESSION_NO_LOGGING				0x00000004
+#define	WT_SESSION_NO_TXN				0x00000002
 #define	WT_SESSION_SALVAGE_QUIET_ERR			0x00000001
-#define	WT_VERB_block					0x00000800
-#define	WT_VERB_evict					0x00000400
-#define	WT_VERB_evictserver				0x00000200
-#define	WT_VERB_fileops					0x00000100
-#define	WT_VERB_hazard					0x00000080
-#define	WT_VERB_mutex					0x00000040
-#define	WT_VERB_read					0x00000020
-#define	WT_VERB_readserver				0x00000010
-#define	WT_VERB_reconcile				0x00000008
+#define	WT_STATISTICS					0x00000001
+#define	WT_TXN_AUTOCOMMIT				0x00000002
+#define	WT_TXN_RUNNING					0x00000001
+#define	WT_VERB_block					0x00001000
+#define	WT_VERB_evict					0x00000800
+#define	WT_VERB_evictserver				0x00000400
+#define	WT_VERB_fileops					0x00000200
+#define	WT_VERB_hazard					0x00000100
+#define	WT_VERB_mutex					0x00000080
+#define	WT_VERB_read					0x00000040
+#define	WT_VERB_readserver				0x00000020
+#define	WT_VERB_reconcile				0x00000010
+#define	WT_VERB_recovery				0x00000008
 #define	WT_VERB_salvage					0x00000004
 #define	WT_VERB_verify					0x00000002
 #define	WT_VERB_write					0x00000001
@@ -33,6 +33,15 @@
  * skiplists, and store the depth of the skiplist in the WT_EXT structure.
  * The skiplist entries for the offset skiplist start at WT_EXT.next[0] and
  * the entries for the size skiplist start at WT_EXT.next[WT_EXT.depth].
+ *
+ * Checkpoints add three more extent lists.  A block written since the last
+ * checkpoint isn't referenced by any checkpoint, and can be reused as soon as
+ * it's freed: the alloc list tracks those blocks.  Other freed blocks may be
+ * referenced by the last checkpoint, the discard list holds them until a newer
+ * checkpoint is durable.  When a checkpoint starts, the discard list becomes
+ * the ckpt_discard list, which is moved to the free list once the checkpoint
+ * completes.  Blocks freed while a checkpoint is running go on the discard
+ * list, they're released by the following checkpoint.
  */
 
 /*
@@ -122,6 +131,17 @@ struct __wt_block {
 	uint32_t free_size;
 	uint32_t free_cksum;
 
+					/* Checkpoint support */
+	WT_EXTLIST alloc;		/* Allocated since the last checkpoint */
+	WT_EXTLIST discard;		/* Freed since the last checkpoint */
+	WT_EXTLIST ckpt_discard;	/* Freed before the running checkpoint */
+	int	 ckpt_inprogress;	/* Checkpoint running */
+	uint64_t ckpt_bytes;		/* Bytes written by the checkpoint */
+
+					/* Write queue support */
+	uint32_t write_pending;		/* Queued writes not yet written */
+	int	 write_error;		/* Locked: queued write error */
+
 					/* Salvage support */
 	off_t	 slvg_off;		/* Salvage file offset */
 
@@ -133,6 +153,60 @@ struct __wt_block {
 	uint32_t flags;
 };
 
+/*
+ * WT_WRITE_REQ --
+ *	A block write waiting for a write thread.
+ */
+struct __wt_write_req {
+	WT_BLOCK *block;		/* Block manager handle */
+	off_t	 offset;		/* File offset */
+	uint32_t size;			/* Block size */
+	WT_ITEM	 buf;			/* Block image */
+	WT_PAGE	*page;			/* Page re-dirtied if the write fails */
+	int	 busy;			/* Write in progress */
+
+	TAILQ_ENTRY(__wt_write_req) q;	/* Write queue */
+	TAILQ_ENTRY(__wt_write_req) hq;	/* Hash bucket */
+};
+
+/*
+ * WT_WRITE_BUCKET --
+ *	Queued writes hashed by file offset: reads and frees look up blocks
+ * without taking the queue's lock.
+ */
+#define	WT_WRITE_QUEUE_BUCKETS	64
+#define	WT_WRITE_QUEUE_HASH(block, offset)				\
+	((u_int)(((uint64_t)(offset) / 512 + (uintptr_t)(block) / 64) %	\
+	WT_WRITE_QUEUE_BUCKETS))
+struct __wt_write_bucket {
+	WT_SPINLOCK lock;		/* Locked: bucket */
+	TAILQ_HEAD(__wt_write_hqh, __wt_write_req) qh;
+};
+
+/*
+ * WT_WRITE_QUEUE --
+ *	The connection's queue of block writes.  Requests stay on the queue
+ * until they're written: a block read before its write completes is copied
+ * from the queued image, and a block freed before its write completes isn't
+ * reused until it's written.
+ */
+struct __wt_write_queue {
+	WT_SPINLOCK lock;		/* Locked: queue */
+	TAILQ_HEAD(__wt_write_qh, __wt_write_req) qh;
+	uint32_t entries;		/* Queued and in-progress writes */
+	uint32_t max;			/* Maximum queued writes */
+
+					/* Requests by file offset */
+	WT_WRITE_BUCKET hash[WT_WRITE_QUEUE_BUCKETS];
+
+	WT_CONDVAR *cond;		/* Write threads wait for requests */
+	WT_CONDVAR *done_cond;		/* Threads wait for writes to finish */
+	volatile uint64_t done_gen;	/* Writes finished */
+	volatile uint32_t done_waiters;	/* Threads waiting in done_cond */
+	pthread_t *tids;		/* Write thread IDs */
+	u_int	 nthreads;		/* Write threads */
+};
+
 /*
  * WT_BLOCK_DESC --
  *	The file's description.
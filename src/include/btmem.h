@@ -85,26 +85,16 @@ struct __wt_page_modify {
 	 * The write generation is incremented after a page is modified.  That
 	 * is, it tracks page versions.
 	 *
-	 * The write generation value is used to detect changes scheduled based
-	 * on out-of-date information.  Two threads of control updating the same
-	 * page could both search the page in state A.  When the updates are
-	 * performed serially, one of the changes will happen after the page is
-	 * modified, and the search state for the other thread might no longer
-	 * be applicable.  To avoid this race, page write generations are copied
-	 * into the search stack whenever a page is read, and check when a
-	 * modification is serialized.  The serialized function compares each
-	 * page's current write generation to the generation copied in the
-	 * read/search; if the two values match, the search occurred on a
-	 * current version of the page and the modification can proceed.  If the
-	 * two generations differ, the serialized call returns an error and the
-	 * operation must be restarted.
+	 * Threads modifying the page don't check the write generation: each
+	 * modification is linked into the page with an atomic compare-and-swap
+	 * of the list pointer the thread's search read, and if that pointer
+	 * has changed, the search state is out-of-date and the operation must
+	 * be restarted.  Because the list pointer itself is re-validated, two
+	 * threads updating the page in unrelated places both succeed.
 	 *
-	 * The write-generation value could be stored on a per-entry basis if
-	 * there's sufficient contention for the page as a whole.
-	 *
-	 * The write-generation is not declared volatile: write-generation is
-	 * written by a serialized function when modifying a page, and must be
-	 * flushed in order as the serialized updates are flushed.
+	 * The write generation is used by reconciliation to detect changes
+	 * made while the page was being written (see disk_gen, below).  It is
+	 * incremented atomically, after the modification is published.
 	 *
 	 * !!!
 	 * 32-bit values are probably more than is needed: at some point we may
@@ -127,6 +117,36 @@ struct __wt_page_modify {
 	 */
 	uint32_t disk_gen;
 
+	/*
+	 * The bytes the page has added to the cache's count of dirty bytes:
+	 * set when the page is first modified after it was written, grown as
+	 * the page grows, and subtracted when the page is written or
+	 * discarded.  Zero if the page is clean.
+	 */
+	uint32_t bytes_dirty;
+
+	/*
+	 * Writes of the page still queued for a write thread: the page isn't
+	 * clean until they complete, it can't be evicted and a failed write
+	 * dirties it again.  Locked by the connection's write queue.
+	 */
+	uint32_t write_pending;
+
+	/*
+	 * If the page's last reconciliation skipped updates some running
+	 * transaction couldn't see, the oldest running ID at the time, else
+	 * WT_TXN_NONE.  Until the oldest running ID moves past it, writing
+	 * the page again would skip the same updates, leaving it dirty.
+	 */
+	uint64_t rec_oldest;
+
+	/*
+	 * Modifications updating a skiplist's tail pointers, and column-store
+	 * appends, are serialized by a spinlock, one of the connection's array
+	 * of page locks; see WT_PAGE_LOCK.
+	 */
+	u_int page_lock;
+
 	union {
 		WT_PAGE *split;		/* Resulting split */
 		WT_ADDR	 replace;	/* Resulting replacement */
@@ -174,6 +194,17 @@ struct __wt_page_modify {
 	uint32_t track_entries;		/* Total track slots */
 };
 
+/*
+ * WT_PAGE_LOCK, WT_PAGE_UNLOCK --
+ *	Lock/unlock a modified page.
+ */
+#define	WT_PAGE_LOCK(session, page)					\
+	__wt_spin_lock(							\
+	    (session), &S2C(session)->page_lock[(page)->modify->page_lock])
+#define	WT_PAGE_UNLOCK(session, page)					\
+	__wt_spin_unlock(						\
+	    (session), &S2C(session)->page_lock[(page)->modify->page_lock])
+
 /*
  * WT_PAGE --
  * The WT_PAGE structure describes the in-memory page information.
@@ -247,6 +278,13 @@ struct __wt_page {
 	/* If/when the page is modified, we need lots more information. */
 	WT_PAGE_MODIFY *modify;
 
+	/*
+	 * The page's WT_INSERT, WT_UPDATE and WT_IKEY structures are allocated
+	 * from chunks of memory attached to the page, and freed in bulk when
+	 * the page is discarded.
+	 */
+	WT_PAGE_ARENA * volatile arena;
+
 	/*
 	 * The read generation is incremented each time the page is searched,
 	 * and acts as an LRU value for each page in the tree; it is read by
@@ -261,6 +299,25 @@ struct __wt_page {
 	 */
 	 uint64_t read_gen;
 
+	/*
+	 * The eviction generation is the cache's read generation when the page
+	 * was created or last visited by the eviction server: if the page's
+	 * read generation is larger, the page has been accessed since then.
+	 * The eviction state is the page's place in the scan-resistant
+	 * replacement policies.  Both fields are only set when the page is
+	 * created and by the eviction server thread.
+	 */
+	uint64_t evict_gen;
+#define	WT_EVICT_STATE_HOT	0x01	/* 2Q: Am queue; CLOCK-Pro: hot */
+#define	WT_EVICT_STATE_TEST	0x02	/* CLOCK-Pro: cold, test period */
+	uint8_t evict_state;
+
+	/*
+	 * Pages read by the read-ahead threads are flagged until a cursor scan
+	 * reaches them, to count read-ahead hits.
+	 */
+	volatile uint8_t read_ahead;
+
 	/*
 	 * In-memory pages optionally reference a number of entries originally
 	 * read from disk and sizes the allocated arrays that describe the page.
@@ -273,6 +330,13 @@ struct __wt_page {
 	 */
 	uint32_t memory_footprint;
 
+	/*
+	 * Threads using the page, if the connection is configured for epoch
+	 * reclamation (otherwise, threads using the page have set hazard
+	 * references).
+	 */
+	volatile uint32_t pins;
+
 #define	WT_PAGE_INVALID		0	/* Invalid page */
 #define	WT_PAGE_COL_FIX		1	/* Col-store fixed-len leaf */
 #define	WT_PAGE_COL_INT		2	/* Col-store internal page */
@@ -487,6 +551,26 @@ struct __wt_col_rle {
 #define	WT_COL_SLOT(page, cip)						\
 	((uint32_t)(((WT_COL *)cip) - (page)->u.col_var.d))
 
+/*
+ * WT_PAGE_ARENA --
+ *	A chunk of memory holding a page's WT_INSERT, WT_UPDATE and WT_IKEY
+ * structures.  Threads allocate from the page's newest chunk by atomically
+ * advancing its used count, and add a new, larger chunk when it fills.
+ * Chunks are charged to the page's memory footprint when allocated, and
+ * are only freed when the page is discarded.
+ */
+#define	WT_PAGE_ARENA_MIN	256		/* First chunk size */
+#define	WT_PAGE_ARENA_MAX	(64 * 1024)	/* Largest shared chunk */
+struct __wt_page_arena {
+	WT_PAGE_ARENA *next;		/* Older chunks */
+	uint32_t size;			/* Chunk size */
+	volatile uint32_t used;		/* Chunk bytes allocated */
+
+	/* The chunk's memory immediately follows the WT_PAGE_ARENA structure. */
+#define	WT_PAGE_ARENA_DATA(arena)					\
+	((uint8_t *)(arena) + sizeof(WT_PAGE_ARENA))
+};
+
 /*
  * WT_IKEY --
  * Instantiated key: row-store keys are usually prefix compressed and sometimes
@@ -521,11 +605,15 @@ struct __wt_ikey {
  * WT_UPDATE array is allocated, with one slot for every existing element in
  * the page.  A slot points to a WT_UPDATE structure; if more than one update
  * is done for an entry, WT_UPDATE structures are formed into a forward-linked
- * list.
+ * list, newest first.  Each update is tagged with the ID of the transaction
+ * that made it: readers walk the list to the newest update visible in their
+ * snapshot.
  */
 struct __wt_update {
 	WT_UPDATE *next;		/* forward-linked list */
 
+	uint64_t txnid;			/* update transaction */
+
 	/*
 	 * We use the maximum size as an is-deleted flag, which means we can't
 	 * store 4GB objects; I'd rather do that than increase the size of this
@@ -57,14 +57,19 @@
  */
 struct __wt_btree {
 	WT_RWLOCK *rwlock;		/* Lock for shared/exclusive ops */
-	uint32_t   refcnt;		/* Sessions using this tree. */
+	volatile uint32_t refcnt;	/* Sessions using this tree. */
 	TAILQ_ENTRY(__wt_btree) q;	/* Linked list of handles */
+	WT_BTREE  *hashnext;		/* Hash bucket chain */
 
 	volatile uint32_t lru_count;	/* Count of threads in LRU eviction. */
+					/* Queued read-ahead requests */
+	volatile uint32_t read_ahead_pending;
 
 	const char *name;		/* Logical name */
 	const char *filename;		/* File name */
+	uint64_t    filename_hash;	/* File name hash */
 	const char *config;		/* Configuration string */
+	uint32_t    id;			/* File ID in log records */
 
 	enum {	BTREE_COL_FIX=1,	/* Fixed-length column store */
 		BTREE_COL_VAR=2,	/* Variable-length column store */
@@ -99,12 +104,20 @@ struct __wt_btree {
 	int	 root_update;		/* 0: free original root blocks
 					   1: free saved root blocks and
 					      update on close */
+	int	 root_ckpt;		/* Root address set by a checkpoint */
+	WT_ADDR	 ckpt_addr;		/* Last checkpoint's root address */
 
 	void *block;			/* Block manager */
 	u_int block_header;		/* Block manager header length */
 
 	WT_PAGE *evict_page;		/* Eviction thread's location */
 
+	uint64_t bytes_inuse;		/* Bytes held in the cache */
+	uint64_t cache_max;		/* Cache quota */
+	uint32_t quota_over;		/* Counted as over its quota */
+	uint64_t cache_min;		/* Cache bytes not evicted */
+	int	 cache_priority;	/* Cache priority percentage */
+
 	WT_BTREE_STATS *stats;		/* Btree statistics */
 
 #define	WT_BTREE_BULK		0x01	/* Bulk-load handle */
@@ -114,6 +127,7 @@ struct __wt_btree {
 #define	WT_BTREE_SALVAGE	0x10	/* Handle is for salvage */
 #define	WT_BTREE_UPGRADE	0x20	/* Handle is for upgrade */
 #define	WT_BTREE_VERIFY		0x40	/* Handle is for verify */
+#define	WT_BTREE_NO_EVICTION	0x80	/* Checkpoint: pages can't be evicted */
 	uint32_t flags;
 };
 
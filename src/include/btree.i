@@ -5,6 +5,55 @@
  * See the file LICENSE for redistribution information.
  */
 
+/*
+ * __wt_btree_bytes_inuse --
+ *	Return the number of bytes a file holds in the cache.
+ */
+static inline uint64_t
+__wt_btree_bytes_inuse(WT_BTREE *btree)
+{
+	uint64_t bytes_inuse;
+
+	/*
+	 * The count is updated without a lock as pages are read, grow and are
+	 * discarded: a transient wrap isn't worth acting on.
+	 */
+	bytes_inuse = btree->bytes_inuse;
+	return (bytes_inuse > (UINT64_MAX >> 1) ? 0 : bytes_inuse);
+}
+
+/*
+ * __wt_btree_over_quota --
+ *	Return if a file holds more of the cache than its quota.
+ */
+static inline int
+__wt_btree_over_quota(WT_BTREE *btree)
+{
+	return (btree->cache_max != 0 &&
+	    __wt_btree_bytes_inuse(btree) > btree->cache_max);
+}
+
+/*
+ * __wt_btree_quota_update --
+ *	A file's cache use has changed, update the count of files over their
+ * quota when it crosses the quota.
+ */
+static inline void
+__wt_btree_quota_update(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+	WT_CACHE *cache;
+
+	if (btree->cache_max == 0)
+		return;
+
+	cache = S2C(session)->cache;
+	if (__wt_btree_over_quota(btree)) {
+		if (WT_ATOMIC_CAS(btree->quota_over, 0, 1))
+			WT_ATOMIC_ADD(cache->quota_over, 1);
+	} else if (WT_ATOMIC_CAS(btree->quota_over, 1, 0))
+		WT_ATOMIC_ADD(cache->quota_over, -1);
+}
+
 /*
  * __wt_cache_page_inmem_incr --
  *	Increment a page's memory footprint in the cache.
@@ -19,6 +68,77 @@ __wt_cache_page_inmem_incr(
 
 	WT_ATOMIC_ADD(cache->bytes_inmem, size);
 	WT_ATOMIC_ADD(page->memory_footprint, WT_STORE_SIZE(size));
+	if (session->btree != NULL) {
+		WT_ATOMIC_ADD(session->btree->bytes_inuse, size);
+		__wt_btree_quota_update(session, session->btree);
+	}
+
+	/* Modifications to a dirty page are dirty bytes, too. */
+	if (page->modify != NULL && page->modify->bytes_dirty != 0) {
+		WT_ATOMIC_ADD(page->modify->bytes_dirty, WT_STORE_SIZE(size));
+		WT_ATOMIC_ADD(cache->bytes_dirty, size);
+	}
+}
+
+/*
+ * __wt_cache_page_inmem_decr --
+ *	Decrement a page's memory footprint in the cache.
+ */
+static inline void
+__wt_cache_page_inmem_decr(
+    WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
+{
+	WT_CACHE *cache;
+
+	cache = S2C(session)->cache;
+
+	WT_ATOMIC_ADD(cache->bytes_inmem, -(uint64_t)size);
+	WT_ATOMIC_ADD(page->memory_footprint, -WT_STORE_SIZE(size));
+	if (session->btree != NULL) {
+		WT_ATOMIC_ADD(session->btree->bytes_inuse, -(uint64_t)size);
+		__wt_btree_quota_update(session, session->btree);
+	}
+}
+
+/*
+ * __wt_cache_dirty_incr --
+ *	Count a page's bytes as dirty, the page has been modified.
+ */
+static inline void
+__wt_cache_dirty_incr(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_CACHE *cache;
+	uint32_t size;
+
+	cache = S2C(session)->cache;
+
+	/*
+	 * Threads modifying the page race to mark it dirty: only the thread
+	 * setting the page's count adds to the cache's count.
+	 */
+	size = page->memory_footprint;
+	if (size != 0 && WT_ATOMIC_CAS(page->modify->bytes_dirty, 0, size))
+		WT_ATOMIC_ADD(cache->bytes_dirty, size);
+}
+
+/*
+ * __wt_cache_dirty_decr --
+ *	Stop counting a page's bytes as dirty, the page has been written or
+ *	discarded.
+ */
+static inline void
+__wt_cache_dirty_decr(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_CACHE *cache;
+	uint32_t size;
+
+	cache = S2C(session)->cache;
+
+	while ((size = page->modify->bytes_dirty) != 0 &&
+	    !WT_ATOMIC_CAS(page->modify->bytes_dirty, size, 0))
+		;
+	if (size != 0)
+		WT_ATOMIC_ADD(cache->bytes_dirty, -(uint64_t)size);
 }
 
 /*
@@ -37,6 +157,10 @@ __wt_cache_page_read(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 	WT_ATOMIC_ADD(cache->pages_read, 1);
 	WT_ATOMIC_ADD(cache->bytes_read, size);
 	WT_ATOMIC_ADD(page->memory_footprint, WT_STORE_SIZE(size));
+	if (session->btree != NULL) {
+		WT_ATOMIC_ADD(session->btree->bytes_inuse, size);
+		__wt_btree_quota_update(session, session->btree);
+	}
 }
 
 /*
@@ -52,8 +176,16 @@ __wt_cache_page_evict(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	WT_ASSERT(session, page->memory_footprint != 0);
 
+	if (page->modify != NULL)
+		__wt_cache_dirty_decr(session, page);
+
 	WT_ATOMIC_ADD(cache->pages_evict, 1);
 	WT_ATOMIC_ADD(cache->bytes_evict, page->memory_footprint);
+	if (session->btree != NULL) {
+		WT_ATOMIC_ADD(session->btree->bytes_inuse,
+		    -(uint64_t)page->memory_footprint);
+		__wt_btree_quota_update(session, session->btree);
+	}
 
 	page->memory_footprint = 0;
 }
@@ -104,6 +236,24 @@ __wt_cache_bytes_inuse(WT_CACHE *cache)
 	return (bytes_in > bytes_out ? bytes_in - bytes_out : 0);
 }
 
+/*
+ * __wt_cache_bytes_dirty --
+ *	Return the number of dirty bytes.
+ */
+static inline uint64_t
+__wt_cache_bytes_dirty(WT_CACHE *cache)
+{
+	uint64_t bytes_dirty;
+
+	/*
+	 * Pages are counted as dirty and clean by different threads without
+	 * a lock: the count can't go below zero, but a transient wrap isn't
+	 * worth acting on.
+	 */
+	bytes_dirty = cache->bytes_dirty;
+	return (bytes_dirty > (UINT64_MAX >> 1) ? 0 : bytes_dirty);
+}
+
 /*
  * __wt_page_modify_init --
  *	A page is about to be modified, allocate the modification structure.
@@ -118,6 +268,13 @@ __wt_page_modify_init(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	WT_RET(__wt_calloc_def(session, 1, &modify));
 
+	/*
+	 * Select a page lock: a simple round-robin assignment is fine, racing
+	 * threads might select the same lock, which costs nothing but a little
+	 * contention.
+	 */
+	modify->page_lock = S2C(session)->page_lock_cnt++ % WT_PAGE_LOCKS;
+
 	/*
 	 * Multiple threads of control may be searching and deciding to modify
 	 * a page, if we don't do the update, discard the memory.
@@ -132,7 +289,7 @@ __wt_page_modify_init(WT_SESSION_IMPL *session, WT_PAGE *page)
  *	Mark the page dirty.
  */
 static inline void
-__wt_page_modify_set(WT_PAGE *page)
+__wt_page_modify_set(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
 	/*
 	 * Publish: there must be a barrier to ensure all changes to the page
@@ -142,8 +299,15 @@ __wt_page_modify_set(WT_PAGE *page)
 	 */
 	WT_WRITE_BARRIER();
 
-	/* The page is dirty if the disk and write generations differ. */
-	++page->modify->write_gen;
+	/*
+	 * The page is dirty if the disk and write generations differ.  Threads
+	 * modifying the page aren't serialized, the increment must be atomic.
+	 */
+	WT_ATOMIC_ADD(page->modify->write_gen, 1);
+
+	/* If the page was clean, its bytes are now dirty. */
+	if (page->modify->bytes_dirty == 0)
+		__wt_cache_dirty_incr(session, page);
 }
 
 /*
@@ -157,16 +321,6 @@ __wt_page_is_modified(WT_PAGE *page)
 	    page->modify->write_gen == page->modify->disk_gen ? 0 : 1);
 }
 
-/*
- * __wt_page_write_gen_check --
- *	Confirm the page's write generation number is correct.
- */
-static inline int
-__wt_page_write_gen_check(WT_PAGE *page, uint32_t write_gen)
-{
-	return (page->modify->write_gen == write_gen ? 0 : WT_RESTART);
-}
-
 /*
  * __wt_off_page --
  *	Return if a pointer references off-page data.
@@ -5,6 +5,12 @@
  * See the file LICENSE for redistribution information.
  */
 
+/*
+ * A cursor iterating through this many leaf pages is scanning, and the pages
+ * after it are read ahead.
+ */
+#define	WT_READ_AHEAD_TRIGGER	2
+
 /*
  * WT_EVICT_LIST --
  *	Encapsulation of an eviction candidate.
@@ -12,6 +18,7 @@
 struct __wt_evict_list {
 	WT_BTREE *btree;			/* File object */
 	WT_PAGE	 *page;				/* Page */
+	uint64_t  read_gen;			/* Queue sort key */
 };
 
 /*
@@ -28,6 +35,81 @@ struct __wt_evict_req {
 	uint32_t flags;
 };
 
+/*
+ * WT_READ_REQ --
+ *	Encapsulation of a read-ahead request.  The page's reference is set to
+ * WT_REF_READING when the request is queued, so the parent page can't be
+ * evicted until the page has been read.
+ */
+struct __wt_read_req {
+	WT_BTREE *btree;			/* Btree */
+	WT_PAGE	 *parent;			/* Parent page */
+	WT_REF	 *ref;				/* Page reference */
+};
+
+/*
+ * WT_EVICT_WORKER --
+ *	Encapsulation of an eviction worker thread.
+ */
+struct __wt_evict_worker {
+	WT_CONNECTION_IMPL *conn;		/* Enclosing connection */
+	u_int		 id;			/* Worker ID */
+	pthread_t	 tid;			/* Thread ID */
+	WT_CONDVAR	*cond;			/* Wait for work */
+
+	WT_EVICT_WORKER_STATS *stats;		/* Worker statistics */
+};
+
+/*
+ * WT_WARM_PAGE --
+ *	A page in the cache's saved working set.
+ */
+struct __wt_warm_page {
+	uint64_t read_gen;			/* Page read generation */
+	u_int	 file;				/* File slot */
+	uint32_t size;				/* Page's bytes in the cache */
+	int	 internal;			/* Internal page */
+	size_t	 addr_off;			/* Address cookie: offset */
+	const uint8_t *addr;			/* Loaded address cookie */
+	uint32_t addr_size;
+};
+
+/*
+ * WT_WARM_FILE --
+ *	A file in the cache's saved working set.
+ */
+struct __wt_warm_file {
+	const char *name;			/* Logical name */
+	const char *filename;			/* File name */
+	WT_WARM_PAGE *pages;			/* Pages sorted by address */
+	uint32_t npages;
+};
+
+/*
+ * WT_WARM --
+ *	The cache's working set: the addresses of the pages in the cache are
+ * saved as the connection closes, and read back into the cache by a pool of
+ * threads when it's next opened.
+ */
+struct __wt_warm {
+	WT_WARM_FILE *files;			/* Files */
+	size_t	 files_alloc;
+	u_int	 nfiles;
+	WT_WARM_PAGE *pages;			/* Pages */
+	size_t	 pages_alloc;
+	uint32_t npages;
+	WT_ITEM	 addrs;				/* Page address cookies */
+
+	int	 saving;			/* Save pages as files close */
+
+	u_int	 fill;				/* Percent of cache to fill */
+	volatile uint32_t next_file;		/* Next file to read */
+	volatile int stop;			/* Threads exit */
+	WT_CONDVAR *cond;			/* Threads wait to exit */
+	pthread_t *tids;			/* Thread IDs */
+	u_int	 nthreads;			/* Count of threads */
+};
+
 /*
  * WiredTiger cache structure.
  */
@@ -44,6 +126,7 @@ struct __wt_cache {
 	uint64_t bytes_inmem;		/* Bytes/pages created in memory */
 	uint64_t bytes_evict;		/* Bytes/pages discarded by eviction */
 	uint64_t pages_evict;
+	uint64_t bytes_dirty;		/* Bytes held by modified pages */
 
 	/*
 	 * Read information.
@@ -57,15 +140,61 @@ struct __wt_cache {
 
 	WT_SPINLOCK lru_lock;		/* Manage the eviction list. */
 
-	WT_EVICT_LIST *evict;		/* Pages being tracked for eviction */
-	WT_EVICT_LIST *evict_current;	/* Current page to be evicted */
-	size_t   evict_allocated;	/* Bytes allocated */
-	uint32_t evict_entries;		/* Total evict slots */
+	WT_EVICT_LIST *evict;		/* Eviction queue: a heap of pages */
+	uint32_t evict_count;		/* Pages in the queue */
+	uint32_t evict_taken;		/* Pages taken since the last walk */
+	uint32_t evict_candidates;	/* Pages to take since the last walk */
+	WT_EVICT_LIST *clean;		/* Cleaner queue: a heap of pages */
+	uint32_t clean_count;		/* Pages in the cleaner queue */
+	WT_BTREE *evict_file;		/* Last file walked */
+	volatile int evict_lru_stop;	/* Files closing: serve requests only */
+
+	uint64_t resize_target;		/* Cache size being shrunk to */
 
 	u_int eviction_trigger;		/* Percent to trigger eviction. */
 	u_int eviction_target;		/* Percent to end eviction. */
+	u_int eviction_dirty_trigger;	/* Percent dirty to trigger cleaning */
+	u_int eviction_dirty_target;	/* Percent dirty to end cleaning */
+
+#define	WT_EVICT_POLICY_LRU	0	/* Least-recently used */
+#define	WT_EVICT_POLICY_2Q	1	/* 2Q */
+#define	WT_EVICT_POLICY_CLOCKPRO 2	/* CLOCK-Pro */
+	u_int evict_policy;		/* Page replacement policy */
+	uint64_t evict_hot_in;		/* Pages moved into and out of the */
+	uint64_t evict_hot_out;		/* replacement policy's hot set */
+	int evict_hot_full;		/* Hot set has reached its target */
+
+	uint64_t evict_priority_gen;	/* Read generations per priority % */
+	uint32_t quota_over;		/* Files over their cache quota */
+
+	WT_CONDVAR *evict_waiter_cond;	/* Threads waiting for eviction */
+	uint32_t evict_waiters;		/* Count of waiting threads */
+
+	WT_EVICT_WORKER *workers;	/* Eviction worker threads */
+	u_int eviction_workers;		/* Count of eviction workers */
+	WT_CONDVAR *evict_worker_cond;	/* Server waits for the workers */
+
+	WT_CONDVAR *clean_cond;		/* Cleaners wait for dirty pages */
+	pthread_t *clean_tids;		/* Cleaner thread IDs */
+	u_int eviction_cleaners;	/* Count of cleaner threads */
 
 	WT_EVICT_REQ *evict_request;	/* Eviction requests:
 					   slot available if session is NULL */
 	uint32_t max_evict_request;	/* Size of the evict request array */
+
+	/*
+	 * Read-ahead information.
+	 */
+	u_int read_ahead;		/* Pages to read ahead of a scan */
+	WT_SPINLOCK read_lock;		/* Locked: read-ahead queue */
+	WT_READ_REQ *read_queue;	/* Read-ahead queue: circular array */
+	uint32_t read_queue_max;	/* Size of the read-ahead queue */
+	uint32_t read_queue_head;	/* Oldest request */
+	uint32_t read_queue_count;	/* Queued requests */
+	WT_CONDVAR *read_cond;		/* Read threads wait for requests */
+	WT_CONDVAR *read_done_cond;	/* Closing files wait for reads */
+	pthread_t *read_tids;		/* Read thread IDs */
+	u_int read_threads;		/* Count of read threads */
+
+	WT_WARM *warm;			/* Working set saved across opens */
 };
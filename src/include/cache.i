@@ -30,11 +30,54 @@ __wt_eviction_check(WT_SESSION_IMPL *session, int *read_lockoutp, int wake)
 	if (read_lockoutp != NULL)
 		*read_lockoutp = (bytes_inuse > bytes_max);
 
-	/* Wake eviction when we're over the trigger cache size. */
-	if (wake && bytes_inuse > cache->eviction_trigger * (bytes_max / 100))
+	/*
+	 * Wake eviction when we're over the trigger cache size, when too much
+	 * of the cache is dirty, or when the file is over its cache quota.
+	 */
+	if (wake &&
+	    (bytes_inuse > cache->eviction_trigger * (bytes_max / 100) ||
+	    __wt_cache_bytes_dirty(cache) >
+	    cache->eviction_dirty_trigger * (bytes_max / 100) ||
+	    (session->btree != NULL &&
+	    __wt_btree_over_quota(session->btree))))
 		__wt_evict_server_wake(session);
 }
 
+/*
+ * __wt_eviction_debt --
+ *	Return the number of pages a thread should evict before reading a
+ * page.  Between the eviction target and the cache size, threads reading
+ * pages evict pages in proportion to how far over the target the cache is,
+ * one page per page read once the cache is full.
+ */
+static inline u_int
+__wt_eviction_debt(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t bytes_inuse, bytes_max, bytes_target;
+	u_int pages;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	bytes_inuse = __wt_cache_bytes_inuse(cache);
+	bytes_max = conn->cache_size;
+	bytes_target = cache->eviction_target * (bytes_max / 100);
+	if (bytes_inuse <= bytes_target) {
+		session->evict_debt = 0;
+		return (0);
+	}
+
+	/* Accumulate the debt as a percentage of a page. */
+	session->evict_debt += bytes_inuse >= bytes_max ? 100 :
+	    (u_int)((bytes_inuse - bytes_target) * 100 /
+	    (bytes_max - bytes_target));
+	pages = session->evict_debt / 100;
+	session->evict_debt %= 100;
+	return (pages);
+}
+
 /*
  * __wt_eviction_page_check --
  *	Check if a page is too big and wake the eviction server if necessary.
@@ -56,7 +99,8 @@ __wt_eviction_page_check(WT_SESSION_IMPL *session, WT_PAGE *page)
 	    (page->memory_footprint > 20 * session->btree->maxleafpage))) {
 		/*
 		 * We're already inside a serialized function, so we need to
-		 * take some care.
+		 * take some care: the request doesn't wait for the eviction
+		 * server.
 		 */
 		WT_RET(__wt_evict_page_request(session, page));
 	} else
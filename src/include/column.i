@@ -58,22 +58,46 @@ __col_insert_search_match(WT_INSERT_HEAD *inshead, uint64_t recno)
  *	Search a column-store insert list, creating a skiplist stack as we go.
  */
 static inline WT_INSERT *
-__col_insert_search(
-    WT_INSERT_HEAD *inshead, WT_INSERT ***ins_stack, uint64_t recno)
+__col_insert_search(WT_INSERT_HEAD *inshead,
+    WT_INSERT ***ins_stack, WT_INSERT **next_stack, uint64_t recno)
 {
 	WT_INSERT **insp, *ret_ins;
 	uint64_t ins_recno;
 	int cmp, i;
 
-	/* If there's no insert chain to search, we're done. */
-	if ((ret_ins = WT_SKIP_LAST(inshead)) == NULL)
+	/*
+	 * If there's no insert chain to search, we're done.  Clear the stack
+	 * so modifying threads know it doesn't reference the list, one might
+	 * be created before they get to it.  An insert chain can be empty (if
+	 * the first insert into it was restarted), in which case the stack
+	 * references the chain's head.
+	 */
+	if ((ret_ins = WT_SKIP_LAST(inshead)) == NULL) {
+		for (i = 0; i < WT_SKIP_MAXDEPTH; i++) {
+			ins_stack[i] =
+			    inshead == NULL ? NULL : &inshead->head[i];
+			next_stack[i] = NULL;
+		}
 		return (NULL);
+	}
 
-	/* Fast path appends. */
+	/*
+	 * Fast path appends.
+	 *
+	 * We may race with another appending thread, and the list's tail
+	 * pointers may not yet reference its new item.  Build the bottom level
+	 * of the stack from the item we compared, and set the next stack to
+	 * NULL: if we raced, the bottom level's next pointer won't be NULL
+	 * when it's checked by the serialized insert function.
+	 */
 	if (recno >= WT_INSERT_RECNO(ret_ins)) {
-		for (i = 0; i < WT_SKIP_MAXDEPTH; i++)
+		for (i = WT_SKIP_MAXDEPTH - 1; i > 0; i--) {
 			ins_stack[i] = (inshead->tail[i] != NULL) ?
 			    &inshead->tail[i]->next[i] : &inshead->head[i];
+			next_stack[i] = NULL;
+		}
+		ins_stack[0] = &ret_ins->next[0];
+		next_stack[0] = NULL;
 		return (ret_ins);
 	}
 
@@ -82,22 +106,26 @@ __col_insert_search(
 	 * go as far as possible at each level before stepping down to the next.
 	 */
 	for (i = WT_SKIP_MAXDEPTH - 1, insp = &inshead->head[i]; i >= 0; ) {
-		if (*insp == NULL) {
+		if ((ret_ins = *insp) == NULL) {
+			next_stack[i] = NULL;
 			ins_stack[i--] = insp--;
 			continue;
 		}
 
-		ret_ins = *insp;
 		ins_recno = WT_INSERT_RECNO(ret_ins);
 		cmp = (recno == ins_recno) ? 0 : (recno < ins_recno) ? -1 : 1;
 
 		if (cmp > 0)			/* Keep going at this level */
-			insp = &(*insp)->next[i];
+			insp = &ret_ins->next[i];
 		else if (cmp == 0)		/* Exact match: return */
-			for (; i >= 0; i--)
+			for (; i >= 0; i--) {
+				next_stack[i] = ret_ins->next[i];
 				ins_stack[i] = &ret_ins->next[i];
-		else				/* Drop down a level */
+			}
+		else {				/* Drop down a level */
+			next_stack[i] = ret_ins;
 			ins_stack[i--] = insp--;
+		}
 	}
 	return (ret_ins);
 }
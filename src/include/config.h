@@ -21,3 +21,45 @@ struct __wt_config_item {
 	int64_t val;
 	enum { ITEM_STRING, ITEM_ID, ITEM_NUM, ITEM_STRUCT } type;
 };
+
+/*
+ * WT_CONFIG_METHOD --
+ *	A method's name and the check string used to validate its configuration
+ * strings, generated by dist/config.py.
+ */
+struct __wt_config_method {
+	const char *method;		/* Method name */
+	const char **checks;		/* Method's check string */
+};
+
+/*
+ * WT_CONFIG_PARSED --
+ *	A configuration string parsed into an open-addressing hash table of its
+ * keys, so keys can be found without re-tokenizing the string.  A parsed
+ * string matches any string with the same contents: values are stored as
+ * offsets and returned relative to the caller's string.
+ *
+ * Sessions cache recently parsed strings, and compiled strings (created by
+ * WT_CONNECTION::compile_configuration) are shared by all of the connection's
+ * sessions.
+ */
+#define	WT_CONFIG_CACHE_SIZE		16	/* Session cache entries */
+#define	WT_CONFIG_COMPILED_MAX		64	/* Compiled strings */
+#define	WT_CONFIG_COMPILED_SLOTS	128	/* Compiled string hash slots */
+struct __wt_config_parsed_item {
+	size_t	koff, klen;		/* Key offset, length (0 if empty) */
+	size_t	voff;			/* Value offset */
+	WT_CONFIG_ITEM value;		/* Value */
+};
+
+struct __wt_config_parsed {
+	const char *str;		/* String pointer */
+	char	   *copy;		/* String contents */
+	size_t	    len;		/* String length */
+
+	const char *checked;		/* Check string validated against */
+	uint64_t    lru;		/* Session cache: last use */
+
+	WT_CONFIG_PARSED_ITEM *slots;	/* Hash table */
+	u_int	    nslots;		/* Hash table slots (power of 2) */
+};
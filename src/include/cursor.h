@@ -14,9 +14,9 @@ struct __wt_cursor_btree {
 	 * The following fields are set by the search functions as a precursor
 	 * to page modification: we have a page, a WT_COL/WT_ROW slot on the
 	 * page, an insert head, insert list and a skiplist stack (the stack of
-	 * skiplist entries leading to the insert point).  The search functions
-	 * also return the relationship of the search key to the found key and
-	 * a write-generation for the leaf page.
+	 * skiplist entries leading to the insert point, and the entries they
+	 * referenced when the search read them).  The search functions also
+	 * return the relationship of the search key to the found key.
 	 */
 	WT_PAGE	  *page;		/* Current page */
 	uint32_t   slot;		/* WT_COL/WT_ROW 0-based slot */
@@ -25,9 +25,17 @@ struct __wt_cursor_btree {
 	WT_INSERT	*ins;		/* Current insert node */
 					/* Search stack */
 	WT_INSERT	**ins_stack[WT_SKIP_MAXDEPTH];
+					/* Search stack next items */
+	WT_INSERT	*next_stack[WT_SKIP_MAXDEPTH];
 
 	uint64_t recno;			/* Record number */
-	uint32_t write_gen;		/* Saved leaf page's write generation */
+
+	/*
+	 * Leaf pages the cursor has reached by iterating since its last search:
+	 * a cursor moving through enough pages is scanning, and the following
+	 * pages are read ahead of it.
+	 */
+	uint32_t page_walks;
 
 	/*
 	 * The search function sets compare to:
@@ -116,6 +124,24 @@ struct __wt_cursor_bulk {
 	uint32_t nrecs;				/* Max records per chunk */
 };
 
+/*
+ * WT_CURSOR_CACHE --
+ *	A cursor opened with cursor caching configured: closing the cursor
+ * parks it in the session's cache, where a later open with the same URI and
+ * configuration finds it.
+ */
+struct __wt_cursor_cache {
+	WT_CURSOR *cursor;		/* Cached cursor */
+	const char *uri;		/* WT_SESSION->open_cursor URI */
+	const char *config;		/* WT_SESSION->open_cursor config */
+	uint64_t hash;			/* URI hash */
+
+					/* Cursor's original close method */
+	int (*close)(WT_CURSOR *);
+
+	TAILQ_ENTRY(__wt_cursor_cache) q;
+};
+
 struct __wt_cursor_config {
 	WT_CURSOR iface;
 };
@@ -139,6 +165,8 @@ struct __wt_cursor_stat {
 
 	WT_STATS *stats_first;		/* First stats reference */
 	int	  stats_count;		/* Count of stats elements */
+	u_int	  stats_slots;		/* Count of stats shards */
+	size_t	  stats_size;		/* Size of a stats shard */
 
 	int	 notpositioned;		/* Cursor not positioned */
 
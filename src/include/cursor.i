@@ -22,7 +22,8 @@ __cursor_search_clear(WT_CURSOR_BTREE *cbt)
 	/* We don't bother clearing the insert stack, that's more expensive. */
 
 	cbt->recno = 0;				/* Illegal value */
-	cbt->write_gen = 0;
+
+	cbt->page_walks = 0;
 
 	cbt->compare = 2;			/* Illegal value */
 
@@ -79,12 +80,38 @@ __cursor_func_resolve(WT_CURSOR_BTREE *cbt, int ret)
 	}
 }
 
+/*
+ * __cursor_read_ahead --
+ *	The cursor has iterated to a new leaf page: if it looks like a scan,
+ * read the following pages ahead of it.
+ */
+static inline int
+__cursor_read_ahead(WT_CURSOR_BTREE *cbt, int next)
+{
+	WT_PAGE *page;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)cbt->iface.session;
+	page = cbt->page;
+
+	if (S2C(session)->cache->read_ahead == 0 ||
+	    ++cbt->page_walks < WT_READ_AHEAD_TRIGGER)
+		return (0);
+
+	if (page->read_ahead && WT_ATOMIC_CAS(page->read_ahead, 1, 0))
+		WT_CSTAT_INCR(session, read_ahead_hit);
+	else
+		WT_CSTAT_INCR(session, read_ahead_miss);
+	return (__wt_cache_read_ahead(session, page, next));
+}
+
 /*
  * __cursor_row_slot_return --
- *	Return a WT_ROW slot's K/V pair.
+ *	Return a WT_ROW slot's K/V pair, given the slot's visible update, if
+ * any.
  */
 static inline int
-__cursor_row_slot_return(WT_CURSOR_BTREE *cbt, WT_ROW *rip)
+__cursor_row_slot_return(WT_CURSOR_BTREE *cbt, WT_ROW *rip, WT_UPDATE *upd)
 {
 	WT_BTREE *btree;
 	WT_ITEM *kb, *vb;
@@ -92,7 +119,6 @@ __cursor_row_slot_return(WT_CURSOR_BTREE *cbt, WT_ROW *rip)
 	WT_CELL_UNPACK *unpack, _unpack;
 	WT_IKEY *ikey;
 	WT_SESSION_IMPL *session;
-	WT_UPDATE *upd;
 	void *key;
 
 	session = (WT_SESSION_IMPL *)cbt->iface.session;
@@ -174,11 +200,11 @@ slow:			WT_RET(__wt_row_key(session, cbt->page, rip, kb));
 	}
 
 	/*
-	 * If the item was ever modified, use the WT_UPDATE data.
+	 * If the item was modified, use the WT_UPDATE data.
 	 * Else, check for empty data.
 	 * Else, use the value from the original disk image.
 	 */
-	if ((upd = WT_ROW_UPDATE(cbt->page, rip)) != NULL) {
+	if (upd != NULL) {
 		vb->data = WT_UPDATE_DATA(upd);
 		vb->size = upd->size;
 	} else if ((cell = __wt_row_value(cbt->page, rip)) == NULL) {
@@ -19,6 +19,11 @@ extern int __wt_block_addr_string(WT_SESSION_IMPL *session,
     WT_ITEM *buf,
     const uint8_t *addr,
     uint32_t addr_size);
+extern int __wt_block_checkpoint_start(WT_SESSION_IMPL *session,
+    WT_BLOCK *block);
+extern int __wt_block_checkpoint_resolve( WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    int failed);
 extern uint32_t __wt_cksum(const void *chunk, size_t len);
 extern int __wt_block_alloc( WT_SESSION_IMPL *session,
     WT_BLOCK *block,
@@ -41,6 +46,9 @@ extern int __wt_block_extlist_read(WT_SESSION_IMPL *session,
 extern void __wt_block_freelist_open(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern void __wt_block_freelist_close(WT_SESSION_IMPL *session,
     WT_BLOCK *block);
+extern int __wt_block_extlist_merge(WT_SESSION_IMPL *session,
+    WT_EXTLIST *a,
+    WT_EXTLIST *b);
 extern int __wt_block_extlist_write(WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     WT_EXTLIST *el,
@@ -48,6 +56,7 @@ extern int __wt_block_extlist_write(WT_SESSION_IMPL *session,
     uint32_t *sizep,
     uint32_t *cksump);
 extern void __wt_block_discard(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern void __wt_block_extlist_free(WT_SESSION_IMPL *session, WT_EXTLIST *el);
 extern void __wt_block_stat(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_bm_addr_valid( WT_SESSION_IMPL *session,
     const uint8_t *addr,
@@ -59,6 +68,10 @@ extern int __wt_bm_addr_string(WT_SESSION_IMPL *session,
     WT_ITEM *buf,
     const uint8_t *addr,
     uint32_t addr_size);
+extern int __wt_bm_addr_offset(WT_SESSION_IMPL *session,
+    const uint8_t *addr,
+    uint32_t addr_size,
+    off_t *offsetp);
 extern int __wt_bm_create(WT_SESSION_IMPL *session, const char *filename);
 extern int __wt_bm_open(WT_SESSION_IMPL *session,
     const char *filename,
@@ -80,6 +93,10 @@ extern int __wt_bm_write( WT_SESSION_IMPL *session,
     WT_ITEM *buf,
     uint8_t *addr,
     uint32_t *addr_size);
+extern int __wt_bm_sync(WT_SESSION_IMPL *session);
+extern int __wt_bm_flush(WT_SESSION_IMPL *session);
+extern int __wt_bm_checkpoint_start(WT_SESSION_IMPL *session);
+extern int __wt_bm_checkpoint_resolve(WT_SESSION_IMPL *session, int failed);
 extern int __wt_bm_stat(WT_SESSION_IMPL *session);
 extern int __wt_bm_salvage_start(WT_SESSION_IMPL *session);
 extern int __wt_bm_salvage_next(WT_SESSION_IMPL *session,
@@ -104,6 +121,26 @@ extern int __wt_block_open(WT_SESSION_IMPL *session,
     void *retp);
 extern int __wt_block_close(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_desc_init(WT_SESSION_IMPL *session, WT_FH *fh);
+extern int __wt_desc_update(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_write_queue_create(WT_CONNECTION_IMPL *conn, const char *cfg[]);
+extern void __wt_write_queue_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_block_queue_write(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    uint32_t size,
+    const void *mem);
+extern int __wt_block_queue_read(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    uint32_t size,
+    void *mem,
+    int *foundp);
+extern void __wt_block_queue_wait(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset);
+extern int __wt_block_queue_drain(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern void __wt_block_queue_page_out(WT_SESSION_IMPL *session, WT_PAGE *page);
+extern void *__wt_write_server(void *arg);
 extern int __wt_block_read_buf(WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     WT_ITEM *buf,
@@ -151,10 +188,20 @@ extern int __wt_block_write(WT_SESSION_IMPL *session,
     off_t *offsetp,
     uint32_t *sizep,
     uint32_t *cksump);
+extern int __wt_page_arena_alloc( WT_SESSION_IMPL *session,
+    WT_PAGE *page,
+    size_t size,
+    void *retp);
+extern void __wt_page_arena_free( WT_SESSION_IMPL *session,
+    WT_PAGE *page,
+    void *p,
+    size_t size);
+extern void __wt_page_arena_discard(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_bulk_init(WT_CURSOR_BULK *cbulk);
 extern int __wt_bulk_insert(WT_CURSOR_BULK *cbulk);
 extern int __wt_bulk_end(WT_CURSOR_BULK *cbulk);
 extern int __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[]);
+extern int __wt_cache_reconfigure(WT_SESSION_IMPL *session, const char *cfg[]);
 extern void __wt_cache_stats_update(WT_CONNECTION_IMPL *conn);
 extern void __wt_cache_destroy(WT_CONNECTION_IMPL *conn);
 extern int __wt_cell_copy(WT_SESSION_IMPL *session,
@@ -197,7 +244,11 @@ extern void __wt_evict_server_wake(WT_SESSION_IMPL *session);
 extern void __wt_evict_file_serial_func(WT_SESSION_IMPL *session);
 extern int __wt_evict_page_request(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern void *__wt_cache_evict_server(void *arg);
-extern int __wt_evict_lru_page(WT_SESSION_IMPL *session, int is_app);
+extern void *__wt_cache_evict_worker(void *arg);
+extern void *__wt_cache_clean_server(void *arg);
+extern int __wt_evict_lru_page(WT_SESSION_IMPL *session,
+    int is_app,
+    int *evictedp);
 extern int __wt_btree_create(WT_SESSION_IMPL *session, const char *filename);
 extern int __wt_btree_truncate(WT_SESSION_IMPL *session, const char *filename);
 extern int __wt_btree_open(WT_SESSION_IMPL *session,
@@ -235,15 +286,21 @@ extern int __wt_page_inmem(WT_SESSION_IMPL *session,
     WT_PAGE_HEADER *dsk,
     size_t *inmem_sizep,
     WT_PAGE **pagep);
-extern int __wt_cache_read(WT_SESSION_IMPL *session,
+extern int __wt_cache_read( WT_SESSION_IMPL *session,
     WT_PAGE *parent,
-    WT_REF *ref);
+    WT_REF *ref,
+    int read_ahead);
+extern int __wt_cache_read_ahead(WT_SESSION_IMPL *session,
+    WT_PAGE *page,
+    int next);
+extern void *__wt_cache_read_server(void *arg);
 extern int __wt_kv_return(WT_SESSION_IMPL *session,
     WT_CURSOR_BTREE *cbt,
     int key_ret);
 extern int __wt_salvage(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_btree_stat_init(WT_SESSION_IMPL *session);
 extern int __wt_btree_sync(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_btree_checkpoint(WT_SESSION_IMPL *session, int force);
 extern int __wt_upgrade(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_verify(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_dumpfile(WT_SESSION_IMPL *session, const char *cfg[]);
@@ -255,6 +312,13 @@ extern int __wt_tree_np(WT_SESSION_IMPL *session,
     WT_PAGE **pagep,
     int eviction,
     int next);
+extern int __wt_cache_warm_create(WT_CONNECTION_IMPL *conn, const char *cfg[]);
+extern void __wt_cache_warm_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_cache_warm_start(WT_CONNECTION_IMPL *conn);
+extern int __wt_cache_warm_stop(WT_CONNECTION_IMPL *conn);
+extern int __wt_cache_warm_page(WT_SESSION_IMPL *session, WT_PAGE *page);
+extern int __wt_cache_warm_save(WT_CONNECTION_IMPL *conn);
+extern void *__wt_cache_warm_server(void *arg);
 extern int __wt_col_modify(WT_SESSION_IMPL *session,
     WT_CURSOR_BTREE *cbt,
     int op);
@@ -302,6 +366,7 @@ extern int __wt_row_key( WT_SESSION_IMPL *session,
     WT_ITEM *retb);
 extern WT_CELL *__wt_row_value(WT_PAGE *page, WT_ROW *rip);
 extern int __wt_row_ikey_alloc(WT_SESSION_IMPL *session,
+    WT_PAGE *page,
     uint32_t cell_offset,
     const void *key,
     uint32_t size,
@@ -311,12 +376,14 @@ extern int __wt_row_modify(WT_SESSION_IMPL *session,
     WT_CURSOR_BTREE *cbt,
     int is_remove);
 extern int __wt_row_insert_alloc(WT_SESSION_IMPL *session,
+    WT_PAGE *page,
     WT_ITEM *key,
     u_int skipdepth,
     WT_INSERT **insp,
     size_t *ins_sizep);
 extern void __wt_insert_serial_func(WT_SESSION_IMPL *session);
 extern int __wt_update_alloc(WT_SESSION_IMPL *session,
+    WT_PAGE *page,
     WT_ITEM *value,
     WT_UPDATE **updp,
     size_t *sizep);
@@ -368,6 +435,24 @@ extern  int __wt_config_subgets(WT_SESSION_IMPL *session,
     WT_CONFIG_ITEM *cfg,
     const char *key,
     WT_CONFIG_ITEM *value);
+extern int __wt_config_cache_get( WT_SESSION_IMPL *session,
+    const char *str,
+    WT_CONFIG_PARSED **cpp);
+extern int __wt_config_cache_find(WT_CONFIG_PARSED *cp,
+    const char *str,
+    WT_CONFIG_ITEM *key,
+    WT_CONFIG_ITEM *value);
+extern int __wt_config_cache_checked(WT_SESSION_IMPL *session,
+    const char *checks,
+    const char *config,
+    int set,
+    int *checkedp);
+extern void __wt_config_cache_discard(WT_SESSION_IMPL *session);
+extern int __wt_config_compile(WT_SESSION_IMPL *session,
+    const char *method,
+    const char *config,
+    const char **compiledp);
+extern void __wt_config_compile_discard(WT_SESSION_IMPL *session);
 extern int __wt_config_check(WT_SESSION_IMPL *session,
     const char *checks,
     const char *config);
@@ -393,6 +478,8 @@ extern const char *__wt_confdfl_connection_load_extension;
 extern const char *__wt_confchk_connection_load_extension;
 extern const char *__wt_confdfl_connection_open_session;
 extern const char *__wt_confchk_connection_open_session;
+extern const char *__wt_confdfl_connection_reconfigure;
+extern const char *__wt_confchk_connection_reconfigure;
 extern const char *__wt_confdfl_cursor_close;
 extern const char *__wt_confchk_cursor_close;
 extern const char *__wt_confdfl_file_meta;
@@ -425,6 +512,8 @@ extern const char *__wt_confdfl_session_salvage;
 extern const char *__wt_confchk_session_salvage;
 extern const char *__wt_confdfl_session_sync;
 extern const char *__wt_confchk_session_sync;
+extern const char *__wt_confdfl_session_transaction_sync;
+extern const char *__wt_confchk_session_transaction_sync;
 extern const char *__wt_confdfl_session_truncate;
 extern const char *__wt_confchk_session_truncate;
 extern const char *__wt_confdfl_session_upgrade;
@@ -435,6 +524,7 @@ extern const char *__wt_confdfl_table_meta;
 extern const char *__wt_confchk_table_meta;
 extern const char *__wt_confdfl_wiredtiger_open;
 extern const char *__wt_confchk_wiredtiger_open;
+extern WT_CONFIG_METHOD __wt_config_methods[];
 extern int __wt_conn_btree_open(WT_SESSION_IMPL *session,
     const char *name,
     const char *filename,
@@ -452,6 +542,16 @@ extern int __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[]);
 extern int __wt_connection_close(WT_CONNECTION_IMPL *conn);
 extern void __wt_conn_stat_init(WT_SESSION_IMPL *session);
 extern int __wt_curbulk_init(WT_CURSOR_BULK *cbulk);
+extern int __wt_cursor_cache_get(WT_SESSION_IMPL *session,
+    const char *uri,
+    const char *config,
+    WT_CURSOR **cursorp);
+extern int __wt_cursor_cache_add(WT_SESSION_IMPL *session,
+    const char *uri,
+    const char *config,
+    const char *cfg[],
+    WT_CURSOR *cursor);
+extern int __wt_cursor_cache_discard(WT_SESSION_IMPL *session);
 extern int __wt_curconfig_open(WT_SESSION_IMPL *session,
     const char *uri,
     const char *cfg[],
@@ -501,7 +601,18 @@ extern int __wt_curtable_open(WT_SESSION_IMPL *session,
     const char *uri,
     const char *cfg[],
     WT_CURSOR **cursorp);
-extern int __wt_log_put(WT_SESSION_IMPL *session, WT_LOGREC_DESC *recdesc, ...);
+extern int __wt_log_open(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_log_close(WT_SESSION_IMPL *session);
+extern int __wt_log_write(WT_SESSION_IMPL *session,
+    WT_ITEM *record,
+    WT_LSN *lsnp,
+    uint32_t flags);
+extern int __wt_log_put(WT_SESSION_IMPL *session,
+    WT_LSN *lsnp,
+    uint32_t flags,
+    WT_LOGREC_DESC *recdesc,
+    ...);
+extern int __wt_log_op(WT_SESSION_IMPL *session, WT_LOGREC_DESC *recdesc, ...);
 extern int __wt_log_vprintf(WT_SESSION_IMPL *session,
     const char *fmt,
     va_list ap);
@@ -510,7 +621,31 @@ extern int __wt_log_printf(WT_SESSION_IMPL *session,
     ...) WT_GCC_ATTRIBUTE((format (printf,
     2,
     3)));
+extern int __wt_log_sync(WT_SESSION_IMPL *session);
+extern uint64_t __wt_log_bytes(WT_SESSION_IMPL *session,
+    WT_LSN from,
+    WT_LSN to);
+extern int __wt_log_wait(WT_SESSION_IMPL *session, WT_LSN lsn);
+extern void __wt_log_background(WT_SESSION_IMPL *session, WT_LSN lsn);
+extern void *__wt_log_flush_server(void *arg);
+extern int __wt_log_scan(WT_SESSION_IMPL *session,
+    WT_LSN start,
+    int (*func)(WT_SESSION_IMPL *,
+    WT_LSN,
+    WT_LOG_RECORD *,
+    void *),
+    void *cookie,
+    WT_LSN *endp);
+extern int __wt_log_truncate(WT_SESSION_IMPL *session, WT_LSN lsn);
+extern void __wt_log_archive(WT_SESSION_IMPL *session, WT_LSN lsn);
+extern void *__wt_log_prep_server(void *arg);
 extern WT_LOGREC_DESC __wt_logdesc_debug;
+extern WT_LOGREC_DESC __wt_logdesc_commit;
+extern WT_LOGREC_DESC __wt_logdesc_row_put;
+extern WT_LOGREC_DESC __wt_logdesc_row_remove;
+extern WT_LOGREC_DESC __wt_logdesc_col_put;
+extern WT_LOGREC_DESC __wt_logdesc_col_remove;
+extern WT_LOGREC_DESC *__wt_logdesc_table[];
 extern void __wt_abort(WT_SESSION_IMPL *session);
 extern int __wt_calloc(WT_SESSION_IMPL *session,
     size_t number,
@@ -530,6 +665,10 @@ extern int __wt_strndup(WT_SESSION_IMPL *session,
     void *retp);
 extern int __wt_strdup(WT_SESSION_IMPL *session, const char *str, void *retp);
 extern void __wt_free_int(WT_SESSION_IMPL *session, void *p_arg);
+extern int __wt_dirlist(WT_SESSION_IMPL *session,
+    const char *prefix,
+    char ***namesp,
+    u_int *countp);
 extern int __wt_dlopen(WT_SESSION_IMPL *session,
     const char *path,
     WT_DLH **dlhp);
@@ -551,12 +690,16 @@ extern int __wt_cond_alloc(WT_SESSION_IMPL *session,
     int is_locked,
     WT_CONDVAR **condp);
 extern void __wt_cond_wait(WT_SESSION_IMPL *session, WT_CONDVAR *cond);
+extern void __wt_cond_wait_timed(WT_SESSION_IMPL *session,
+    WT_CONDVAR *cond,
+    long usecs);
 extern void __wt_cond_signal(WT_SESSION_IMPL *session, WT_CONDVAR *cond);
 extern int __wt_cond_destroy(WT_SESSION_IMPL *session, WT_CONDVAR *cond);
 extern int __wt_rwlock_alloc( WT_SESSION_IMPL *session,
     const char *name,
     WT_RWLOCK **rwlockp);
 extern void __wt_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
+extern int __wt_try_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
 extern int __wt_try_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
 extern void __wt_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
 extern void __wt_rwunlock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
@@ -776,7 +919,8 @@ extern int __wt_btree_free_root(WT_SESSION_IMPL *session);
 extern int __wt_btree_set_root(WT_SESSION_IMPL *session,
     const char *filename,
     const uint8_t *addr,
-    uint32_t size);
+    uint32_t size,
+    const WT_LSN *lsnp);
 extern void __wt_eventv(WT_SESSION_IMPL *session,
     int msg_event,
     int error,
@@ -822,6 +966,7 @@ extern int __wt_filename(WT_SESSION_IMPL *session,
 extern int __wt_library_init(void);
 extern int __wt_breakpoint(void);
 extern void __wt_attach(WT_SESSION_IMPL *session);
+extern uint64_t __wt_hash_fnv64(const void *string, size_t len);
 extern int
 __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref
 #ifdef HAVE_DIAGNOSTIC
@@ -830,6 +975,8 @@ __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref
  );
 extern void __wt_hazard_clear(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern void __wt_hazard_empty(WT_SESSION_IMPL *session);
+extern void __wt_hazard_page_free(WT_SESSION_IMPL *session, WT_PAGE *page);
+extern void __wt_hazard_page_drain(WT_SESSION_IMPL *session, int force);
 extern void __wt_hazard_validate(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_raw_to_hex(WT_SESSION_IMPL *session,
     const uint8_t *from,
@@ -905,8 +1052,39 @@ extern void __wt_scr_free_ext(WT_SESSION *wt_session, void *p);
 extern void __wt_session_dump_all(WT_SESSION_IMPL *session);
 extern void __wt_session_dump(WT_SESSION_IMPL *session);
 extern int __wt_stat_alloc_btree_stats(WT_SESSION_IMPL *session,
+    u_int slots,
     WT_BTREE_STATS **statsp);
 extern void __wt_stat_clear_btree_stats(WT_STATS *stats_arg);
 extern int __wt_stat_alloc_connection_stats(WT_SESSION_IMPL *session,
+    u_int slots,
     WT_CONNECTION_STATS **statsp);
 extern void __wt_stat_clear_connection_stats(WT_STATS *stats_arg);
+extern int __wt_stat_alloc_evict_worker_stats(WT_SESSION_IMPL *session,
+    u_int slots,
+    WT_EVICT_WORKER_STATS **statsp);
+extern void __wt_stat_clear_evict_worker_stats(WT_STATS *stats_arg);
+extern int __wt_txn_global_init(WT_CONNECTION_IMPL *conn);
+extern void __wt_txn_global_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_txn_init(WT_SESSION_IMPL *session, WT_TXN_STATE *state);
+extern void __wt_txn_destroy(WT_SESSION_IMPL *session);
+extern void __wt_txn_get_snapshot(WT_SESSION_IMPL *session, uint64_t my_id);
+extern uint64_t __wt_txn_oldest(WT_SESSION_IMPL *session);
+extern int __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_txn_sync(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_checkpoint(WT_SESSION_IMPL *session, const char *cfg[]);
+extern void __wt_checkpoint_stall(WT_SESSION_IMPL *session, uint64_t usecs);
+extern int __wt_recover(WT_CONNECTION_IMPL *conn, const char *cfg[]);
+extern int __wt_logapply_row_put( WT_SESSION_IMPL *session,
+    WT_CURSOR *cursor,
+    WT_LOG_RECORD *logrec);
+extern int __wt_logapply_row_remove( WT_SESSION_IMPL *session,
+    WT_CURSOR *cursor,
+    WT_LOG_RECORD *logrec);
+extern int __wt_logapply_col_put( WT_SESSION_IMPL *session,
+    WT_CURSOR *cursor,
+    WT_LOG_RECORD *logrec);
+extern int __wt_logapply_col_remove( WT_SESSION_IMPL *session,
+    WT_CURSOR *cursor,
+    WT_LOG_RECORD *logrec);
@@ -5,7 +5,13 @@
  * See the file LICENSE for redistribution information.
  */
 
-#define	WT_LOG_FILENAME	"WiredTiger.log"		/* Log file name */
+/*
+ * Log files are named by appending the file's number to WT_LOG_FILENAME, the
+ * spare file is pre-allocated for the next log file.
+ */
+#define	WT_LOG_FILENAME	"WiredTiger.log"		/* Log file prefix */
+#define	WT_LOG_FILENAME_MAX	(sizeof(WT_LOG_FILENAME) + 12)
+#define	WT_LOG_SPARE	"WiredTiger.logspare"		/* Spare log file */
 
 /* Logging subsystem declarations. */
 typedef enum {
@@ -16,9 +22,135 @@ typedef enum {
 	WT_LOGREC_INT64,
 	WT_LOGREC_UINT64,
 	WT_LOGREC_STRING,
+	WT_LOGREC_ITEM,
 } WT_LOGREC_FIELDTYPE;
 
+/*
+ * WT_LOGREC_DESC --
+ *	A log record type.  Records changing a single file start with the
+ * file's ID, and recovery replays them with the type's apply function.
+ */
 typedef struct {
+	uint32_t type;
+	const char *name;		/* Record type name */
 	const char *fmt;
+					/* Replay a record */
+	int (*apply)(WT_SESSION_IMPL *, WT_CURSOR *, WT_LOG_RECORD *);
 	const char *fields[];
 } WT_LOGREC_DESC;
+
+/*
+ * WT_LSN --
+ *	A log sequence number: the log file number in the high 32 bits and the
+ * byte offset in the file in the low 32 bits, so LSNs compare as integers and
+ * are read and written in a single operation.
+ */
+typedef uint64_t WT_LSN;
+#define	WT_LSN_FILE(lsn)	((uint32_t)((lsn) >> 32))
+#define	WT_LSN_OFFSET(lsn)	((uint32_t)(lsn))
+#define	WT_LSN_MAKE(file, offset)					\
+	(((uint64_t)(file) << 32) | (uint32_t)(offset))
+
+/*
+ * WT_LOG_RECORD --
+ *	The header of a record in the log file.
+ */
+struct __wt_log_record {
+	uint32_t len;			/* Record length, including header */
+	uint32_t checksum;		/* Checksum, calculated as zero */
+	uint16_t rectype;		/* Record type */
+	uint16_t flags;
+#define	WT_LOG_RECORD_COMPRESSED	0x01	/* Packed record compressed */
+	uint32_t lsn_file;		/* Log file number */
+
+	/*
+	 * The packed record immediately follows the WT_LOG_RECORD structure.
+	 * In a compressed record, it's the packed record's length (a uint32_t)
+	 * followed by the compressed bytes.
+	 */
+#define	WT_LOG_RECORD_DATA(r)						\
+	((uint8_t *)(r) + sizeof(WT_LOG_RECORD))
+};
+
+/*
+ * WT_LOG_SLOT --
+ *	Records are collected into slots, a slot is written (and optionally
+ * synced) by a single thread on behalf of all of the threads that copied
+ * records into it.
+ *
+ * Threads join the active slot by atomically adding their record's length to
+ * the slot's state, the previous value is the record's offset in the slot's
+ * buffer.  The thread joining at offset 0 is the slot's leader: it waits for
+ * the earlier slots to be written, closes the slot, activates a new slot for
+ * the next group, waits for the other threads to finish copying, and writes
+ * the slot.
+ *
+ * Waits for a slot to be activated, copied, written or synced can last as long
+ * as a write and sync: threads yield for a while, then sleep on the log's slot
+ * condition variable, signalled whenever one of those changes or a write fails.
+ */
+struct __wt_log_slot {
+	volatile int64_t state;		/* Bytes joined, or closed/free */
+#define	WT_LOG_SLOT_CLOSED	(-1)
+#define	WT_LOG_SLOT_FREE	(-2)
+	volatile int64_t released;	/* Bytes copied into the buffer */
+	volatile uint32_t records;	/* Records copied into the buffer */
+	volatile int sync;		/* A record requires a sync */
+
+	WT_LSN	 start_lsn;		/* LSN of the first record */
+	uint8_t	*buf;			/* Record buffer */
+};
+
+#define	WT_LOG_SLOT_BUF_SIZE	(256 * 1024)	/* Slot buffer size */
+#define	WT_LOG_SLOT_POOL	4		/* Slots */
+#define	WT_LOG_SLOT_SPINS	100		/* Yields before sleeping */
+
+#define	WT_LOG_SCAN_BUF_SIZE	(1024 * 1024)	/* Recovery read size */
+#define	WT_LOG_PREP_BUF_SIZE	(1024 * 1024)	/* Pre-allocation write size */
+
+#define	WT_LOG_COMPRESS_MIN	128		/* Smallest record compressed */
+
+/*
+ * WT_LOG --
+ *	The connection's log.
+ */
+struct __wt_log {
+	WT_FH	*fh;			/* Current log file handle */
+	WT_RWLOCK *fh_rwlock;		/* Log file switch lock */
+	uint32_t fileid;		/* Current log file number */
+	uint32_t first_file;		/* Oldest log file */
+	uint32_t last_file;		/* Newest log file when opened */
+	off_t	 file_size;		/* Log file size */
+
+	WT_COMPRESSOR *compressor;	/* Record compressor */
+
+	WT_LOG_SLOT * volatile slot_active;	/* Slot being joined */
+	WT_LOG_SLOT slot_pool[WT_LOG_SLOT_POOL];
+
+	volatile WT_LSN write_lsn;	/* End of the written records */
+	volatile WT_LSN sync_lsn;	/* End of the synced records */
+
+	WT_CONDVAR *slot_cond;		/* Slot change wait */
+	volatile uint64_t slot_gen;	/* Slot change generation */
+	volatile uint32_t slot_waiters;	/* Threads sleeping on slot_cond */
+
+	/*
+	 * Background commits ask the log flush thread to sync the log, which
+	 * it does when the period expires or, if enough bytes of background
+	 * commit records are waiting, as soon as it's woken.
+	 */
+	WT_CONDVAR *flush_cond;		/* Log flush thread wait */
+	volatile WT_LSN flush_lsn;	/* End of the records to sync */
+	long	 flush_usecs;		/* Flush period */
+	uint64_t flush_bytes;		/* Wake the thread after bytes */
+
+	/*
+	 * The log prep thread keeps a spare log file ready for the next switch
+	 * and archives the files checkpoints no longer need.
+	 */
+	WT_CONDVAR *prep_cond;		/* Log prep thread wait */
+	volatile int spare_ready;	/* Spare log file is ready */
+	volatile uint32_t archive_file;	/* Archive files preceding */
+
+	volatile int error;		/* Write or sync failed */
+};
@@ -1,7 +1,51 @@
 /* DO NOT EDIT: automatically built by dist/log.py. */
 
+#define	WT_LOGREC_MAX	6		/* Largest log record type */
+
+static inline int
+__wt_logput_debug(WT_SESSION_IMPL *session,
+    WT_LSN *lsnp, uint32_t flags, const char * message)
+{
+	return (__wt_log_put(
+	    session, lsnp, flags, &__wt_logdesc_debug, message));
+}
+
+static inline int
+__wt_logput_commit(WT_SESSION_IMPL *session,
+    WT_LSN *lsnp, uint32_t flags, uint64_t txnid, WT_ITEM * ops)
+{
+	return (__wt_log_put(
+	    session, lsnp, flags, &__wt_logdesc_commit, txnid, ops));
+}
+
+static inline int
+__wt_logop_row_put(WT_SESSION_IMPL *session,
+    uint32_t fileid, WT_ITEM * key, WT_ITEM * value)
+{
+	return (__wt_log_op(
+	    session, &__wt_logdesc_row_put, fileid, key, value));
+}
+
+static inline int
+__wt_logop_row_remove(WT_SESSION_IMPL *session,
+    uint32_t fileid, WT_ITEM * key)
+{
+	return (__wt_log_op(
+	    session, &__wt_logdesc_row_remove, fileid, key));
+}
+
+static inline int
+__wt_logop_col_put(WT_SESSION_IMPL *session,
+    uint32_t fileid, uint64_t recno, WT_ITEM * value)
+{
+	return (__wt_log_op(
+	    session, &__wt_logdesc_col_put, fileid, recno, value));
+}
+
 static inline int
-__wt_logput_debug(WT_SESSION_IMPL *session, const char * message)
+__wt_logop_col_remove(WT_SESSION_IMPL *session,
+    uint32_t fileid, uint64_t recno)
 {
-	return (__wt_log_put(session, &__wt_logdesc_debug, message));
+	return (__wt_log_op(
+	    session, &__wt_logdesc_col_remove, fileid, recno));
 }
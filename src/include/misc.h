@@ -59,6 +59,9 @@
 #define	WT_GCC_ATTRIBUTE(x)
 #endif
 
+/* Pad structures written by concurrent threads to avoid false sharing. */
+#define	WT_CACHE_LINE_ALIGNMENT	64
+
 /*
  * Attribute are only permitted on function declarations, not definitions.
  * This macro is a marker for function definitions that is rewritten by
@@ -10,6 +10,15 @@
  * serialized access to a piece of memory, normally by a different thread of
  * control.  This includes updating and evicting pages from trees.
  *
+ * Page modifications (WT_SERIAL_FUNC) do not share a lock: the functions link
+ * their changes into the page using atomic compare-and-swap operations, and
+ * take the page's own lock only when they have to update the tail of a
+ * skiplist.  Threads updating unrelated pages never contend.
+ *
+ * Eviction requests (WT_SERIAL_EVICT) hold the connection's serial spinlock
+ * while claiming a slot in the eviction server's request table, then block
+ * until the eviction server completes the request.
+ *
  * __wt_session_serialize_func --
  *	Schedule a serialization request, and block or spin until it completes.
  */
@@ -23,25 +32,23 @@ __wt_session_serialize_func(WT_SESSION_IMPL *session,
 
 	/*
 	 * Threads serializing access to data using a function:
-	 *	call the function while holding a spinlock
+	 *	call the function (holding a spinlock, for eviction requests),
 	 *	update the session sleeping state, and
 	 *	if necessary, block until an async action completes.
 	 */
 	session->wq_args = args;
 	session->wq_sleeping = (op == WT_SERIAL_EVICT);
 
-	/* Functions are serialized by holding a spinlock. */
-	__wt_spin_lock(session, &conn->serial_lock);
-
-	func(session);
-
-	__wt_spin_unlock(session, &conn->serial_lock);
-
 	switch (op) {
 	case WT_SERIAL_EVICT:
+		__wt_spin_lock(session, &conn->serial_lock);
+		func(session);
+		__wt_spin_unlock(session, &conn->serial_lock);
+
 		__wt_evict_server_wake(session);
 		break;
 	default:
+		func(session);
 		break;
 	}
 
@@ -68,20 +75,15 @@ __wt_session_serialize_wrapup(WT_SESSION_IMPL *session, WT_PAGE *page, int ret)
 		 * page.  Wake the eviction server as necessary if the page
 		 * has become too large.
 		 */
-		__wt_page_modify_set(page);
+		__wt_page_modify_set(session, page);
 		(void)__wt_eviction_page_check(session, page);
 	}
 
 	/*
 	 * Publish: there must be a barrier to ensure the return value is set
-	 * before the calling thread can see its results, and the page's new
-	 * write generation makes it to memory.  The latter isn't a correctness
-	 * issue, the write generation just needs to be updated so that readers
-	 * get credit for reading the right version of the page, otherwise,
-	 * they will have to retry their update for reading an old version of
-	 * the page.
+	 * before the calling thread can see its results.
 	 */
-       WT_PUBLISH(session->wq_ret, ret);
+	WT_PUBLISH(session->wq_ret, ret);
 
 	/* If the calling thread is sleeping, wake it up. */
 	if (session->wq_sleeping)
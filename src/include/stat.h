@@ -28,17 +28,52 @@ struct __wt_stats {
 	(stats)->fld.v = (uint64_t)(value);				\
 } while (0)
 
-#define	WT_BSTAT_INCR(session, fld)					\
-	WT_STAT_INCR((session)->btree->stats, fld)
-#define	WT_BSTAT_INCRV(session, fld, v)					\
-	WT_STAT_INCRV((session)->btree->stats, fld, v)
-#define	WT_BSTAT_DECR(session, fld)					\
-	WT_STAT_DECR((session)->btree->stats, fld)
+/*
+ * Connection and btree statistics are sharded: there are WT_STAT_SLOTS copies
+ * of the structure, each padded to a cache line, and a session updates the
+ * copy selected by its stat_slot, so threads incrementing the same counter
+ * don't contend for a cache line.  The copies are summed when the statistics
+ * are read.  Values that are set rather than incremented are stored in the
+ * first copy.
+ */
+#define	WT_STAT_SLOTS	8
+
+#define	WT_STAT_SLOT(stats, session)					\
+	(&(stats)[(session)->stat_slot])
+#define	WT_STAT_ENABLED(session)					\
+	F_ISSET(S2C(session), WT_STATISTICS)
+
+#define	WT_BSTAT_INCR(session, fld) do {				\
+	if (WT_STAT_ENABLED(session))					\
+		WT_STAT_INCR(						\
+		    WT_STAT_SLOT((session)->btree->stats, session), fld);\
+} while (0)
+#define	WT_BSTAT_INCRV(session, fld, v) do {				\
+	if (WT_STAT_ENABLED(session))					\
+		WT_STAT_INCRV(						\
+		    WT_STAT_SLOT((session)->btree->stats, session), fld, v);\
+} while (0)
+#define	WT_BSTAT_DECR(session, fld) do {				\
+	if (WT_STAT_ENABLED(session))					\
+		WT_STAT_DECR(						\
+		    WT_STAT_SLOT((session)->btree->stats, session), fld);\
+} while (0)
 #define	WT_BSTAT_SET(session, fld, v)					\
 	WT_STAT_SET((session)->btree->stats, fld, v)
 
-#define	WT_CSTAT_INCR(session, fld)					\
-	WT_STAT_INCR(S2C(session)->stats, fld)
+#define	WT_CSTAT_INCR(session, fld) do {				\
+	if (WT_STAT_ENABLED(session))					\
+		WT_STAT_INCR(WT_STAT_SLOT(S2C(session)->stats, session), fld);\
+} while (0)
+#define	WT_CSTAT_INCRV(session, fld, v) do {				\
+	if (WT_STAT_ENABLED(session))					\
+		WT_STAT_INCRV(						\
+		    WT_STAT_SLOT(S2C(session)->stats, session), fld, v);\
+} while (0)
+#define	WT_CSTAT_DECR(session, fld) do {				\
+	if (WT_STAT_ENABLED(session))					\
+		WT_STAT_DECR(WT_STAT_SLOT(S2C(session)->stats, session), fld);\
+} while (0)
 
 /*
  * DO NOT EDIT: automatically built by dist/stat.py.
@@ -65,6 +100,7 @@ struct __wt_btree_stats {
 	WT_STATS alloc;
 	WT_STATS extend;
 	WT_STATS free;
+	WT_STATS file_cache_bytes;
 	WT_STATS overflow_read;
 	WT_STATS page_read;
 	WT_STATS page_write;
@@ -92,7 +128,11 @@ struct __wt_btree_stats {
 	WT_STATS file_row_int_pages;
 	WT_STATS file_row_leaf_pages;
 	WT_STATS file_entries;
+
+	uint8_t pad[WT_CACHE_LINE_ALIGNMENT -
+	    (44 * sizeof(WT_STATS)) % WT_CACHE_LINE_ALIGNMENT];
 };
+#define	WT_BTREE_STATS_COUNT	44
 
 /*
  * Statistics entries for CONNECTION handle.
@@ -100,22 +140,95 @@ struct __wt_btree_stats {
 struct __wt_connection_stats {
 	WT_STATS block_read;
 	WT_STATS block_write;
+	WT_STATS cache_evict_app_wait;
+	WT_STATS cache_stall_ge100ms;
+	WT_STATS cache_stall_lt100ms;
+	WT_STATS cache_stall_lt10ms;
+	WT_STATS cache_stall_lt1ms;
 	WT_STATS cache_bytes_inuse;
+	WT_STATS cache_clean_fail;
+	WT_STATS cache_clean_pages;
 	WT_STATS cache_evict_slow;
 	WT_STATS cache_evict_internal;
 	WT_STATS cache_bytes_max;
+	WT_STATS cache_bytes_dirty;
 	WT_STATS cache_evict_modified;
 	WT_STATS cache_pages_inuse;
+	WT_STATS cache_evict_app;
+	WT_STATS cache_evict_readers;
+	WT_STATS cache_warm_saved;
 	WT_STATS cache_evict_hazard;
+	WT_STATS cache_warm_read;
 	WT_STATS cache_evict_unmodified;
+	WT_STATS checkpoint_bytes;
+	WT_STATS checkpoint_stall_max;
+	WT_STATS checkpoint_skipped;
+	WT_STATS checkpoint_time;
+	WT_STATS checkpoint;
 	WT_STATS cond_wait;
+	WT_STATS config_cache_hit;
+	WT_STATS config_cache_miss;
+	WT_STATS cursor_cache_miss;
+	WT_STATS cursor_cache_hit;
 	WT_STATS file_open;
+	WT_STATS log_bytes;
+	WT_STATS log_ops;
+	WT_STATS log_prealloc_missed;
+	WT_STATS log_prealloc;
+	WT_STATS log_recycled;
+	WT_STATS log_archived;
+	WT_STATS log_compressed;
+	WT_STATS log_sync_records;
+	WT_STATS log_sync_waits;
+	WT_STATS log_records;
+	WT_STATS log_syncs;
+	WT_STATS log_background_syncs;
+	WT_STATS log_sync_wait_time;
+	WT_STATS log_writes;
+	WT_STATS arena_chunk_bytes;
+	WT_STATS arena_wasted;
+	WT_STATS arena_chunk_alloc;
+	WT_STATS arena_chunk_free;
+	WT_STATS arena_alloc;
+	WT_STATS read_ahead_miss;
+	WT_STATS read_ahead_queued;
+	WT_STATS read_ahead_hit;
+	WT_STATS recovery_scanned;
+	WT_STATS recovery_applied;
+	WT_STATS recovery_rate;
+	WT_STATS recovery_time;
 	WT_STATS rwlock_rdlock;
 	WT_STATS rwlock_wrlock;
 	WT_STATS memalloc;
 	WT_STATS memfree;
 	WT_STATS total_read_io;
 	WT_STATS total_write_io;
+	WT_STATS txn_begin;
+	WT_STATS txn_commit;
+	WT_STATS txn_rollback;
+	WT_STATS txn_conflict;
+	WT_STATS txn_sync;
+	WT_STATS write_queued;
+	WT_STATS write_queue_read;
+	WT_STATS write_queue_full;
+
+	uint8_t pad[WT_CACHE_LINE_ALIGNMENT -
+	    (73 * sizeof(WT_STATS)) % WT_CACHE_LINE_ALIGNMENT];
+};
+#define	WT_CONNECTION_STATS_COUNT	73
+
+/*
+ * Statistics entries for EVICT_WORKER handle.
+ */
+struct __wt_evict_worker_stats {
+	WT_STATS evict_worker_pages;
+	WT_STATS evict_worker_fail;
+	WT_STATS evict_worker_time;
+	WT_STATS evict_worker_wakeup;
+
+	uint8_t pad[WT_CACHE_LINE_ALIGNMENT -
+	    (4 * sizeof(WT_STATS)) % WT_CACHE_LINE_ALIGNMENT];
 };
+#define	WT_EVICT_WORKER_STATS_COUNT	4
 
 /* Statistics section: END */
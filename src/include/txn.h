@@ -0,0 +1,119 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+/*
+ * Transaction IDs are allocated from a 64-bit counter in the connection: they
+ * don't wrap, and compare as integers.
+ */
+#define	WT_TXN_NONE	0		/* No transaction */
+#define	WT_TXN_ABORTED	UINT64_MAX	/* Update rolled back, ignore */
+
+/*
+ * An autocommit update that conflicts with an update still being installed
+ * waits for it, yielding up to WT_TXN_CONFLICT_YIELDS times before giving up.
+ */
+#define	WT_TXN_CONFLICT_YIELDS	100
+
+/*
+ * WT_TXN_STATE --
+ *	The transaction state each session publishes in the connection's table:
+ * the ID of the session's running transaction, and the oldest ID the session's
+ * snapshot might need to read past.
+ */
+struct __wt_txn_state {
+	volatile uint64_t id;		/* Running transaction ID */
+	volatile uint64_t snap_min;	/* Oldest ID the snapshot can't see */
+};
+
+/*
+ * WT_TXN_GLOBAL --
+ *	The connection's transaction table.
+ */
+struct __wt_txn_global {
+	volatile uint64_t current;	/* Last allocated transaction ID */
+
+	/*
+	 * There's a state slot for each session slot, plus one for the
+	 * default session.  The table is scanned without locking to build
+	 * snapshots: slots are never freed while the connection is open.
+	 */
+	WT_TXN_STATE *states;		/* Per-session transaction state */
+	uint32_t      states_cnt;
+
+	/*
+	 * Checkpoints sample the log end and the next transaction ID when
+	 * they start: transactions allocated later IDs log their commits past
+	 * that point.  A checkpoint only writes updates older than the oldest
+	 * running transaction, recovery must replay the log from the sample
+	 * preceding that transaction.
+	 */
+#define	WT_TXN_CKPT_SAMPLES	16
+	struct {
+		uint64_t id;		/* Next transaction ID */
+		WT_LSN	 lsn;		/* Log end */
+	} ckpt_sample[WT_TXN_CKPT_SAMPLES];
+	u_int ckpt_samples;
+};
+
+typedef enum {
+	TXN_ISO_READ_UNCOMMITTED,
+	TXN_ISO_READ_COMMITTED,
+	TXN_ISO_SNAPSHOT
+} WT_TXN_ISOLATION;
+
+/*
+ * How durable a commit is when WT_SESSION::commit_transaction returns: the
+ * commit record may only be in the log buffer, written to the log file, or
+ * synced to disk.  Background commits are synced by the log flush thread.
+ */
+typedef enum {
+	TXN_SYNC_NONE,
+	TXN_SYNC_WRITE,
+	TXN_SYNC_BACKGROUND,
+	TXN_SYNC_FULL
+} WT_TXN_SYNC;
+
+/*
+ * WT_TXN --
+ *	Per-session transaction context.
+ */
+struct __wt_txn {
+	uint64_t id;			/* Running transaction ID */
+
+	WT_TXN_ISOLATION isolation;	/* Isolation level */
+	WT_TXN_SYNC	 sync;		/* Commit durability */
+
+	/*
+	 * The end of the session's last commit record: the commit is durable
+	 * once the log is synced past it.
+	 */
+	WT_LSN commit_lsn;
+
+	/*
+	 * The snapshot: transactions with IDs less than snap_min committed
+	 * before the snapshot was taken and are visible, transactions with IDs
+	 * greater than or equal to snap_max started after the snapshot was
+	 * taken and are not.  IDs in between are visible unless they're in the
+	 * sorted list of transactions that were running.
+	 */
+	uint64_t snap_min;
+	uint64_t snap_max;
+	uint64_t *snapshot;		/* Running transaction IDs */
+	uint32_t snapshot_count;
+
+	WT_TXN_STATE *state;		/* Published state */
+
+	/* Updates made by the running transaction, for rollback. */
+	WT_UPDATE **mod;
+	size_t	    mod_alloc;
+	u_int	    mod_count;
+
+	/* Log records of the running transaction's operations. */
+	WT_ITEM	    logrecs;
+
+	uint32_t flags;
+};
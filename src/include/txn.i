@@ -0,0 +1,216 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+/*
+ * __txn_visible_snapshot --
+ *	Return if a transaction ID is visible in the session's snapshot.
+ */
+static inline int
+__txn_visible_snapshot(WT_TXN *txn, uint64_t id)
+{
+	uint64_t *snapshot;
+	uint32_t base, indx, limit;
+
+	/* Transactions see their own changes. */
+	if (id == txn->id)
+		return (1);
+
+	/*
+	 * Transactions that finished before the snapshot was taken are visible,
+	 * transactions that started after it was taken are not.
+	 */
+	if (id < txn->snap_min)
+		return (1);
+	if (id >= txn->snap_max)
+		return (0);
+
+	/* Otherwise, the ID is visible if it wasn't running: binary search. */
+	snapshot = txn->snapshot;
+	for (base = 0, limit = txn->snapshot_count; limit != 0; limit >>= 1) {
+		indx = base + (limit >> 1);
+		if (snapshot[indx] == id)
+			return (0);
+		if (snapshot[indx] < id) {
+			base = indx + 1;
+			--limit;
+		}
+	}
+	return (1);
+}
+
+/*
+ * __wt_txn_visible --
+ *	Return if a transaction ID is visible to the session.
+ */
+static inline int
+__wt_txn_visible(WT_SESSION_IMPL *session, uint64_t id)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	/* Nobody sees the results of aborted transactions. */
+	if (id == WT_TXN_ABORTED)
+		return (0);
+
+	/* Read-uncommitted transactions see all other changes. */
+	if (txn->isolation == TXN_ISO_READ_UNCOMMITTED)
+		return (1);
+
+	return (__txn_visible_snapshot(txn, id));
+}
+
+/*
+ * __wt_txn_read --
+ *	Return the newest update in a list that's visible to the session, or
+ * NULL if there isn't one.
+ */
+static inline WT_UPDATE *
+__wt_txn_read(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+{
+	while (upd != NULL && !__wt_txn_visible(session, upd->txnid))
+		upd = upd->next;
+	return (upd);
+}
+
+/*
+ * __wt_txn_cursor_op --
+ *	Called at the start of each cursor operation: unless the session is
+ * running a snapshot-isolation transaction, each operation sees the changes
+ * committed before it starts.
+ */
+static inline void
+__wt_txn_cursor_op(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	if (txn->isolation != TXN_ISO_SNAPSHOT)
+		__wt_txn_get_snapshot(session, txn->id);
+}
+
+/*
+ * __wt_txn_id_alloc --
+ *	Allocate a new transaction ID, publishing it in the session's state.
+ */
+static inline uint64_t
+__wt_txn_id_alloc(WT_SESSION_IMPL *session)
+{
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *state;
+	uint64_t id;
+
+	txn_global = &S2C(session)->txn_global;
+	state = session->txn.state;
+
+	/*
+	 * Publish the ID before allocating it: once the counter has moved past
+	 * an ID, any snapshot will find the ID in the table until the session
+	 * clears it.  If another thread allocates the ID first, that thread has
+	 * published it as well, and we try again with the next one.
+	 */
+	do {
+		id = txn_global->current + 1;
+		if (state != NULL)
+			state->id = id;
+	} while (!WT_ATOMIC_CAS(txn_global->current, id - 1, id));
+
+	return (id);
+}
+
+/*
+ * __wt_txn_modify --
+ *	Check an update doesn't conflict with the update it replaces, and tag
+ * it with the session's transaction ID.
+ */
+static inline int
+__wt_txn_modify(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+{
+	WT_TXN *txn;
+	WT_UPDATE *prev;
+	size_t bytes;
+	u_int i;
+
+	txn = &session->txn;
+
+	/*
+	 * Some internal updates, for example a file's root address, describe
+	 * the file rather than its contents: they're visible to everyone as
+	 * soon as they're installed, and can't be rolled back.
+	 */
+	if (F_ISSET(session, WT_SESSION_NO_TXN)) {
+		upd->txnid = WT_TXN_NONE;
+		return (0);
+	}
+
+	/*
+	 * Updating a value another transaction changed and we can't see (it's
+	 * still running or, in a snapshot, committed after the snapshot was
+	 * taken) is a write-write conflict.  Aborted updates don't count.
+	 *
+	 * Outside of an explicit transaction, there's nothing to roll back:
+	 * if the other update has committed, or is an autocommit update that
+	 * commits once it's in place, refresh the snapshot and restart the
+	 * operation.  Only an update by a transaction that stays running is
+	 * a conflict.
+	 */
+	for (prev = upd->next;
+	    prev != NULL && prev->txnid == WT_TXN_ABORTED; prev = prev->next)
+		;
+	if (prev != NULL && !__txn_visible_snapshot(txn, prev->txnid)) {
+		for (i = 0; !F_ISSET(txn, WT_TXN_RUNNING) &&
+		    i < WT_TXN_CONFLICT_YIELDS; ++i) {
+			__wt_txn_get_snapshot(session, txn->id);
+			if (__txn_visible_snapshot(txn, prev->txnid))
+				return (WT_RESTART);
+			__wt_yield();
+		}
+		WT_CSTAT_INCR(session, txn_conflict);
+		return (WT_DEADLOCK);
+	}
+
+	/*
+	 * Outside of an explicit transaction, each update commits as soon as
+	 * it's installed: it gets its own ID, published until it's in place.
+	 */
+	if (!F_ISSET(txn, WT_TXN_RUNNING)) {
+		upd->txnid = __wt_txn_id_alloc(session);
+		F_SET(txn, WT_TXN_AUTOCOMMIT);
+		return (0);
+	}
+
+	/* Remember the update in case the transaction is rolled back. */
+	if ((txn->mod_count + 1) * sizeof(WT_UPDATE *) > txn->mod_alloc) {
+		bytes = WT_MAX(txn->mod_alloc * 2, 32 * sizeof(WT_UPDATE *));
+		WT_RET(__wt_realloc(session, &txn->mod_alloc, bytes, &txn->mod));
+	}
+	txn->mod[txn->mod_count++] = upd;
+	upd->txnid = txn->id;
+	return (0);
+}
+
+/*
+ * __wt_txn_modify_end --
+ *	Resolve an update after trying to install it: an autocommit update is
+ * committed (or discarded), and a failed update is forgotten.
+ */
+static inline void
+__wt_txn_modify_end(WT_SESSION_IMPL *session, WT_UPDATE *upd, int ret)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	if (F_ISSET(txn, WT_TXN_AUTOCOMMIT)) {
+		F_CLR(txn, WT_TXN_AUTOCOMMIT);
+		if (txn->state != NULL)
+			WT_PUBLISH(txn->state->id, WT_TXN_NONE);
+	} else if (ret != 0 && upd != NULL &&
+	    txn->mod_count > 0 && txn->mod[txn->mod_count - 1] == upd)
+		--txn->mod_count;
+}
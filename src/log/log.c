@@ -7,73 +7,725 @@
 
 #include "wt_internal.h"
 
+static int __log_file_full(WT_SESSION_IMPL *, WT_LOG *, const char *, int *);
+static int __log_files(WT_SESSION_IMPL *, WT_LOG *);
+
+/*
+ * __log_filename --
+ *	Build a log file's name from its number.
+ */
+static void
+__log_filename(uint32_t fileid, char *buf, size_t len)
+{
+	(void)snprintf(buf, len, "%s.%010" PRIu32, WT_LOG_FILENAME, fileid);
+}
+
+/*
+ * __wt_log_open --
+ *	Open the log: find the log files, recovery finds the end of the log.
+ */
+int
+__wt_log_open(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_LOG *log;
+	WT_LOG_SLOT *slot;
+	WT_NAMED_COMPRESSOR *ncomp;
+	u_int i;
+	int exist, full, ret;
+
+	conn = S2C(session);
+	ret = 0;
+
+	WT_RET(__wt_calloc_def(session, 1, &log));
+	conn->log = log;
+
+	/* Records can be compressed by a compressor an extension added. */
+	WT_ERR(__wt_config_gets(session, cfg, "log_compressor", &cval));
+	if (cval.len > 0) {
+		TAILQ_FOREACH(ncomp, &conn->compqh, q)
+			if (strncmp(ncomp->name, cval.str, cval.len) == 0) {
+				log->compressor = ncomp->compressor;
+				break;
+			}
+		if (log->compressor == NULL)
+			WT_ERR_MSG(session, EINVAL,
+			    "unknown log_compressor '%.*s'",
+			    (int)cval.len, cval.str);
+	}
+
+	WT_ERR(__wt_config_gets(session, cfg, "log_file_size", &cval));
+	log->file_size = (off_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "log_flush_period", &cval));
+	log->flush_usecs = (long)cval.val * 1000;
+	WT_ERR(__wt_config_gets(session, cfg, "log_flush_bytes", &cval));
+	log->flush_bytes = (uint64_t)cval.val;
+	WT_ERR(__wt_rwlock_alloc(session, "log file", &log->fh_rwlock));
+	WT_ERR(__wt_cond_alloc(session, "log flush", 1, &log->flush_cond));
+	WT_ERR(__wt_cond_alloc(session, "log prep", 1, &log->prep_cond));
+	WT_ERR(__wt_cond_alloc(session, "log slot", 1, &log->slot_cond));
+
+	WT_ERR(__log_files(session, log));
+
+	/*
+	 * A spare log file left by the last run can be used if it was
+	 * completely pre-allocated: the process may have exited while the
+	 * spare was being filled.
+	 */
+	WT_ERR(__wt_exist(session, WT_LOG_SPARE, &exist));
+	if (exist) {
+		WT_ERR(__log_file_full(session, log, WT_LOG_SPARE, &full));
+		if (full)
+			log->spare_ready = 1;
+		else
+			WT_ERR(__wt_remove(session, WT_LOG_SPARE));
+	}
+
+	/*
+	 * Recovery reads the existing log files, then new records are written
+	 * to a new log file: until then, the end of the log is the start of
+	 * the file following the existing files.
+	 */
+	log->write_lsn = log->sync_lsn = WT_LSN_MAKE(log->last_file + 1, 0);
+
+	for (i = 0, slot = log->slot_pool; i < WT_LOG_SLOT_POOL; ++i, ++slot) {
+		WT_ERR(__wt_calloc_def(
+		    session, WT_LOG_SLOT_BUF_SIZE, &slot->buf));
+		slot->state = WT_LOG_SLOT_FREE;
+	}
+	slot = &log->slot_pool[0];
+	slot->start_lsn = log->write_lsn;
+	slot->state = 0;
+	log->slot_active = slot;
+	return (0);
+
+err:	(void)__wt_log_close(session);
+	return (ret);
+}
+
+/*
+ * __log_files --
+ *	Find the oldest and newest log files.
+ */
+static int
+__log_files(WT_SESSION_IMPL *session, WT_LOG *log)
+{
+	u_int count, i;
+	unsigned long fileid;
+	char **names, *p;
+
+	WT_RET(__wt_dirlist(session, WT_LOG_FILENAME ".", &names, &count));
+
+	log->first_file = UINT32_MAX;
+	log->last_file = 0;
+	for (i = 0; i < count; ++i) {
+		fileid = strtoul(
+		    names[i] + strlen(WT_LOG_FILENAME "."), &p, 10);
+		if (*p == '\0' && fileid != 0 && fileid < UINT32_MAX) {
+			if (fileid < log->first_file)
+				log->first_file = (uint32_t)fileid;
+			if (fileid > log->last_file)
+				log->last_file = (uint32_t)fileid;
+		}
+		__wt_free(session, names[i]);
+	}
+	__wt_free(session, names);
+
+	/* If there are no log files, the first is file 1. */
+	if (log->last_file == 0)
+		log->first_file = 1;
+	return (0);
+}
+
+/*
+ * __log_file_full --
+ *	Return if a file is at least a log file's size: only a full file can
+ * be used as the spare.
+ */
+static int
+__log_file_full(
+    WT_SESSION_IMPL *session, WT_LOG *log, const char *name, int *fullp)
+{
+	WT_FH *fh;
+	off_t size;
+	int ret;
+
+	WT_RET(__wt_open(session, name, 0, 0, 0, &fh));
+	ret = __wt_filesize(session, fh, &size);
+	WT_TRET(__wt_close(session, fh));
+	WT_RET(ret);
+
+	*fullp = size >= log->file_size;
+	return (0);
+}
+
+/*
+ * __wt_log_close --
+ *	Sync and close the log.
+ */
+int
+__wt_log_close(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LOG *log;
+	u_int i;
+	int ret;
+
+	conn = S2C(session);
+	ret = 0;
+
+	if ((log = conn->log) == NULL)
+		return (0);
+
+	/*
+	 * Every slot's leader writes the slot before returning, there can't
+	 * be any records waiting once the application's threads have exited.
+	 * The next run writes to a new log file: discard the current file's
+	 * unused space.
+	 */
+	if (log->fh != NULL) {
+		if (log->error == 0 &&
+		    WT_LSN_FILE(log->write_lsn) == log->fileid)
+			WT_TRET(__wt_ftruncate(session,
+			    log->fh, (off_t)WT_LSN_OFFSET(log->write_lsn)));
+		if (log->error == 0)
+			WT_TRET(__wt_fsync(session, log->fh));
+		WT_TRET(__wt_close(session, log->fh));
+	}
+	for (i = 0; i < WT_LOG_SLOT_POOL; ++i)
+		__wt_free(session, log->slot_pool[i].buf);
+	if (log->flush_cond != NULL)
+		WT_TRET(__wt_cond_destroy(session, log->flush_cond));
+	if (log->prep_cond != NULL)
+		WT_TRET(__wt_cond_destroy(session, log->prep_cond));
+	if (log->slot_cond != NULL)
+		WT_TRET(__wt_cond_destroy(session, log->slot_cond));
+	if (log->fh_rwlock != NULL)
+		WT_TRET(__wt_rwlock_destroy(session, log->fh_rwlock));
+	__wt_free(session, conn->log);
+	return (ret);
+}
+
+/*
+ * __log_slot_notify --
+ *	Wake the threads waiting for a slot change, once the change has been
+ * published.
+ */
+static void
+__log_slot_notify(WT_SESSION_IMPL *session, WT_LOG *log)
+{
+	/*
+	 * The atomic add is a full barrier: a thread that read the previous
+	 * generation and is going to sleep has counted itself as a waiter by
+	 * the time we check, or sees the new generation and doesn't sleep.
+	 */
+	(void)WT_ATOMIC_ADD(log->slot_gen, 1);
+	if (log->slot_waiters != 0)
+		__wt_cond_signal(session, log->slot_cond);
+}
+
+/*
+ * __log_slot_wait --
+ *	Wait for a slot change, given the generation read before the caller
+ * checked its condition.
+ */
+static void
+__log_slot_wait(
+    WT_SESSION_IMPL *session, WT_LOG *log, uint64_t gen, u_int *spinsp)
+{
+	/* Most waits are for a copy or a switch to a new slot: yield first. */
+	if (++*spinsp < WT_LOG_SLOT_SPINS) {
+		__wt_yield();
+		return;
+	}
+
+	(void)WT_ATOMIC_ADD(log->slot_waiters, 1);
+	if (log->slot_gen == gen)
+		__wt_cond_wait_timed(session, log->slot_cond, 10000);
+	(void)WT_ATOMIC_ADD(log->slot_waiters, -1);
+
+	/*
+	 * Threads wake one at a time and wait for different changes: if there
+	 * was a change, pass the wakeup on.
+	 */
+	if (log->slot_waiters != 0 && log->slot_gen != gen)
+		__wt_cond_signal(session, log->slot_cond);
+}
+
+/*
+ * __log_slot_join --
+ *	Join the active slot, returning the slot and the record's offset in the
+ * slot.
+ */
+static int
+__log_slot_join(WT_SESSION_IMPL *session,
+    WT_LOG *log, uint32_t size, WT_LOG_SLOT **slotp, int64_t *offsetp)
+{
+	WT_LOG_SLOT *slot;
+	int64_t old;
+	uint64_t gen;
+	u_int spins;
+
+	for (spins = 0;;) {
+		WT_ORDERED_READ(gen, log->slot_gen);
+		slot = log->slot_active;
+		old = slot->state;
+
+		/*
+		 * If the slot is closed or full, wait for the leader to switch
+		 * to a new slot: if an earlier write failed, it never will.  A
+		 * record larger than the slot's buffer can join an empty slot,
+		 * it's written as a group of one.
+		 */
+		if (old < 0 ||
+		    (old != 0 && old + size > WT_LOG_SLOT_BUF_SIZE)) {
+			if (log->error != 0)
+				return (log->error);
+			__log_slot_wait(session, log, gen, &spins);
+			continue;
+		}
+		if (WT_ATOMIC_CAS(slot->state, old, old + size))
+			break;
+	}
+
+	*slotp = slot;
+	*offsetp = old;
+	return (0);
+}
+
+/*
+ * __log_file_switch --
+ *	Switch to the next log file: called by the leader of the first slot
+ * written to the file.
+ */
+static int
+__log_file_switch(WT_SESSION_IMPL *session, WT_LOG *log, uint32_t fileid)
+{
+	WT_FH *fh;
+	WT_LSN lsn, old;
+	int ret;
+	char name[WT_LOG_FILENAME_MAX];
+
+	ret = 0;
+	__log_filename(fileid, name, sizeof(name));
+
+	/*
+	 * Recovery expects a log file's records to be durable before records
+	 * are written to the next file: sync the current file first.  Threads
+	 * syncing the log hold the lock while they use the handle.
+	 */
+	__wt_writelock(session, log->fh_rwlock);
+	if (log->fh != NULL) {
+		lsn = log->write_lsn;
+		WT_ERR(__wt_fsync(session, log->fh));
+		WT_CSTAT_INCR(session, log_syncs);
+		while ((old = log->sync_lsn) < lsn &&
+		    !WT_ATOMIC_CAS(log->sync_lsn, old, lsn))
+			;
+		WT_ERR(__wt_close(session, log->fh));
+		log->fh = NULL;
+	}
+
+	/*
+	 * Writes to the spare file overwrite allocated blocks: use it if the
+	 * log prep thread has it ready, otherwise create the file.
+	 */
+	if (log->spare_ready) {
+		WT_ERR(__wt_rename(session, WT_LOG_SPARE, name));
+		WT_PUBLISH(log->spare_ready, 0);
+		WT_ERR(__wt_open(session, name, 0, 0, 0, &fh));
+	} else {
+		WT_CSTAT_INCR(session, log_prealloc_missed);
+		WT_ERR(__wt_open(session, name, 1, 1, 0, &fh));
+	}
+	log->fh = fh;
+	log->fileid = fileid;
+	__wt_cond_signal(session, log->prep_cond);
+
+err:	__wt_rwunlock(session, log->fh_rwlock);
+	return (ret);
+}
+
+/*
+ * __log_slot_write --
+ *	Write a slot on behalf of the threads that joined it: called by the
+ * slot's leader.
+ */
+static int
+__log_slot_write(WT_SESSION_IMPL *session,
+    WT_LOG *log, WT_LOG_SLOT *slot, WT_LOG_RECORD *logrec)
+{
+	WT_LOG_SLOT *next;
+	WT_LSN end;
+	int64_t size;
+	uint64_t gen;
+	u_int i, spins;
+	int ret, sync;
+	void *buf;
+
+	/* Slots are written in LSN order: wait for the earlier slots. */
+	for (spins = 0;;) {
+		WT_ORDERED_READ(gen, log->slot_gen);
+		if (log->write_lsn == slot->start_lsn)
+			break;
+		if (log->error != 0)
+			return (log->error);
+		__log_slot_wait(session, log, gen, &spins);
+	}
+
+	/*
+	 * Close the slot: every thread that joined while the earlier slots were
+	 * being written is part of this group.  Threads arriving from now on
+	 * join the next slot, which is written after this one.
+	 */
+	do {
+		size = slot->state;
+	} while (!WT_ATOMIC_CAS(slot->state, size, WT_LOG_SLOT_CLOSED));
+
+	/*
+	 * Activate a new slot.  Only the leader of the slot being written can
+	 * get here, and the earlier slots are free by the time it does.
+	 */
+	for (next = NULL, i = 0; i < WT_LOG_SLOT_POOL; ++i)
+		if (log->slot_pool[i].state == WT_LOG_SLOT_FREE) {
+			next = &log->slot_pool[i];
+			break;
+		}
+	WT_ASSERT(session, next != NULL);
+	next->start_lsn = slot->start_lsn + (WT_LSN)size;
+
+	/*
+	 * A slot is written to a single log file: if the next slot might not
+	 * fit in this slot's file, it starts the next file.
+	 */
+	if ((off_t)WT_LSN_OFFSET(next->start_lsn) +
+	    WT_LOG_SLOT_BUF_SIZE > log->file_size)
+		next->start_lsn =
+		    WT_LSN_MAKE(WT_LSN_FILE(slot->start_lsn) + 1, 0);
+	end = next->start_lsn;
+	next->released = 0;
+	next->records = 0;
+	next->sync = 0;
+	WT_PUBLISH(next->state, 0);
+	WT_PUBLISH(log->slot_active, next);
+	__log_slot_notify(session, log);
+
+	/*
+	 * Wait for the group to finish copying records into the slot: a thread
+	 * releasing its record into a closed slot notifies us.
+	 */
+	for (spins = 0;;) {
+		WT_ORDERED_READ(gen, log->slot_gen);
+		if (slot->released == size)
+			break;
+		__log_slot_wait(session, log, gen, &spins);
+	}
+
+	if (WT_LSN_FILE(slot->start_lsn) != log->fileid)
+		WT_ERR(__log_file_switch(
+		    session, log, WT_LSN_FILE(slot->start_lsn)));
+
+	/* A record too large for the slot's buffer is written in place. */
+	buf = size > WT_LOG_SLOT_BUF_SIZE ? (void *)logrec : (void *)slot->buf;
+	WT_ERR(__wt_write(session, log->fh,
+	    (off_t)WT_LSN_OFFSET(slot->start_lsn), (uint32_t)size, buf));
+	WT_CSTAT_INCR(session, log_writes);
+	WT_CSTAT_INCRV(session, log_bytes, size);
+	if ((sync = slot->sync) != 0) {
+		WT_ERR(__wt_fsync(session, log->fh));
+		WT_CSTAT_INCR(session, log_syncs);
+		WT_CSTAT_INCRV(session, log_sync_records, slot->records);
+	}
+
+	/*
+	 * Free the slot before publishing the write, the next leader expects
+	 * to find a free slot.  The end of the written records is the start
+	 * of the next slot, which may be in the next log file.
+	 */
+	WT_PUBLISH(slot->state, WT_LOG_SLOT_FREE);
+	if (sync)
+		WT_PUBLISH(log->sync_lsn, end);
+	WT_PUBLISH(log->write_lsn, end);
+	__log_slot_notify(session, log);
+	return (0);
+
+	/*
+	 * Threads waiting for this or later slots, and threads waiting to join
+	 * a slot, give up once they see the error.
+	 */
+err:	log->error = ret;
+	__log_slot_notify(session, log);
+	return (ret);
+}
+
+/*
+ * __log_wait_write --
+ *	Wait for the leaders of the groups up to an LSN to write their slots.
+ */
 static int
-__log_record_size(WT_SESSION_IMPL *session,
-    WT_LOGREC_DESC *recdesc, va_list ap, size_t *sizep)
+__log_wait_write(WT_SESSION_IMPL *session, WT_LOG *log, WT_LSN lsn)
 {
-	WT_UNUSED(session);
+	uint64_t gen;
+	u_int spins;
 
-	*sizep = wiredtiger_struct_size(recdesc->fmt, ap);
+	for (spins = 0;;) {
+		WT_ORDERED_READ(gen, log->slot_gen);
+		if (log->write_lsn >= lsn)
+			break;
+		if (log->error != 0)
+			return (log->error);
+		__log_slot_wait(session, log, gen, &spins);
+	}
 	return (0);
 }
 
+/*
+ * __log_compress --
+ *	Compress a record's packed record in place, if that makes it smaller.
+ */
+static int
+__log_compress(WT_SESSION_IMPL *session, WT_LOG *log, WT_ITEM *record)
+{
+	WT_COMPRESSOR *compressor;
+	WT_ITEM *tmp;
+	WT_LOG_RECORD *logrec;
+	size_t len, result_len;
+	uint32_t size;
+	int compression_failed, ret;
+	uint8_t *p;
+
+	compressor = log->compressor;
+	logrec = record->mem;
+	p = WT_LOG_RECORD_DATA(logrec);
+	size = record->size - (uint32_t)sizeof(WT_LOG_RECORD);
+	tmp = NULL;
+	ret = 0;
+
+	/*
+	 * A compressed version bigger than the original isn't used, but some
+	 * compression engines need more memory than the original anyway.
+	 */
+	if (compressor->pre_size == NULL)
+		len = size;
+	else
+		WT_RET(compressor->pre_size(
+		    compressor, &session->iface, p, size, &len));
+	WT_RET(__wt_scr_alloc(session, (uint32_t)len, &tmp));
+
+	compression_failed = 0;
+	WT_ERR(compressor->compress(compressor, &session->iface,
+	    p, size, tmp->mem, len, &result_len, &compression_failed));
+	if (compression_failed || result_len + sizeof(uint32_t) >= size)
+		goto err;
+
+	memcpy(p, &size, sizeof(uint32_t));
+	memcpy(p + sizeof(uint32_t), tmp->mem, result_len);
+	record->size = (uint32_t)
+	    (sizeof(WT_LOG_RECORD) + sizeof(uint32_t) + result_len);
+	F_SET(logrec, WT_LOG_RECORD_COMPRESSED);
+	WT_CSTAT_INCR(session, log_compressed);
+
+err:	__wt_scr_free(&tmp);
+	return (ret);
+}
+
+/*
+ * __wt_log_write --
+ *	Write a record into the log, optionally waiting for it to be written
+ * or synced.
+ * The WT_ITEM's memory starts with space for a WT_LOG_RECORD header.  If the
+ * record is compressed, the WT_ITEM is updated to the written record.
+ */
 int
-__wt_log_put(WT_SESSION_IMPL *session, WT_LOGREC_DESC *recdesc, ...)
+__wt_log_write(WT_SESSION_IMPL *session,
+    WT_ITEM *record, WT_LSN *lsnp, uint32_t flags)
+{
+	WT_LOG *log;
+	WT_LOG_RECORD *logrec;
+	WT_LOG_SLOT *slot;
+	WT_LSN end, lsn;
+	time_t start_secs, stop_secs;
+	long start_nsecs, stop_nsecs;
+	int64_t offset;
+	uint64_t gen;
+	uint32_t size;
+	u_int spins;
+
+	log = S2C(session)->log;
+	start_secs = 0;
+	start_nsecs = 0;
+	if (log->error != 0)
+		return (log->error);
+
+	if (log->compressor != NULL && record->size >=
+	    sizeof(WT_LOG_RECORD) + WT_LOG_COMPRESS_MIN)
+		WT_RET(__log_compress(session, log, record));
+
+	logrec = record->mem;
+	size = record->size;
+	logrec->len = size;
+
+	if (LF_ISSET(WT_LOG_FSYNC))
+		WT_RET(__wt_epoch(session, &start_secs, &start_nsecs));
+
+	/*
+	 * Copy the record into the slot, then release it: the slot's leader
+	 * writes the slot once every record has been released.  The record
+	 * includes its log file's number, records left in a recycled log file
+	 * aren't valid in the file's new life.
+	 */
+	WT_RET(__log_slot_join(session, log, size, &slot, &offset));
+	lsn = slot->start_lsn + (WT_LSN)offset;
+	end = lsn + size;
+	logrec->lsn_file = WT_LSN_FILE(lsn);
+	logrec->checksum = 0;
+	logrec->checksum = __wt_cksum(logrec, size);
+	if (size <= WT_LOG_SLOT_BUF_SIZE)
+		memcpy(slot->buf + offset, logrec, size);
+	if (LF_ISSET(WT_LOG_FSYNC))
+		slot->sync = 1;
+	(void)WT_ATOMIC_ADD(slot->records, 1);
+	(void)WT_ATOMIC_ADD(slot->released, size);
+	WT_CSTAT_INCR(session, log_records);
+
+	/* If the leader has closed the slot, it may be waiting for us. */
+	if (offset != 0 && slot->state == WT_LOG_SLOT_CLOSED)
+		__log_slot_notify(session, log);
+
+	if (offset == 0)
+		WT_RET(__log_slot_write(session, log, slot, logrec));
+
+	/* Wait for the group's leader to sync the record. */
+	if (LF_ISSET(WT_LOG_FSYNC)) {
+		for (spins = 0;;) {
+			WT_ORDERED_READ(gen, log->slot_gen);
+			if (log->sync_lsn >= end)
+				break;
+			if (log->error != 0)
+				return (log->error);
+			__log_slot_wait(session, log, gen, &spins);
+		}
+		WT_RET(__wt_epoch(session, &stop_secs, &stop_nsecs));
+		WT_CSTAT_INCR(session, log_sync_waits);
+		WT_CSTAT_INCRV(session, log_sync_wait_time,
+		    (uint64_t)((stop_secs - start_secs) * WT_MILLION +
+		    (stop_nsecs - start_nsecs) / 1000));
+	} else if (LF_ISSET(WT_LOG_FLUSH))
+		WT_RET(__log_wait_write(session, log, end));
+
+	if (lsnp != NULL)
+		*lsnp = lsn;
+	return (0);
+}
+
+/*
+ * __log_pack --
+ *	Pack a record, appending it to a buffer.
+ */
+static int
+__log_pack(WT_SESSION_IMPL *session,
+    WT_ITEM *buf, WT_LOGREC_DESC *recdesc, va_list ap)
+{
+	WT_LOG_RECORD *logrec;
+	va_list ap_copy;
+	size_t size;
+
+	va_copy(ap_copy, ap);
+	size = __wt_struct_sizev(session, recdesc->fmt, ap_copy);
+	va_end(ap_copy);
+
+	WT_RET(__wt_buf_grow(
+	    session, buf, buf->size + sizeof(WT_LOG_RECORD) + size));
+	logrec = (WT_LOG_RECORD *)((uint8_t *)buf->mem + buf->size);
+	memset(logrec, 0, sizeof(WT_LOG_RECORD));
+	logrec->len = (uint32_t)(sizeof(WT_LOG_RECORD) + size);
+	logrec->rectype = (uint16_t)recdesc->type;
+
+	WT_RET(__wt_struct_packv(session,
+	    WT_LOG_RECORD_DATA(logrec), size, recdesc->fmt, ap));
+	buf->size += logrec->len;
+	return (0);
+}
+
+/*
+ * __wt_log_put --
+ *	Pack a record and write it into the log.
+ */
+int
+__wt_log_put(WT_SESSION_IMPL *session,
+    WT_LSN *lsnp, uint32_t flags, WT_LOGREC_DESC *recdesc, ...)
 {
 	WT_ITEM *buf;
 	va_list ap;
-	size_t size;
 	int ret;
 
 	buf = &session->logrec_buf;
+	buf->size = 0;
 
 	va_start(ap, recdesc);
-	WT_ERR(__log_record_size(session, recdesc, ap, &size));
+	ret = __log_pack(session, buf, recdesc, ap);
 	va_end(ap);
+	WT_RET(ret);
 
-	WT_RET(__wt_buf_initsize(session, buf, size));
+	return (__wt_log_write(session, buf, lsnp, flags));
+}
+
+/*
+ * __wt_log_op --
+ *	Log an operation changing a file.  A running transaction's operations
+ * are collected and written in its commit record, recovery only replays the
+ * operations of committed transactions.  Other operations commit as they're
+ * made, and are written immediately: their durability is the log's, they
+ * don't wait for the record to be written.
+ */
+int
+__wt_log_op(WT_SESSION_IMPL *session, WT_LOGREC_DESC *recdesc, ...)
+{
+	WT_ITEM *buf;
+	WT_TXN *txn;
+	va_list ap;
+	int ret;
+
+	txn = &session->txn;
+	if (F_ISSET(txn, WT_TXN_RUNNING))
+		buf = &txn->logrecs;
+	else {
+		buf = &session->logrec_buf;
+		buf->size = 0;
+	}
 
 	va_start(ap, recdesc);
-	WT_ERR(__wt_struct_packv(session, buf->mem, size, recdesc->fmt, ap));
-err:	va_end(ap);
+	ret = __log_pack(session, buf, recdesc, ap);
+	va_end(ap);
+	WT_RET(ret);
 
-	return (ret);
+	WT_CSTAT_INCR(session, log_ops);
+	return (F_ISSET(txn, WT_TXN_RUNNING) ?
+	    0 : __wt_log_write(session, buf, NULL, 0));
 }
 
 int
 __wt_log_vprintf(WT_SESSION_IMPL *session, const char *fmt, va_list ap)
 {
-	WT_CONNECTION_IMPL *conn;
 	WT_ITEM *buf;
 	va_list ap_copy;
 	size_t len;
 
-	conn = S2C(session);
-
-	if (conn->log_fh == NULL)
+	if (S2C(session)->log == NULL)
 		return (0);
 
 	buf = &session->logprint_buf;
 
 	va_copy(ap_copy, ap);
-	len = (size_t)vsnprintf(NULL, 0, fmt, ap_copy) + 2;
+	len = (size_t)vsnprintf(NULL, 0, fmt, ap_copy) + 1;
 	va_end(ap_copy);
 
 	WT_RET(__wt_buf_initsize(session, buf, len));
 
 	(void)vsnprintf(buf->mem, len, fmt, ap);
 
-	/*
-	 * For now, just dump the text into the file.  Later, we will use
-	 * __wt_logput_debug to wrap this in a log header.
-	 */
-#if 1
-	strcpy((char *)buf->mem + len - 2, "\n");
-	return ((write(conn->log_fh->fd, buf->mem, len - 1) ==
-	    (ssize_t)len - 1) ? 0 : WT_ERROR);
-#else
-	return (__wt_logput_debug(session, (char *)buf->mem));
-#endif
+	return (__wt_logput_debug(session, NULL, 0, (char *)buf->mem));
 }
 
 int
@@ -89,3 +741,520 @@ __wt_log_printf(WT_SESSION_IMPL *session, const char *fmt, ...)
 
 	return (ret);
 }
+
+/*
+ * __wt_log_sync --
+ *	Flush the written records to disk.
+ */
+int
+__wt_log_sync(WT_SESSION_IMPL *session)
+{
+	WT_LOG *log;
+	WT_LSN lsn, old;
+	int ret;
+
+	if ((log = S2C(session)->log) == NULL)
+		return (0);
+	if (log->error != 0)
+		return (log->error);
+	ret = 0;
+
+	/*
+	 * Records written after we read the LSN may or may not be synced, the
+	 * next record requiring a sync will take care of them.  The lock stops
+	 * a slot's leader switching log files while we use the handle: if the
+	 * LSN is in an earlier file, the switch synced it.
+	 */
+	__wt_readlock(session, log->fh_rwlock);
+	lsn = log->write_lsn;
+	if (log->sync_lsn < lsn && log->fh != NULL &&
+	    (ret = __wt_fsync(session, log->fh)) == 0) {
+		WT_CSTAT_INCR(session, log_syncs);
+
+		/* A slot's leader may have synced a later LSN meanwhile. */
+		while ((old = log->sync_lsn) < lsn &&
+		    !WT_ATOMIC_CAS(log->sync_lsn, old, lsn))
+			;
+		__log_slot_notify(session, log);
+	}
+	__wt_rwunlock(session, log->fh_rwlock);
+	return (ret);
+}
+
+/*
+ * __wt_log_bytes --
+ *	Return the number of bytes of log records between two LSNs, treating
+ * every log file as full.
+ */
+uint64_t
+__wt_log_bytes(WT_SESSION_IMPL *session, WT_LSN from, WT_LSN to)
+{
+	WT_LOG *log;
+	int64_t bytes;
+
+	log = S2C(session)->log;
+
+	if (to <= from)
+		return (0);
+	bytes = (int64_t)(WT_LSN_FILE(to) - WT_LSN_FILE(from)) *
+	    (int64_t)log->file_size +
+	    (int64_t)WT_LSN_OFFSET(to) - (int64_t)WT_LSN_OFFSET(from);
+	return (bytes < 0 ? 0 : (uint64_t)bytes);
+}
+
+/*
+ * __wt_log_wait --
+ *	Wait for the records up to an LSN to be synced, syncing the log if no
+ * other thread has.
+ */
+int
+__wt_log_wait(WT_SESSION_IMPL *session, WT_LSN lsn)
+{
+	WT_LOG *log;
+
+	if ((log = S2C(session)->log) == NULL || log->sync_lsn >= lsn)
+		return (0);
+
+	WT_RET(__log_wait_write(session, log, lsn));
+	return (log->sync_lsn >= lsn ? 0 : __wt_log_sync(session));
+}
+
+/*
+ * __wt_log_background --
+ *	Ask the log flush thread to sync the records up to an LSN.
+ */
+void
+__wt_log_background(WT_SESSION_IMPL *session, WT_LSN lsn)
+{
+	WT_LOG *log;
+	WT_LSN old;
+
+	log = S2C(session)->log;
+
+	while ((old = log->flush_lsn) < lsn &&
+	    !WT_ATOMIC_CAS(log->flush_lsn, old, lsn))
+		;
+
+	/* Don't wait for the period if enough records are waiting. */
+	if (__wt_log_bytes(session, log->sync_lsn, lsn) >= log->flush_bytes)
+		__wt_cond_signal(session, log->flush_cond);
+}
+
+/*
+ * __wt_log_flush_server --
+ *	Thread to sync the records of background commits.
+ */
+void *
+__wt_log_flush_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LOG *log;
+	WT_SESSION_IMPL *session;
+	int ret;
+
+	conn = arg;
+	log = conn->log;
+	ret = 0;
+
+	/*
+	 * We need a session handle because we're syncing the log.  Start with
+	 * the default session to keep error handling simple.
+	 */
+	session = &conn->default_session;
+	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &session));
+
+	while (F_ISSET(conn, WT_SERVER_RUN)) {
+		__wt_cond_wait_timed(
+		    session, log->flush_cond, log->flush_usecs);
+
+		/*
+		 * Background commit records may not all have been written yet:
+		 * sync what has been, the rest is synced next time.
+		 */
+		if (log->flush_lsn <= log->sync_lsn)
+			continue;
+		WT_ERR(__wt_log_sync(session));
+		WT_CSTAT_INCR(session, log_background_syncs);
+	}
+
+	if (0) {
+err:		__wt_err(session, ret, "log flush server error");
+	}
+	if (session != &conn->default_session)
+		(void)session->iface.close(&session->iface, NULL);
+	return (NULL);
+}
+
+/*
+ * __log_scan_read --
+ *	Fill the scan buffer from a file offset.
+ */
+static int
+__log_scan_read(WT_SESSION_IMPL *session,
+    WT_FH *fh, WT_ITEM *buf, off_t off, off_t size, uint32_t len)
+{
+	/* Read at least the requested length, if the file holds it. */
+	if (len > buf->memsize)
+		WT_RET(__wt_buf_init(session, buf, len));
+	len = (uint32_t)buf->memsize;
+	if ((off_t)len > size - off)
+		len = (uint32_t)(size - off);
+	WT_RET(__wt_read(session, fh, off, len, buf->mem));
+	buf->size = len;
+	return (0);
+}
+
+/*
+ * __log_decompress --
+ *	Decompress a record into a buffer.
+ */
+static int
+__log_decompress(WT_SESSION_IMPL *session,
+    WT_LOG_RECORD *logrec, WT_ITEM *out, WT_LOG_RECORD **logrecp)
+{
+	WT_COMPRESSOR *compressor;
+	WT_LOG_RECORD *newrec;
+	size_t result_len;
+	uint32_t size;
+	uint8_t *p;
+
+	if ((compressor = S2C(session)->log->compressor) == NULL)
+		WT_RET_MSG(session, EINVAL,
+		    "compressed log records require a log_compressor");
+
+	p = WT_LOG_RECORD_DATA(logrec);
+	memcpy(&size, p, sizeof(uint32_t));
+	WT_RET(__wt_buf_initsize(session, out, sizeof(WT_LOG_RECORD) + size));
+	newrec = out->mem;
+	memcpy(newrec, logrec, sizeof(WT_LOG_RECORD));
+	WT_RET(compressor->decompress(compressor, &session->iface,
+	    p + sizeof(uint32_t),
+	    logrec->len - sizeof(WT_LOG_RECORD) - sizeof(uint32_t),
+	    WT_LOG_RECORD_DATA(newrec), size, &result_len));
+	if (result_len != size)
+		WT_RET_MSG(session, WT_ERROR,
+		    "log record decompressed to %" PRIu64 " bytes, expected %"
+		    PRIu32, (uint64_t)result_len, size);
+
+	newrec->len = out->size;
+	F_CLR(newrec, WT_LOG_RECORD_COMPRESSED);
+	*logrecp = newrec;
+	return (0);
+}
+
+/*
+ * __log_scan_file --
+ *	Read a log file's records from an offset, calling a function for each
+ * one, and return the number of records read and the offset following them.
+ */
+static int
+__log_scan_file(WT_SESSION_IMPL *session, uint32_t fileid, off_t off,
+    int (*func)(WT_SESSION_IMPL *, WT_LSN, WT_LOG_RECORD *, void *),
+    void *cookie, WT_ITEM *buf, WT_ITEM *dbuf, uint64_t *nrecsp, off_t *endp)
+{
+	WT_FH *fh;
+	WT_LOG_RECORD *logrec, *rec;
+	off_t bufoff, size;
+	uint32_t checksum, len, recoff;
+	int exist, ret;
+	char name[WT_LOG_FILENAME_MAX];
+
+	fh = NULL;
+	ret = 0;
+	*nrecsp = 0;
+	*endp = off;
+
+	__log_filename(fileid, name, sizeof(name));
+	WT_RET(__wt_exist(session, name, &exist));
+	if (!exist)
+		return (0);
+	WT_RET(__wt_open(session, name, 0, 0, 0, &fh));
+	WT_ERR(__wt_filesize(session, fh, &size));
+
+	/* Records are read from a large buffer, refilled as it's consumed. */
+	bufoff = off;
+	buf->size = 0;
+	for (;;) {
+		recoff = (uint32_t)(off - bufoff);
+		if (recoff + sizeof(WT_LOG_RECORD) > buf->size) {
+			if (off + (off_t)sizeof(WT_LOG_RECORD) > size)
+				break;
+			WT_ERR(__log_scan_read(session,
+			    fh, buf, off, size, sizeof(WT_LOG_RECORD)));
+			bufoff = off;
+			recoff = 0;
+		}
+		logrec = (WT_LOG_RECORD *)((uint8_t *)buf->mem + recoff);
+		len = logrec->len;
+		if (len < sizeof(WT_LOG_RECORD) || off + (off_t)len > size)
+			break;
+		if (recoff + len > buf->size) {
+			WT_ERR(__log_scan_read(
+			    session, fh, buf, off, size, len));
+			bufoff = off;
+			logrec = buf->mem;
+		}
+
+		/*
+		 * The checksum was calculated with the field set to zero.  A
+		 * record from a recycled file's earlier life has the wrong file
+		 * number.
+		 */
+		checksum = logrec->checksum;
+		logrec->checksum = 0;
+		if (__wt_cksum(logrec, len) != checksum ||
+		    logrec->lsn_file != fileid)
+			break;
+		logrec->checksum = checksum;
+
+		/* Functions are called with the uncompressed record. */
+		if (func != NULL) {
+			rec = logrec;
+			if (F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED))
+				WT_ERR(__log_decompress(
+				    session, logrec, dbuf, &rec));
+			WT_ERR(func(
+			    session, WT_LSN_MAKE(fileid, off), rec, cookie));
+		}
+		++*nrecsp;
+		off += len;
+		*endp = off;
+	}
+
+err:	WT_TRET(__wt_close(session, fh));
+	return (ret);
+}
+
+/*
+ * __wt_log_scan --
+ *	Read the log's records from an LSN, calling a function for each one.
+ * The scan stops at the first record that can't be read, which is either
+ * the end of the log or a record a crash left partially written, and
+ * returns the LSN following the last record read.
+ */
+int
+__wt_log_scan(WT_SESSION_IMPL *session, WT_LSN start,
+    int (*func)(WT_SESSION_IMPL *, WT_LSN, WT_LOG_RECORD *, void *),
+    void *cookie, WT_LSN *endp)
+{
+	WT_ITEM *buf, *dbuf;
+	WT_LOG *log;
+	WT_LSN end;
+	off_t off;
+	uint64_t nrecs;
+	uint32_t fileid;
+	int ret;
+
+	log = S2C(session)->log;
+	buf = dbuf = NULL;
+	ret = 0;
+
+	WT_RET(__wt_scr_alloc(session, WT_LOG_SCAN_BUF_SIZE, &buf));
+	WT_ERR(__wt_scr_alloc(session, 0, &dbuf));
+
+	/* Records in log files that have been archived aren't needed. */
+	if (WT_LSN_FILE(start) < log->first_file)
+		start = WT_LSN_MAKE(log->first_file, 0);
+
+	/*
+	 * A log file is synced before records are written to the next file: if
+	 * a file has no records, the previous file's records were the last
+	 * written.  The file the scan starts in may not have records following
+	 * the start, and a file's records may end before a record a crash left
+	 * partially written, recovery continues in the next file.
+	 */
+	end = start;
+	for (fileid = WT_LSN_FILE(start), off = (off_t)WT_LSN_OFFSET(start);
+	    fileid <= log->last_file; ++fileid, off = 0) {
+		WT_ERR(__log_scan_file(session,
+		    fileid, off, func, cookie, buf, dbuf, &nrecs, &off));
+		if (nrecs == 0 && fileid != WT_LSN_FILE(start))
+			break;
+		end = WT_LSN_MAKE(fileid, off);
+	}
+	*endp = end;
+
+err:	__wt_scr_free(&buf);
+	__wt_scr_free(&dbuf);
+	return (ret);
+}
+
+/*
+ * __wt_log_truncate --
+ *	Discard the log following an LSN, before any records are written:
+ * new records are written to the next log file.
+ */
+int
+__wt_log_truncate(WT_SESSION_IMPL *session, WT_LSN lsn)
+{
+	WT_LOG *log;
+	uint32_t fileid, next;
+	int exist;
+	char name[WT_LOG_FILENAME_MAX];
+
+	log = S2C(session)->log;
+
+	/*
+	 * Records following the LSN weren't durable when the log was last
+	 * used: remove any later files, and don't append to the LSN's file,
+	 * a crash may have left records following the partially written one.
+	 */
+	next = WT_LSN_FILE(lsn);
+	if (next <= log->last_file) {
+		for (fileid = log->last_file; fileid > next; --fileid) {
+			__log_filename(fileid, name, sizeof(name));
+			WT_RET(__wt_exist(session, name, &exist));
+			if (!exist)
+				continue;
+			WT_VERBOSE(session, recovery,
+			    "removing log file %s following the last record",
+			    name);
+			WT_RET(__wt_remove(session, name));
+		}
+		++next;
+	}
+	log->last_file = next - 1;
+	log->write_lsn = log->sync_lsn = WT_LSN_MAKE(next, 0);
+	log->slot_active->start_lsn = log->write_lsn;
+	return (0);
+}
+
+/*
+ * __wt_log_archive --
+ *	Let the log prep thread recycle or remove the log files preceding an
+ * LSN's file.
+ */
+void
+__wt_log_archive(WT_SESSION_IMPL *session, WT_LSN lsn)
+{
+	WT_LOG *log;
+
+	if ((log = S2C(session)->log) == NULL ||
+	    WT_LSN_FILE(lsn) <= log->archive_file)
+		return;
+
+	log->archive_file = WT_LSN_FILE(lsn);
+	__wt_cond_signal(session, log->prep_cond);
+}
+
+/*
+ * __log_archive --
+ *	Recycle or remove the log files no longer needed: a file is recycled
+ * as the spare if there isn't one, its blocks are already allocated.  The
+ * last file written by a run is truncated when the log is closed, and the
+ * log file size may have been changed: only a full file is recycled.
+ */
+static int
+__log_archive(WT_SESSION_IMPL *session, WT_LOG *log)
+{
+	uint32_t archive;
+	int exist, full;
+	char name[WT_LOG_FILENAME_MAX];
+
+	/* Never archive the file being written. */
+	__wt_readlock(session, log->fh_rwlock);
+	archive = WT_MIN(log->archive_file, log->fileid);
+	__wt_rwunlock(session, log->fh_rwlock);
+
+	for (; log->first_file < archive; ++log->first_file) {
+		__log_filename(log->first_file, name, sizeof(name));
+		WT_RET(__wt_exist(session, name, &exist));
+		if (!exist)
+			continue;
+		full = 0;
+		if (!log->spare_ready)
+			WT_RET(__log_file_full(session, log, name, &full));
+		if (!full) {
+			WT_RET(__wt_remove(session, name));
+			WT_CSTAT_INCR(session, log_archived);
+		} else {
+			WT_RET(__wt_rename(session, name, WT_LOG_SPARE));
+			WT_PUBLISH(log->spare_ready, 1);
+			WT_CSTAT_INCR(session, log_recycled);
+		}
+	}
+	return (0);
+}
+
+/*
+ * __log_prealloc --
+ *	Create the spare log file, zero-filled so writes to the file overwrite
+ * allocated blocks and syncs don't update the file's metadata.
+ */
+static int
+__log_prealloc(WT_SESSION_IMPL *session, WT_LOG *log)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_FH *fh;
+	off_t off;
+	uint32_t len;
+	int ret;
+	void *zero;
+
+	conn = S2C(session);
+	fh = NULL;
+	off = 0;
+	ret = 0;
+
+	WT_RET(__wt_calloc(session, 1, WT_LOG_PREP_BUF_SIZE, &zero));
+	WT_ERR(__wt_open(session, WT_LOG_SPARE, 1, 1, 0, &fh));
+
+	/* Give up if the connection is closing, the file is removed. */
+	for (off = 0; off < log->file_size; off += len) {
+		if (!F_ISSET(conn, WT_SERVER_RUN))
+			break;
+		len = (uint32_t)WT_MIN(
+		    WT_LOG_PREP_BUF_SIZE, log->file_size - off);
+		WT_ERR(__wt_write(session, fh, off, len, zero));
+	}
+	if (off >= log->file_size)
+		WT_ERR(__wt_fsync(session, fh));
+
+err:	if (fh != NULL)
+		WT_TRET(__wt_close(session, fh));
+	if (ret == 0 && off >= log->file_size) {
+		WT_PUBLISH(log->spare_ready, 1);
+		WT_CSTAT_INCR(session, log_prealloc);
+	} else if (fh != NULL)
+		WT_TRET(__wt_remove(session, WT_LOG_SPARE));
+	__wt_free(session, zero);
+	return (ret);
+}
+
+/*
+ * __wt_log_prep_server --
+ *	Thread to archive log files and prepare the spare log file.
+ */
+void *
+__wt_log_prep_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LOG *log;
+	WT_SESSION_IMPL *session;
+	int ret;
+
+	conn = arg;
+	log = conn->log;
+	ret = 0;
+
+	/*
+	 * We need a session handle because we're writing files.  Start with
+	 * the default session to keep error handling simple.
+	 */
+	session = &conn->default_session;
+	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &session));
+
+	while (F_ISSET(conn, WT_SERVER_RUN)) {
+		WT_ERR(__log_archive(session, log));
+		if (!log->spare_ready)
+			WT_ERR(__log_prealloc(session, log));
+		__wt_cond_wait(session, log->prep_cond);
+	}
+
+	if (0) {
+err:		__wt_err(session, ret, "log prep server error");
+	}
+	if (session != &conn->default_session)
+		(void)session->iface.close(&session->iface, NULL);
+	return (NULL);
+}
@@ -5,5 +5,52 @@
 WT_LOGREC_DESC
 __wt_logdesc_debug =
 {
-	"S", { "message", NULL }
+	1, "debug", "S", NULL,
+	{ "message", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_commit =
+{
+	2, "commit", "Qu", NULL,
+	{ "txnid", "ops", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_row_put =
+{
+	3, "row_put", "Iuu", __wt_logapply_row_put,
+	{ "fileid", "key", "value", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_row_remove =
+{
+	4, "row_remove", "Iu", __wt_logapply_row_remove,
+	{ "fileid", "key", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_col_put =
+{
+	5, "col_put", "IQu", __wt_logapply_col_put,
+	{ "fileid", "recno", "value", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_col_remove =
+{
+	6, "col_remove", "IQ", __wt_logapply_col_remove,
+	{ "fileid", "recno", NULL }
+};
+
+WT_LOGREC_DESC *
+__wt_logdesc_table[] = {
+	NULL,
+	&__wt_logdesc_debug,
+	&__wt_logdesc_commit,
+	&__wt_logdesc_row_put,
+	&__wt_logdesc_row_remove,
+	&__wt_logdesc_col_put,
+	&__wt_logdesc_col_remove,
 };
@@ -0,0 +1,59 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_dirlist --
+ *	Return the names of the files in the home directory starting with a
+ * prefix.  The caller frees the names and the array.
+ */
+int
+__wt_dirlist(WT_SESSION_IMPL *session,
+    const char *prefix, char ***namesp, u_int *countp)
+{
+	struct dirent *dp;
+	DIR *dirp;
+	WT_CONNECTION_IMPL *conn;
+	size_t allocated;
+	u_int count, i;
+	int ret;
+	char **names;
+
+	conn = S2C(session);
+	names = NULL;
+	allocated = 0;
+	count = 0;
+	ret = 0;
+
+	*namesp = NULL;
+	*countp = 0;
+
+	WT_VERBOSE(session, fileops, "%s: directory list", conn->home);
+
+	if ((dirp = opendir(conn->home)) == NULL)
+		WT_RET_MSG(session, __wt_errno(), "%s: opendir", conn->home);
+	while ((dp = readdir(dirp)) != NULL) {
+		if (!WT_PREFIX_MATCH(dp->d_name, prefix))
+			continue;
+		WT_ERR(__wt_realloc(session,
+		    &allocated, (count + 1) * sizeof(char *), &names));
+		WT_ERR(__wt_strdup(session, dp->d_name, &names[count]));
+		++count;
+	}
+
+	*namesp = names;
+	*countp = count;
+
+	if (0) {
+err:		for (i = 0; i < count; ++i)
+			__wt_free(session, names[i]);
+		__wt_free(session, names);
+	}
+	(void)closedir(dirp);
+	return (ret);
+}
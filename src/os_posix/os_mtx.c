@@ -88,6 +88,57 @@ err:	__wt_err(session, ret, "mutex lock failed");
 	__wt_abort(session);
 }
 
+/*
+ * __wt_cond_wait_timed --
+ *	Wait on a condition variable, returning after at most a number of
+ * microseconds if the condition isn't signalled.
+ */
+void
+__wt_cond_wait_timed(WT_SESSION_IMPL *session, WT_CONDVAR *cond, long usecs)
+{
+	struct timespec ts;
+	time_t secs;
+	long nsecs;
+	int ret;
+
+	if (session != NULL)
+		WT_VERBOSE(
+		    session, mutex, "lock %s mutex (%p)", cond->name, cond);
+
+	if ((ret = __wt_epoch(session, &secs, &nsecs)) != 0)
+		goto err;
+	nsecs += (usecs % WT_MILLION) * 1000;
+	ts.tv_sec = secs + usecs / WT_MILLION + nsecs / WT_BILLION;
+	ts.tv_nsec = nsecs % WT_BILLION;
+
+	WT_ERR(pthread_mutex_lock(&cond->mtx));
+
+	/* Unlike an untimed wait, ETIMEDOUT ends the wait. */
+	while (cond->locked) {
+		ret = pthread_cond_timedwait(&cond->cond, &cond->mtx, &ts);
+		if (ret == ETIMEDOUT
+#ifdef ETIME
+		    || ret == ETIME
+#endif
+		    )
+			break;
+		if (ret != 0 && ret != EINTR) {
+			(void)pthread_mutex_unlock(&cond->mtx);
+			goto err;
+		}
+	}
+
+	cond->locked = 1;
+	if (session != NULL)
+		WT_CSTAT_INCR(session, cond_wait);
+
+	WT_ERR(pthread_mutex_unlock(&cond->mtx));
+	return;
+
+err:	__wt_err(session, ret, "mutex lock failed");
+	__wt_abort(session);
+}
+
 /*
  * __wt_cond_signal --
  *	Signal a waiting thread.
@@ -180,6 +231,28 @@ err:		__wt_err(session, ret, "rwlock readlock failed");
 	}
 }
 
+/*
+ * __wt_try_readlock
+ *	Try to get a shared lock, or fail immediately if unavailable.
+ */
+int
+__wt_try_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock)
+{
+	int ret;
+
+	WT_VERBOSE(session, mutex,
+	    "try_readlock %s rwlock (%p)", rwlock->name, rwlock);
+
+	if ((ret = pthread_rwlock_tryrdlock(&rwlock->rwlock)) == 0)
+		WT_CSTAT_INCR(session, rwlock_rdlock);
+	else if (ret != EBUSY) {
+		__wt_err(session, ret, "rwlock try_readlock failed");
+		__wt_abort(session);
+	}
+
+	return (ret);
+}
+
 /*
  * __wt_try_writelock
  *	Try to get an exclusive lock, or fail immediately if unavailable.
@@ -11,12 +11,15 @@ int
 __wt_create_file(WT_SESSION_IMPL *session,
     const char *name, const char *fileuri, int exclusive, const char *config)
 {
+	WT_CONNECTION_IMPL *conn;
 	WT_ITEM *val;
 	const char *cfg[] = API_CONF_DEFAULTS(session, create, config);
 	const char *filecfg[4] = API_CONF_DEFAULTS(file, meta, config);
 	const char *filename, *treeconf;
+	u_int id;
 	int is_schema, vmajor, vminor, vpatch, ret;
 
+	conn = S2C(session);
 	val = NULL;
 	treeconf = NULL;
 	ret = 0;
@@ -63,6 +66,14 @@ __wt_create_file(WT_SESSION_IMPL *session,
 	 */
 	WT_ERR(__wt_buf_fmt(session, val, "version=(major=%d,minor=%d)",
 	    WT_BTREE_MAJOR_VERSION, WT_BTREE_MINOR_VERSION));
+
+	/* Log records identify the file they change by a unique ID. */
+	if (!is_schema) {
+		__wt_spin_lock(session, &conn->spinlock);
+		id = ++conn->next_file_id;
+		__wt_spin_unlock(session, &conn->spinlock);
+		WT_ERR(__wt_buf_catfmt(session, val, ",id=%u", id));
+	}
 	filecfg[2] = val->data;
 
 	if (is_schema)
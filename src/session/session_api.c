@@ -24,7 +24,19 @@ __session_close(WT_SESSION *wt_session, const char *config)
 	session = (WT_SESSION_IMPL *)wt_session;
 
 	SESSION_API_CALL(session, close, config, cfg);
-	WT_UNUSED(cfg);
+
+	/* Roll back any transaction the application left running. */
+	if (F_ISSET(&session->txn, WT_TXN_RUNNING))
+		WT_TRET(__wt_txn_rollback(session, cfg));
+
+	/*
+	 * Turn off cursor caching and close any cached cursors first: cached
+	 * table cursors own column group and index cursors that are still on
+	 * the session's list.
+	 */
+	F_CLR(session, WT_SESSION_CACHE_CURSORS);
+	WT_TRET(__wt_cursor_cache_discard(session));
+	__wt_free(session, session->cursor_cache);
 
 	while ((cursor = TAILQ_FIRST(&session->cursors)) != NULL)
 		WT_TRET(cursor->close(cursor));
@@ -39,6 +51,16 @@ __session_close(WT_SESSION *wt_session, const char *config)
 	/* Discard scratch buffers. */
 	__wt_scr_discard(session);
 
+	/* Discard log record buffers. */
+	__wt_buf_free(session, &session->logrec_buf);
+	__wt_buf_free(session, &session->logprint_buf);
+
+	/* Discard parsed configuration strings. */
+	__wt_config_cache_discard(session);
+
+	/* Discard the transaction context. */
+	__wt_txn_destroy(session);
+
 	/* Confirm we're not holding any hazard references. */
 	__wt_hazard_empty(session);
 
@@ -86,6 +108,7 @@ static int
 __session_open_cursor(WT_SESSION *wt_session,
     const char *uri, WT_CURSOR *to_dup, const char *config, WT_CURSOR **cursorp)
 {
+	WT_CONFIG_ITEM cval;
 	WT_SESSION_IMPL *session;
 	int ret;
 
@@ -96,6 +119,25 @@ __session_open_cursor(WT_SESSION *wt_session,
 		WT_ERR_MSG(session, EINVAL,
 		    "should be passed either a URI or a cursor, but not both");
 
+	/*
+	 * Check the session's cursor cache (duplicated cursors aren't cached,
+	 * they are positioned).
+	 */
+	if (to_dup == NULL && F_ISSET(session, WT_SESSION_CACHE_CURSORS)) {
+		if ((ret = __wt_cursor_cache_get(
+		    session, uri, config, cursorp)) != WT_NOTFOUND)
+			goto err;
+		ret = 0;
+
+		/*
+		 * Bulk cursors need exclusive access to the file, close any
+		 * cached cursors.
+		 */
+		WT_ERR(__wt_config_gets(session, cfg, "bulk", &cval));
+		if (cval.val != 0)
+			WT_ERR(__wt_cursor_cache_discard(session));
+	}
+
 	if (to_dup != NULL)
 		ret = __wt_cursor_dup(session, to_dup, config, cursorp);
 	else if (WT_PREFIX_MATCH(uri, "colgroup:"))
@@ -115,6 +157,12 @@ __session_open_cursor(WT_SESSION *wt_session,
 		ret = EINVAL;
 	}
 
+	if (ret == 0 &&
+	    to_dup == NULL && F_ISSET(session, WT_SESSION_CACHE_CURSORS) &&
+	    (ret = __wt_cursor_cache_add(
+	    session, uri, config, cfg, *cursorp)) != 0)
+		WT_TRET((*cursorp)->close(*cursorp));
+
 err:	API_END_NOTFOUND_MAP(session, ret);
 }
 
@@ -149,6 +197,7 @@ __session_rename(WT_SESSION *wt_session,
 
 	session = (WT_SESSION_IMPL *)wt_session;
 	SESSION_API_CALL(session, rename, config, cfg);
+	WT_ERR(__wt_cursor_cache_discard(session));
 	ret = __wt_schema_rename(session, uri, newname, cfg);
 
 err:	API_END_NOTFOUND_MAP(session, ret);
@@ -166,6 +215,7 @@ __session_drop(WT_SESSION *wt_session, const char *name, const char *config)
 
 	session = (WT_SESSION_IMPL *)wt_session;
 	SESSION_API_CALL(session, drop, config, cfg);
+	WT_ERR(__wt_cursor_cache_discard(session));
 	ret = __wt_schema_drop(session, name, cfg);
 
 err:	API_END_NOTFOUND_MAP(session, ret);
@@ -183,6 +233,7 @@ __session_dumpfile(WT_SESSION *wt_session, const char *uri, const char *config)
 
 	session = (WT_SESSION_IMPL *)wt_session;
 	SESSION_API_CALL(session, dumpfile, config, cfg);
+	WT_ERR(__wt_cursor_cache_discard(session));
 	ret = __wt_schema_worker(session, uri, cfg,
 	    __wt_dumpfile, WT_BTREE_EXCLUSIVE | WT_BTREE_VERIFY);
 
@@ -202,6 +253,7 @@ __session_salvage(WT_SESSION *wt_session, const char *uri, const char *config)
 	session = (WT_SESSION_IMPL *)wt_session;
 
 	SESSION_API_CALL(session, salvage, config, cfg);
+	WT_ERR(__wt_cursor_cache_discard(session));
 	ret = __wt_schema_worker(session, uri, cfg,
 	    __wt_salvage, WT_BTREE_EXCLUSIVE | WT_BTREE_SALVAGE);
 
@@ -288,8 +340,10 @@ __session_truncate(WT_SESSION *wt_session,
 					break;
 				}
 			}
-	} else
+	} else {
+		WT_ERR(__wt_cursor_cache_discard(session));
 		ret = __wt_schema_truncate(session, uri, cfg);
+	}
 
 err:	API_END_NOTFOUND_MAP(session, ret);
 }
@@ -307,6 +361,7 @@ __session_upgrade(WT_SESSION *wt_session, const char *uri, const char *config)
 	session = (WT_SESSION_IMPL *)wt_session;
 
 	SESSION_API_CALL(session, upgrade, config, cfg);
+	WT_ERR(__wt_cursor_cache_discard(session));
 	ret = __wt_schema_worker(session, uri, cfg,
 	    __wt_upgrade, WT_BTREE_EXCLUSIVE | WT_BTREE_UPGRADE);
 
@@ -326,6 +381,7 @@ __session_verify(WT_SESSION *wt_session, const char *uri, const char *config)
 	session = (WT_SESSION_IMPL *)wt_session;
 
 	SESSION_API_CALL(session, verify, config, cfg);
+	WT_ERR(__wt_cursor_cache_discard(session));
 	ret = __wt_schema_worker(session, uri, cfg,
 	    __wt_verify, WT_BTREE_EXCLUSIVE | WT_BTREE_VERIFY);
 
@@ -339,10 +395,15 @@ err:	API_END_NOTFOUND_MAP(session, ret);
 static int
 __session_begin_transaction(WT_SESSION *wt_session, const char *config)
 {
-	WT_UNUSED(wt_session);
-	WT_UNUSED(config);
+	WT_SESSION_IMPL *session;
+	int ret;
 
-	return (ENOTSUP);
+	session = (WT_SESSION_IMPL *)wt_session;
+
+	SESSION_API_CALL(session, begin_transaction, config, cfg);
+	ret = __wt_txn_begin(session, cfg);
+
+err:	API_END_NOTFOUND_MAP(session, ret);
 }
 
 /*
@@ -352,10 +413,15 @@ __session_begin_transaction(WT_SESSION *wt_session, const char *config)
 static int
 __session_commit_transaction(WT_SESSION *wt_session, const char *config)
 {
-	WT_UNUSED(wt_session);
-	WT_UNUSED(config);
+	WT_SESSION_IMPL *session;
+	int ret;
+
+	session = (WT_SESSION_IMPL *)wt_session;
 
-	return (ENOTSUP);
+	SESSION_API_CALL(session, commit_transaction, config, cfg);
+	ret = __wt_txn_commit(session, cfg);
+
+err:	API_END_NOTFOUND_MAP(session, ret);
 }
 
 /*
@@ -365,10 +431,33 @@ __session_commit_transaction(WT_SESSION *wt_session, const char *config)
 static int
 __session_rollback_transaction(WT_SESSION *wt_session, const char *config)
 {
-	WT_UNUSED(wt_session);
-	WT_UNUSED(config);
+	WT_SESSION_IMPL *session;
+	int ret;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+
+	SESSION_API_CALL(session, rollback_transaction, config, cfg);
+	ret = __wt_txn_rollback(session, cfg);
 
-	return (ENOTSUP);
+err:	API_END_NOTFOUND_MAP(session, ret);
+}
+
+/*
+ * __session_transaction_sync --
+ *	WT_SESSION->transaction_sync method.
+ */
+static int
+__session_transaction_sync(WT_SESSION *wt_session, const char *config)
+{
+	WT_SESSION_IMPL *session;
+	int ret;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+
+	SESSION_API_CALL(session, transaction_sync, config, cfg);
+	ret = __wt_txn_sync(session, cfg);
+
+err:	API_END_NOTFOUND_MAP(session, ret);
 }
 
 /*
@@ -378,10 +467,15 @@ __session_rollback_transaction(WT_SESSION *wt_session, const char *config)
 static int
 __session_checkpoint(WT_SESSION *wt_session, const char *config)
 {
-	WT_UNUSED(wt_session);
-	WT_UNUSED(config);
+	WT_SESSION_IMPL *session;
+	int ret;
+
+	session = (WT_SESSION_IMPL *)wt_session;
 
-	return (ENOTSUP);
+	SESSION_API_CALL(session, checkpoint, config, cfg);
+	ret = __wt_checkpoint(session, cfg);
+
+err:	API_END_NOTFOUND_MAP(session, ret);
 }
 
 /*
@@ -428,19 +522,36 @@ __wt_open_session(WT_CONNECTION_IMPL *conn, int internal,
 		__session_begin_transaction,
 		__session_commit_transaction,
 		__session_rollback_transaction,
+		__session_transaction_sync,
 		__session_checkpoint,
 		__session_dumpfile,
 		__session_msg_printf
 	};
+	WT_CONFIG_ITEM cval;
 	WT_SESSION_IMPL *session, *session_ret;
 	uint32_t slot;
-	int ret;
+	u_int i;
+	int cache_cursors, ret;
 
-	WT_UNUSED(config);
 	ret = 0;
 	session = &conn->default_session;
 	session_ret = NULL;
 
+	/*
+	 * Sessions inherit the connection's cursor caching configuration
+	 * unless it's explicitly configured.  Internal sessions don't cache
+	 * cursors.
+	 */
+	cache_cursors = !internal && F_ISSET(conn, WT_CACHE_CURSORS);
+	if (!internal && config != NULL) {
+		if ((ret = __wt_config_getones(
+		    session, config, "cache_cursors", &cval)) == 0)
+			cache_cursors = (cval.val != 0);
+		else if (ret != WT_NOTFOUND)
+			return (ret);
+		ret = 0;
+	}
+
 	__wt_spin_lock(session, &conn->spinlock);
 
 	/* Check to see if there's an available session slot. */
@@ -466,10 +577,17 @@ __wt_open_session(WT_CONNECTION_IMPL *conn, int internal,
 	session_ret->iface.connection = &conn->iface;
 	WT_ASSERT(session, session->event_handler != NULL);
 	session_ret->event_handler = session->event_handler;
-	session_ret->hazard = conn->hazard + slot * conn->hazard_size;
+	session_ret->hazard = conn->hazard + slot * conn->hazard_max;
+	session_ret->stat_slot = slot % WT_STAT_SLOTS;
+	WT_ERR(__wt_txn_init(session_ret, &conn->txn_global.states[slot]));
 
 	TAILQ_INIT(&session_ret->cursors);
+	TAILQ_INIT(&session_ret->cursor_cache_open);
+	if (cache_cursors)
+		F_SET(session_ret, WT_SESSION_CACHE_CURSORS);
 	TAILQ_INIT(&session_ret->btrees);
+	for (i = 0; i < WT_HASH_ARRAY_SIZE; ++i)
+		TAILQ_INIT(&session_ret->btrees_hash[i]);
 	if (event_handler != NULL)
 		session_ret->event_handler = event_handler;
 
@@ -21,6 +21,9 @@ __wt_session_add_btree(
 	btree_session->btree = session->btree;
 
 	TAILQ_INSERT_HEAD(&session->btrees, btree_session, q);
+	TAILQ_INSERT_HEAD(&session->btrees_hash[
+	    session->btree->filename_hash % WT_HASH_ARRAY_SIZE],
+	    btree_session, hashq);
 
 	if (btree_sessionp != NULL)
 		*btree_sessionp = btree_session;
@@ -111,10 +114,14 @@ __wt_session_find_btree(WT_SESSION_IMPL *session,
 {
 	WT_BTREE *btree;
 	WT_BTREE_SESSION *btree_session;
+	uint64_t hash;
 
-	TAILQ_FOREACH(btree_session, &session->btrees, q) {
+	hash = __wt_hash_fnv64(filename, namelen);
+	TAILQ_FOREACH(btree_session,
+	    &session->btrees_hash[hash % WT_HASH_ARRAY_SIZE], hashq) {
 		btree = btree_session->btree;
-		if (strncmp(filename, btree->filename, namelen) == 0 &&
+		if (btree->filename_hash == hash &&
+		    strncmp(filename, btree->filename, namelen) == 0 &&
 		    btree->filename[namelen] == '\0') {
 			if (btree_sessionp != NULL)
 				*btree_sessionp = btree_session;
@@ -182,6 +189,9 @@ __wt_session_remove_btree(
     WT_SESSION_IMPL *session, WT_BTREE_SESSION *btree_session, int locked)
 {
 	TAILQ_REMOVE(&session->btrees, btree_session, q);
+	TAILQ_REMOVE(&session->btrees_hash[
+	    btree_session->btree->filename_hash % WT_HASH_ARRAY_SIZE],
+	    btree_session, hashq);
 	session->btree = btree_session->btree;
 	__wt_free(session, btree_session);
 
@@ -12,7 +12,8 @@ static int __btree_get_root(
 static int __btree_get_turtle(WT_SESSION_IMPL *, const char **, int *, int *);
 static int __btree_parse_root(
 	WT_SESSION_IMPL *, const char *, const char **, int *, int *);
-static int __btree_set_root(WT_SESSION_IMPL *, const char *, WT_ITEM *);
+static int __btree_set_root(
+	WT_SESSION_IMPL *, const char *, WT_ITEM *, const WT_LSN *);
 static int __btree_set_turtle(WT_SESSION_IMPL *, WT_ITEM *);
 
 #define	WT_TURTLE_MSG		"The turtle."
@@ -101,11 +102,12 @@ err:	__wt_scr_free(&addr);
 
 /*
  * __wt_btree_set_root --
- *	Set the file's root address.
+ *	Set the file's root address.  If logging, record the log position
+ * recovery replays the file's changes from, by default the end of the log.
  */
 int
-__wt_btree_set_root(WT_SESSION_IMPL *session,
-    const char *filename, const uint8_t *addr, uint32_t size)
+__wt_btree_set_root(WT_SESSION_IMPL *session, const char *filename,
+    const uint8_t *addr, uint32_t size, const WT_LSN *lsnp)
 {
 	WT_ITEM *v;
 	int ret;
@@ -135,7 +137,7 @@ __wt_btree_set_root(WT_SESSION_IMPL *session,
 
 	WT_ERR(strcmp(filename, WT_SCHEMA_FILENAME) == 0 ?
 	    __btree_set_turtle(session, v) :
-	    __btree_set_root(session, filename, v));
+	    __btree_set_root(session, filename, v, lsnp));
 
 err:	/*
 	 * If we are unrolling a failed create, we may have already removed
@@ -229,6 +231,8 @@ __btree_set_turtle(WT_SESSION_IMPL *session, WT_ITEM *v)
 		ret = WT_ERROR;
 
 	WT_TRET(fflush(fp));
+	if (ret == 0 && fsync(fileno(fp)) != 0)
+		ret = __wt_errno();
 	WT_TRET(fclose(fp));
 
 	if (ret == 0)
@@ -302,9 +306,11 @@ err:	__wt_scr_free(&key);
  *	Set a non-schema file's root address.
  */
 static int
-__btree_set_root(WT_SESSION_IMPL *session, const char *filename, WT_ITEM *v)
+__btree_set_root(WT_SESSION_IMPL *session,
+    const char *filename, WT_ITEM *v, const WT_LSN *lsnp)
 {
 	WT_ITEM *key, *newv;
+	WT_LOG *log;
 	const char *cfg[3], *newcfg;
 	int ret;
 
@@ -317,10 +323,22 @@ __btree_set_root(WT_SESSION_IMPL *session, const char *filename, WT_ITEM *v)
 	WT_ERR(__wt_scr_alloc(session, 0, &newv));
 	WT_ERR(__wt_buf_fmt(session, newv, "root=%.*s",
 	    (int)v->size, (const char *)v->data));
+	if ((log = S2C(session)->log) != NULL)
+		WT_ERR(__wt_buf_catfmt(session, newv,
+		    ",checkpoint_lsn=%" PRIu64,
+		    lsnp == NULL ? log->write_lsn : *lsnp));
 	cfg[1] = newv->data;
 	cfg[2] = NULL;
 	WT_ERR(__wt_config_collapse(session, cfg, &newcfg));
-	WT_ERR(__wt_schema_table_update(session, key->data, newcfg));
+
+	/*
+	 * The root address isn't transactional: a checkpoint of the schema
+	 * file must write it, whatever transactions are running.
+	 */
+	F_SET(session, WT_SESSION_NO_TXN);
+	ret = __wt_schema_table_update(session, key->data, newcfg);
+	F_CLR(session, WT_SESSION_NO_TXN);
+	WT_ERR(ret);
 
 err:	__wt_scr_free(&key);
 	__wt_scr_free(&newv);
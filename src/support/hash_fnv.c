@@ -0,0 +1,28 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_hash_fnv64 --
+ *	Return a 64-bit Fowler/Noll/Vo FNV-1a hash of a buffer.
+ *
+ * FNV-1a is simple and fast on short strings such as file names, which is all
+ * we use it for, and distributes well enough for hash table buckets.
+ */
+uint64_t
+__wt_hash_fnv64(const void *string, size_t len)
+{
+	const uint8_t *p;
+	uint64_t hash;
+
+	for (hash = 0xcbf29ce484222325ULL, p = string; len > 0; --len, ++p) {
+		hash ^= *p;
+		hash *= 0x100000001b3ULL;
+	}
+	return (hash);
+}
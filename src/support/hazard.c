@@ -10,6 +10,13 @@
 #ifdef HAVE_DIAGNOSTIC
 static void __hazard_dump(WT_SESSION_IMPL *);
 #endif
+static int  __hazard_epoch_set(WT_SESSION_IMPL *, WT_REF *);
+
+/*
+ * Discarded pages are queued until no session can be using them; check the
+ * queue when it reaches this size.
+ */
+#define	WT_EPOCH_FREE_MAX	64
 
 /*
  * __wt_hazard_set --
@@ -27,6 +34,9 @@ __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref
 
 	conn = S2C(session);
 
+	if (F_ISSET(conn, WT_EPOCH_RECLAIM))
+		return (__hazard_epoch_set(session, ref));
+
 	/*
 	 * Do the dance:
 	 *
@@ -112,9 +122,16 @@ __wt_hazard_clear(WT_SESSION_IMPL *session, WT_PAGE *page)
 	WT_VERBOSE(session, hazard,
 	    "session %p hazard %p: clr", session, page);
 
+	if (F_ISSET(conn, WT_EPOCH_RECLAIM)) {
+		WT_ASSERT(session, session->pins > 0 && page->pins > 0);
+		--session->pins;
+		(void)WT_ATOMIC_ADD(page->pins, -1);
+		return;
+	}
+
 	/* Clear the caller's hazard pointer. */
 	for (hp = session->hazard;
-	    hp < session->hazard + conn->hazard_size; ++hp)
+	    hp < session->hazard + conn->hazard_max; ++hp)
 		if (hp->page == page) {
 			hp->page = NULL;
 			/*
@@ -154,13 +171,160 @@ __wt_hazard_empty(WT_SESSION_IMPL *session)
 #endif
 
 	for (hp = session->hazard;
-	    hp < session->hazard + conn->hazard_size; ++hp)
+	    hp < session->hazard + conn->hazard_max; ++hp)
 		if (hp->page != NULL) {
 			hp->page = NULL;
 
 			__wt_errx(session,
 			    "unexpected hazard reference at session.close");
 		}
+
+	if (session->pins != 0) {
+		session->pins = 0;
+
+		__wt_errx(session, "unexpected pinned page at session.close");
+	}
+}
+
+/*
+ * __hazard_epoch_set --
+ *	Pin a page by incrementing its reference count.
+ */
+static int
+__hazard_epoch_set(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+	WT_PAGE *page;
+	int ret;
+
+	ret = 0;
+
+	/*
+	 * Enter the current epoch before reading the page reference: if the
+	 * page is discarded while we're looking at it, the memory won't be
+	 * freed until we leave the epoch.
+	 */
+	session->epoch = S2C(session)->epoch;
+	WT_FULL_BARRIER();
+
+	/*
+	 * Increment the page's reference count, then see if the page is still
+	 * the WT_REF's page, and its state is still valid (where valid means a
+	 * state of WT_REF_MEM or WT_REF_EVICT_WALK).  This is the same dance as
+	 * setting a hazard reference: the eviction server sets the state to
+	 * WT_REF_LOCKED, then checks the reference count.
+	 */
+	if ((page = ref->page) == NULL)
+		ret = EBUSY;
+	else {
+		(void)WT_ATOMIC_ADD(page->pins, 1);
+		if (ref->page == page && (ref->state == WT_REF_MEM ||
+		    ref->state == WT_REF_EVICT_WALK)) {
+			++session->pins;
+			WT_VERBOSE(session, hazard,
+			    "session %p hazard %p: set", session, page);
+		} else {
+			(void)WT_ATOMIC_ADD(page->pins, -1);
+			ret = EBUSY;
+		}
+	}
+
+	/* Leave the epoch. */
+	WT_PUBLISH(session->epoch, 0);
+	return (ret);
+}
+
+/*
+ * __hazard_epoch_min --
+ *	Return the oldest epoch any session is in, or the current epoch if no
+ * session is pinning a page.
+ */
+static uint64_t
+__hazard_epoch_min(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *s;
+	uint64_t epoch, min;
+	uint32_t i;
+
+	conn = S2C(session);
+
+	/*
+	 * Walk the entire session array, not the list of active sessions: the
+	 * list is compacted as sessions close, and we could miss a session.
+	 */
+	min = conn->epoch;
+	if ((epoch = conn->default_session.epoch) != 0 && epoch < min)
+		min = epoch;
+	for (s = conn->session_array, i = 0; i < conn->session_size; ++s, ++i)
+		if ((epoch = s->epoch) != 0 && epoch < min)
+			min = epoch;
+	return (min);
+}
+
+/*
+ * __wt_hazard_page_free --
+ *	Free a discarded page's WT_PAGE structure.
+ */
+void
+__wt_hazard_page_free(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	if (!F_ISSET(conn, WT_EPOCH_RECLAIM)) {
+		__wt_free(session, page);
+		return;
+	}
+
+	/*
+	 * A thread may have read the page reference and be about to increment
+	 * the page's reference count: queue the page, stamped with the epoch
+	 * in which it was discarded, it can be freed once no session is in
+	 * that epoch.  The page's contents have been discarded, re-use the
+	 * parent and read-generation fields for the queue.
+	 */
+	__wt_spin_lock(session, &conn->epoch_lock);
+	page->read_gen = WT_ATOMIC_ADD(conn->epoch, 1) - 1;
+	page->parent = conn->epoch_free;
+	conn->epoch_free = page;
+	++conn->epoch_free_cnt;
+	__wt_spin_unlock(session, &conn->epoch_lock);
+
+	if (conn->epoch_free_cnt >= WT_EPOCH_FREE_MAX)
+		__wt_hazard_page_drain(session, 0);
+}
+
+/*
+ * __wt_hazard_page_drain --
+ *	Free discarded pages no session can still be using.
+ */
+void
+__wt_hazard_page_drain(WT_SESSION_IMPL *session, int force)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_PAGE *free_list, *page, **pagep;
+	uint64_t min;
+
+	conn = S2C(session);
+	free_list = NULL;
+
+	__wt_spin_lock(session, &conn->epoch_lock);
+	min = __hazard_epoch_min(session);
+	for (pagep = &conn->epoch_free; (page = *pagep) != NULL;)
+		if (force || page->read_gen < min) {
+			*pagep = page->parent;
+			page->parent = free_list;
+			free_list = page;
+			--conn->epoch_free_cnt;
+		} else
+			pagep = &page->parent;
+	__wt_spin_unlock(session, &conn->epoch_lock);
+
+	while ((page = free_list) != NULL) {
+		free_list = page->parent;
+		__wt_free(session, page);
+	}
 }
 
 #ifdef HAVE_DIAGNOSTIC
@@ -179,7 +343,7 @@ __hazard_dump(WT_SESSION_IMPL *session)
 
 	fail = 0;
 	for (hp = session->hazard;
-	    hp < session->hazard + conn->hazard_size; ++hp)
+	    hp < session->hazard + conn->hazard_max; ++hp)
 		if (hp->page != NULL) {
 			__wt_errx(session,
 			    "hazard reference: (%p: %s, line %d)",
@@ -204,7 +368,15 @@ __wt_hazard_validate(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	conn = S2C(session);
 
-	elem = conn->session_size * conn->hazard_size;
+	if (F_ISSET(conn, WT_EPOCH_RECLAIM)) {
+		if (page->pins != 0)
+			__wt_errx(session,
+			    "discarded page has %" PRIu32 " references",
+			    page->pins);
+		return;
+	}
+
+	elem = conn->session_size * conn->hazard_max;
 	for (i = 0, hp = conn->hazard; i < elem; ++i, ++hp)
 		if (hp->page == page)
 			__wt_errx(session,
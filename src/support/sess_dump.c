@@ -51,7 +51,7 @@ __wt_session_dump(WT_SESSION_IMPL *session)
 
 	first = 0;
 	for (hp = session->hazard;
-	    hp < session->hazard + conn->hazard_size; ++hp) {
+	    hp < session->hazard + conn->hazard_max; ++hp) {
 		if (hp->page == NULL)
 			continue;
 		if (++first == 1)
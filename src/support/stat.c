@@ -3,11 +3,12 @@
 #include "wt_internal.h"
 
 int
-__wt_stat_alloc_btree_stats(WT_SESSION_IMPL *session, WT_BTREE_STATS **statsp)
+__wt_stat_alloc_btree_stats(WT_SESSION_IMPL *session,
+    u_int slots, WT_BTREE_STATS **statsp)
 {
 	WT_BTREE_STATS *stats;
 
-	WT_RET(__wt_calloc_def(session, 1, &stats));
+	WT_RET(__wt_calloc_def(session, slots, &stats));
 
 	stats->alloc.desc = "file: block allocations";
 	stats->cursor_inserts.desc = "cursor-inserts";
@@ -21,6 +22,8 @@ __wt_stat_alloc_btree_stats(WT_SESSION_IMPL *session, WT_BTREE_STATS **statsp)
 	stats->extend.desc = "file: block allocations required file extension";
 	stats->file_allocsize.desc = "page size allocation unit";
 	stats->file_bulk_loaded.desc = "bulk-loaded entries";
+	stats->file_cache_bytes.desc =
+	    "file: bytes currently held in the cache";
 	stats->file_col_deleted.desc = "column-store deleted values";
 	stats->file_col_fix_pages.desc = "column-store fixed-size leaf pages";
 	stats->file_col_int_pages.desc = "column-store internal pages";
@@ -79,6 +82,7 @@ __wt_stat_clear_btree_stats(WT_STATS *stats_arg)
 	stats->extend.v = 0;
 	stats->file_allocsize.v = 0;
 	stats->file_bulk_loaded.v = 0;
+	stats->file_cache_bytes.v = 0;
 	stats->file_col_deleted.v = 0;
 	stats->file_col_fix_pages.v = 0;
 	stats->file_col_int_pages.v = 0;
@@ -113,34 +117,117 @@ __wt_stat_clear_btree_stats(WT_STATS *stats_arg)
 }
 
 int
-__wt_stat_alloc_connection_stats(WT_SESSION_IMPL *session, WT_CONNECTION_STATS **statsp)
+__wt_stat_alloc_connection_stats(WT_SESSION_IMPL *session,
+    u_int slots, WT_CONNECTION_STATS **statsp)
 {
 	WT_CONNECTION_STATS *stats;
 
-	WT_RET(__wt_calloc_def(session, 1, &stats));
+	WT_RET(__wt_calloc_def(session, slots, &stats));
 
+	stats->arena_alloc.desc = "page arena: structures allocated";
+	stats->arena_chunk_alloc.desc = "page arena: chunks allocated";
+	stats->arena_chunk_bytes.desc =
+	    "page arena: bytes allocated in chunks";
+	stats->arena_chunk_free.desc = "page arena: chunks freed";
+	stats->arena_wasted.desc = "page arena: bytes of unused structures";
 	stats->block_read.desc = "blocks read from a file";
 	stats->block_write.desc = "blocks written to a file";
+	stats->cache_bytes_dirty.desc =
+	    "cache: modified bytes currently held in the cache";
 	stats->cache_bytes_inuse.desc =
 	    "cache: bytes currently held in the cache";
 	stats->cache_bytes_max.desc = "cache: maximum bytes configured";
+	stats->cache_clean_fail.desc =
+	    "cache: dirty pages not written ahead of eviction because of an error";
+	stats->cache_clean_pages.desc =
+	    "cache: dirty pages written ahead of eviction";
+	stats->cache_evict_app.desc =
+	    "cache: pages evicted by application threads";
+	stats->cache_evict_app_wait.desc =
+	    "cache: application threads waiting for eviction";
 	stats->cache_evict_hazard.desc =
 	    "cache: pages selected for eviction not evicted because of a hazard reference";
 	stats->cache_evict_internal.desc = "cache: internal pages evicted";
 	stats->cache_evict_modified.desc = "cache: modified pages evicted";
+	stats->cache_evict_readers.desc =
+	    "cache: pages not written because running transactions need their updates";
 	stats->cache_evict_slow.desc =
 	    "cache: eviction server unable to reach eviction goal";
 	stats->cache_evict_unmodified.desc = "cache: unmodified pages evicted";
 	stats->cache_pages_inuse.desc =
 	    "cache: pages currently held in the cache";
+	stats->cache_stall_ge100ms.desc =
+	    "cache: application waits for a page: 100ms or more";
+	stats->cache_stall_lt100ms.desc =
+	    "cache: application waits for a page: 10ms to 100ms";
+	stats->cache_stall_lt10ms.desc =
+	    "cache: application waits for a page: 1ms to 10ms";
+	stats->cache_stall_lt1ms.desc =
+	    "cache: application waits for a page: less than 1ms";
+	stats->cache_warm_read.desc =
+	    "cache: saved pages read back into the cache";
+	stats->cache_warm_saved.desc =
+	    "cache: pages saved as the connection closed";
+	stats->checkpoint.desc = "checkpoints";
+	stats->checkpoint_bytes.desc = "checkpoint: bytes written";
+	stats->checkpoint_skipped.desc =
+	    "checkpoint: skipped because of the timeout or log_size";
+	stats->checkpoint_stall_max.desc =
+	    "checkpoint: longest application wait for a page (usecs)";
+	stats->checkpoint_time.desc =
+	    "checkpoint: time spent in checkpoints (usecs)";
 	stats->cond_wait.desc = "condition wait calls";
+	stats->config_cache_hit.desc =
+	    "configuration cache: strings found in the cache";
+	stats->config_cache_miss.desc = "configuration cache: strings parsed";
+	stats->cursor_cache_hit.desc =
+	    "cursor cache: cursors reused from the cache";
+	stats->cursor_cache_miss.desc =
+	    "cursor cache: cursors not found in the cache";
 	stats->file_open.desc = "files currently open";
+	stats->log_archived.desc = "log: files removed by archival";
+	stats->log_background_syncs.desc =
+	    "log: syncs by the log flush thread";
+	stats->log_bytes.desc = "log: bytes written";
+	stats->log_compressed.desc = "log: records compressed";
+	stats->log_ops.desc = "log: file operations logged";
+	stats->log_prealloc.desc = "log: files pre-allocated";
+	stats->log_prealloc_missed.desc =
+	    "log: files created because no pre-allocated file was ready";
+	stats->log_records.desc = "log: records written";
+	stats->log_recycled.desc = "log: files recycled by archival";
+	stats->log_sync_records.desc = "log: records synced";
+	stats->log_sync_wait_time.desc =
+	    "log: time spent waiting for records to be synced (usecs)";
+	stats->log_sync_waits.desc = "log: records waiting to be synced";
+	stats->log_syncs.desc = "log: syncs";
+	stats->log_writes.desc = "log: writes";
 	stats->memalloc.desc = "total memory allocations";
 	stats->memfree.desc = "total memory frees";
+	stats->read_ahead_hit.desc =
+	    "read-ahead: pages read ahead found by a cursor scan";
+	stats->read_ahead_miss.desc =
+	    "read-ahead: pages found by a cursor scan not read ahead";
+	stats->read_ahead_queued.desc = "read-ahead: pages queued";
+	stats->recovery_applied.desc = "recovery: records replayed";
+	stats->recovery_rate.desc = "recovery: records replayed per second";
+	stats->recovery_scanned.desc = "recovery: log records read";
+	stats->recovery_time.desc =
+	    "recovery: time spent replaying the log (usecs)";
 	stats->rwlock_rdlock.desc = "rwlock readlock calls";
 	stats->rwlock_wrlock.desc = "rwlock writelock calls";
 	stats->total_read_io.desc = "total read I/Os";
 	stats->total_write_io.desc = "total write I/Os";
+	stats->txn_begin.desc = "transactions: begins";
+	stats->txn_commit.desc = "transactions: committed";
+	stats->txn_conflict.desc = "transactions: update conflicts";
+	stats->txn_rollback.desc = "transactions: rolled back";
+	stats->txn_sync.desc = "transactions: waits for a commit to be synced";
+	stats->write_queue_full.desc =
+	    "write queue: blocks written directly because the queue was full";
+	stats->write_queue_read.desc =
+	    "write queue: blocks read from the queue";
+	stats->write_queued.desc = "write queue: blocks queued";
 
 	*statsp = stats;
 	return (0);
@@ -152,19 +239,102 @@ __wt_stat_clear_connection_stats(WT_STATS *stats_arg)
 	WT_CONNECTION_STATS *stats;
 
 	stats = (WT_CONNECTION_STATS *)stats_arg;
+	stats->arena_alloc.v = 0;
+	stats->arena_chunk_alloc.v = 0;
+	stats->arena_chunk_bytes.v = 0;
+	stats->arena_chunk_free.v = 0;
+	stats->arena_wasted.v = 0;
 	stats->block_read.v = 0;
 	stats->block_write.v = 0;
+	stats->cache_clean_fail.v = 0;
+	stats->cache_clean_pages.v = 0;
+	stats->cache_evict_app.v = 0;
+	stats->cache_evict_app_wait.v = 0;
 	stats->cache_evict_hazard.v = 0;
 	stats->cache_evict_internal.v = 0;
 	stats->cache_evict_modified.v = 0;
+	stats->cache_evict_readers.v = 0;
 	stats->cache_evict_slow.v = 0;
 	stats->cache_evict_unmodified.v = 0;
+	stats->cache_stall_ge100ms.v = 0;
+	stats->cache_stall_lt100ms.v = 0;
+	stats->cache_stall_lt10ms.v = 0;
+	stats->cache_stall_lt1ms.v = 0;
+	stats->cache_warm_read.v = 0;
+	stats->cache_warm_saved.v = 0;
+	stats->checkpoint.v = 0;
+	stats->checkpoint_bytes.v = 0;
+	stats->checkpoint_skipped.v = 0;
+	stats->checkpoint_time.v = 0;
 	stats->cond_wait.v = 0;
+	stats->config_cache_hit.v = 0;
+	stats->config_cache_miss.v = 0;
+	stats->cursor_cache_hit.v = 0;
+	stats->cursor_cache_miss.v = 0;
 	stats->file_open.v = 0;
+	stats->log_archived.v = 0;
+	stats->log_background_syncs.v = 0;
+	stats->log_bytes.v = 0;
+	stats->log_compressed.v = 0;
+	stats->log_ops.v = 0;
+	stats->log_prealloc.v = 0;
+	stats->log_prealloc_missed.v = 0;
+	stats->log_records.v = 0;
+	stats->log_recycled.v = 0;
+	stats->log_sync_records.v = 0;
+	stats->log_sync_wait_time.v = 0;
+	stats->log_sync_waits.v = 0;
+	stats->log_syncs.v = 0;
+	stats->log_writes.v = 0;
 	stats->memalloc.v = 0;
 	stats->memfree.v = 0;
+	stats->read_ahead_hit.v = 0;
+	stats->read_ahead_miss.v = 0;
+	stats->read_ahead_queued.v = 0;
+	stats->recovery_applied.v = 0;
+	stats->recovery_scanned.v = 0;
+	stats->recovery_time.v = 0;
 	stats->rwlock_rdlock.v = 0;
 	stats->rwlock_wrlock.v = 0;
 	stats->total_read_io.v = 0;
 	stats->total_write_io.v = 0;
+	stats->txn_begin.v = 0;
+	stats->txn_commit.v = 0;
+	stats->txn_conflict.v = 0;
+	stats->txn_rollback.v = 0;
+	stats->txn_sync.v = 0;
+	stats->write_queue_full.v = 0;
+	stats->write_queue_read.v = 0;
+	stats->write_queued.v = 0;
+}
+
+int
+__wt_stat_alloc_evict_worker_stats(WT_SESSION_IMPL *session,
+    u_int slots, WT_EVICT_WORKER_STATS **statsp)
+{
+	WT_EVICT_WORKER_STATS *stats;
+
+	WT_RET(__wt_calloc_def(session, slots, &stats));
+
+	stats->evict_worker_fail.desc =
+	    "eviction worker: pages selected but not evicted";
+	stats->evict_worker_pages.desc = "eviction worker: pages evicted";
+	stats->evict_worker_time.desc =
+	    "eviction worker: time spent evicting (usecs)";
+	stats->evict_worker_wakeup.desc = "eviction worker: wakeups";
+
+	*statsp = stats;
+	return (0);
+}
+
+void
+__wt_stat_clear_evict_worker_stats(WT_STATS *stats_arg)
+{
+	WT_EVICT_WORKER_STATS *stats;
+
+	stats = (WT_EVICT_WORKER_STATS *)stats_arg;
+	stats->evict_worker_fail.v = 0;
+	stats->evict_worker_pages.v = 0;
+	stats->evict_worker_time.v = 0;
+	stats->evict_worker_wakeup.v = 0;
 }
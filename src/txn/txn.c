@@ -0,0 +1,344 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_txn_global_init --
+ *	Allocate the connection's transaction table.
+ */
+int
+__wt_txn_global_init(WT_CONNECTION_IMPL *conn)
+{
+	WT_SESSION_IMPL *session;
+	WT_TXN_GLOBAL *txn_global;
+
+	session = &conn->default_session;
+	txn_global = &conn->txn_global;
+
+	/* There's a slot for each session, and one for the default session. */
+	txn_global->states_cnt = conn->session_size + 1;
+	WT_RET(__wt_calloc_def(
+	    session, txn_global->states_cnt, &txn_global->states));
+
+	return (__wt_txn_init(
+	    session, &txn_global->states[conn->session_size]));
+}
+
+/*
+ * __wt_txn_global_destroy --
+ *	Discard the connection's transaction table.
+ */
+void
+__wt_txn_global_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_SESSION_IMPL *session;
+
+	session = &conn->default_session;
+
+	__wt_txn_destroy(session);
+	__wt_free(session, conn->txn_global.states);
+}
+
+/*
+ * __wt_txn_init --
+ *	Initialize a session's transaction context.
+ */
+int
+__wt_txn_init(WT_SESSION_IMPL *session, WT_TXN_STATE *state)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	txn->id = WT_TXN_NONE;
+	txn->isolation = TXN_ISO_READ_COMMITTED;
+	txn->state = state;
+	state->id = state->snap_min = WT_TXN_NONE;
+
+	/* A snapshot can't hold more IDs than there are sessions. */
+	return (__wt_calloc_def(session,
+	    S2C(session)->txn_global.states_cnt, &txn->snapshot));
+}
+
+/*
+ * __wt_txn_destroy --
+ *	Discard a session's transaction context.
+ */
+void
+__wt_txn_destroy(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	__wt_free(session, txn->snapshot);
+	__wt_free(session, txn->mod);
+	txn->mod_alloc = 0;
+	__wt_buf_free(session, &txn->logrecs);
+	txn->state = NULL;
+}
+
+/*
+ * __wt_txn_get_snapshot --
+ *	Take a snapshot: the transactions running right now, other than the
+ * session's own transaction, if any.
+ */
+void
+__wt_txn_get_snapshot(WT_SESSION_IMPL *session, uint64_t my_id)
+{
+	WT_TXN *txn;
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *s;
+	uint64_t current, id, snap_min, *snapshot;
+	uint32_t i, j, n;
+
+	txn = &session->txn;
+	txn_global = &S2C(session)->txn_global;
+	snapshot = txn->snapshot;
+
+	/*
+	 * Read the ID counter before scanning the table: any ID allocated from
+	 * now on is past the end of the snapshot, and any ID allocated before
+	 * now was published before it was allocated.
+	 */
+	WT_ORDERED_READ(current, txn_global->current);
+	snap_min = current + 1;
+
+	for (i = n = 0, s = txn_global->states;
+	    i < txn_global->states_cnt; ++i, ++s) {
+		id = s->id;
+		if (id == WT_TXN_NONE || id == my_id || id > current)
+			continue;
+
+		/* Insert sort: snapshots are small, and searched in order. */
+		for (j = n++; j > 0 && snapshot[j - 1] > id; --j)
+			snapshot[j] = snapshot[j - 1];
+		snapshot[j] = id;
+		if (id < snap_min)
+			snap_min = id;
+	}
+
+	txn->snap_min = snap_min;
+	txn->snap_max = current + 1;
+	txn->snapshot_count = n;
+}
+
+/*
+ * __wt_txn_oldest --
+ *	Return the oldest ID that some running transaction might not see:
+ * updates made by transactions with smaller IDs are visible to everyone.
+ */
+uint64_t
+__wt_txn_oldest(WT_SESSION_IMPL *session)
+{
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *s;
+	uint64_t id, oldest;
+	uint32_t i;
+
+	/*
+	 * When a file is being closed, no transaction can be reading it and
+	 * every transaction that updated it has resolved: the newest committed
+	 * updates are the only ones anyone will ever need.
+	 */
+	if (F_ISSET(session, WT_SESSION_EVICT_CLOSE))
+		return (WT_TXN_ABORTED);
+
+	txn_global = &S2C(session)->txn_global;
+
+	WT_ORDERED_READ(oldest, txn_global->current);
+	++oldest;
+	for (i = 0, s = txn_global->states;
+	    i < txn_global->states_cnt; ++i, ++s) {
+		if ((id = s->id) != WT_TXN_NONE && id < oldest)
+			oldest = id;
+		if ((id = s->snap_min) != WT_TXN_NONE && id < oldest)
+			oldest = id;
+	}
+	return (oldest);
+}
+
+/*
+ * __wt_txn_begin --
+ *	Begin a transaction.
+ */
+int
+__wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_TXN *txn;
+	WT_TXN_STATE *state;
+
+	txn = &session->txn;
+	state = txn->state;
+
+	if (F_ISSET(txn, WT_TXN_RUNNING))
+		WT_RET_MSG(session, EINVAL, "Transaction already running");
+
+	WT_RET(__wt_config_gets(session, cfg, "isolation", &cval));
+	if (strncmp(cval.str, "serializable", cval.len) == 0)
+		WT_RET_MSG(session, ENOTSUP,
+		    "serializable isolation is not supported");
+	if (strncmp(cval.str, "snapshot", cval.len) == 0)
+		txn->isolation = TXN_ISO_SNAPSHOT;
+	else if (strncmp(cval.str, "read-uncommitted", cval.len) == 0)
+		txn->isolation = TXN_ISO_READ_UNCOMMITTED;
+	else
+		txn->isolation = TXN_ISO_READ_COMMITTED;
+
+	WT_RET(__wt_config_gets(session, cfg, "sync", &cval));
+	if (strncmp(cval.str, "none", cval.len) == 0)
+		txn->sync = TXN_SYNC_NONE;
+	else if (strncmp(cval.str, "write", cval.len) == 0)
+		txn->sync = TXN_SYNC_WRITE;
+	else if (strncmp(cval.str, "background", cval.len) == 0)
+		txn->sync = TXN_SYNC_BACKGROUND;
+	else
+		txn->sync = TXN_SYNC_FULL;
+
+	/*
+	 * A snapshot transaction's snapshot has to stay readable until the
+	 * transaction resolves, and reconciliation only discards old versions
+	 * of values when every published snapshot can see the newer version.
+	 * Until the snapshot is built, publish the smallest possible value so
+	 * reconciliation can't discard a version the snapshot ends up needing.
+	 * Allocating the ID is a full barrier, the scan can't start before the
+	 * placeholder is visible.
+	 */
+	if (txn->isolation == TXN_ISO_SNAPSHOT)
+		state->snap_min = WT_TXN_NONE + 1;
+
+	txn->id = __wt_txn_id_alloc(session);
+	__wt_txn_get_snapshot(session, txn->id);
+
+	if (txn->isolation == TXN_ISO_SNAPSHOT)
+		WT_PUBLISH(state->snap_min, txn->snap_min);
+
+	F_SET(txn, WT_TXN_RUNNING);
+	WT_CSTAT_INCR(session, txn_begin);
+	return (0);
+}
+
+/*
+ * __txn_release --
+ *	Release the resources associated with the current transaction.
+ */
+static void
+__txn_release(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+	WT_TXN_STATE *state;
+
+	txn = &session->txn;
+	state = txn->state;
+
+	txn->mod_count = 0;
+	txn->logrecs.size = 0;
+
+	/* Clearing the published ID commits or aborts the transaction. */
+	state->snap_min = WT_TXN_NONE;
+	WT_PUBLISH(state->id, WT_TXN_NONE);
+
+	txn->id = WT_TXN_NONE;
+	txn->isolation = TXN_ISO_READ_COMMITTED;
+	F_CLR(txn, WT_TXN_RUNNING);
+}
+
+/*
+ * __wt_txn_commit --
+ *	Commit the current transaction.
+ */
+int
+__wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_TXN *txn;
+	WT_LSN lsn;
+	uint32_t flags;
+	int ret;
+
+	txn = &session->txn;
+	if (!F_ISSET(txn, WT_TXN_RUNNING))
+		WT_RET_MSG(session, EINVAL, "No transaction is active");
+
+	/*
+	 * Log the commit, with the transaction's operations, before the
+	 * transaction's updates become visible, if the transaction changed
+	 * any logged file.  How long we wait depends on the transaction's sync
+	 * level: if the commit can't be logged, the transaction is rolled back.
+	 */
+	if (S2C(session)->log != NULL && txn->logrecs.size != 0) {
+		flags = 0;
+		if (txn->sync == TXN_SYNC_FULL)
+			flags = WT_LOG_FSYNC;
+		else if (txn->sync == TXN_SYNC_WRITE)
+			flags = WT_LOG_FLUSH;
+		if ((ret = __wt_logput_commit(
+		    session, &lsn, flags, txn->id, &txn->logrecs)) != 0) {
+			WT_TRET(__wt_txn_rollback(session, cfg));
+			return (ret);
+		}
+
+		/* The record was written from the session's log buffer. */
+		txn->commit_lsn = lsn + session->logrec_buf.size;
+		if (txn->sync == TXN_SYNC_BACKGROUND)
+			__wt_log_background(session, txn->commit_lsn);
+	}
+
+	__txn_release(session);
+	WT_CSTAT_INCR(session, txn_commit);
+	return (0);
+}
+
+/*
+ * __wt_txn_sync --
+ *	Wait for the session's last commit to be synced to disk.
+ */
+int
+__wt_txn_sync(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_TXN *txn;
+
+	WT_UNUSED(cfg);
+
+	txn = &session->txn;
+	if (F_ISSET(txn, WT_TXN_RUNNING))
+		WT_RET_MSG(session, EINVAL,
+		    "transaction_sync not permitted in a running transaction");
+
+	WT_CSTAT_INCR(session, txn_sync);
+	return (__wt_log_wait(session, txn->commit_lsn));
+}
+
+/*
+ * __wt_txn_rollback --
+ *	Roll back the current transaction.
+ */
+int
+__wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_TXN *txn;
+	WT_UPDATE **m;
+	u_int i;
+
+	WT_UNUSED(cfg);
+
+	txn = &session->txn;
+	if (!F_ISSET(txn, WT_TXN_RUNNING))
+		WT_RET_MSG(session, EINVAL, "No transaction is active");
+
+	/*
+	 * Mark the transaction's updates aborted before the transaction's ID
+	 * is cleared: no reader can see them in between.
+	 */
+	for (i = 0, m = txn->mod; i < txn->mod_count; ++i, ++m)
+		(*m)->txnid = WT_TXN_ABORTED;
+
+	__txn_release(session);
+	WT_CSTAT_INCR(session, txn_rollback);
+	return (0);
+}
@@ -0,0 +1,303 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+static void __ckpt_lsn(WT_SESSION_IMPL *);
+static int  __ckpt_skip(WT_SESSION_IMPL *, const char *[], int *);
+
+/*
+ * __wt_checkpoint --
+ *	Checkpoint the database.
+ *
+ * Checkpoints are fuzzy: application threads continue to read and update
+ * the files while their dirty pages are written.  Each file's root address
+ * is recorded in the schema file, and the schema file's root in the turtle
+ * file: when the turtle file is renamed into place, the checkpoint is
+ * durable, and only then can the blocks freed before the checkpoint started
+ * be reused.
+ */
+int
+__wt_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_BTREE *btree, **btrees, *saved_btree, *schema_btree;
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_CURSOR *cursor;
+	time_t start_secs, stop_secs;
+	long start_nsecs, stop_nsecs;
+	size_t allocated;
+	u_int i, nbtrees;
+	int archive, flush_cache, force, ret, skip;
+
+	conn = S2C(session);
+	saved_btree = session->btree;
+	btrees = NULL;
+	schema_btree = NULL;
+	allocated = 0;
+	nbtrees = 0;
+	ret = 0;
+
+	/*
+	 * The root addresses aren't written transactionally, and a checkpoint
+	 * can't include a running transaction's updates.
+	 */
+	if (F_ISSET(&session->txn, WT_TXN_RUNNING))
+		WT_RET_MSG(session, EINVAL,
+		    "checkpoint not permitted in a running transaction");
+
+	WT_RET(__wt_config_gets(session, cfg, "force", &cval));
+	force = cval.val != 0;
+	WT_RET(__wt_config_gets(session, cfg, "flush_cache", &cval));
+	flush_cache = cval.val != 0;
+
+	/* The log is flushed even if the checkpoint is skipped. */
+	WT_RET(__wt_config_gets(session, cfg, "flush_log", &cval));
+	if (cval.val != 0)
+		WT_RET(__wt_log_sync(session));
+
+	WT_RET(__wt_config_gets(session, cfg, "archive", &cval));
+	archive = cval.val != 0;
+
+	WT_RET(__wt_epoch(session, &start_secs, &start_nsecs));
+
+	/* One checkpoint at a time, and file syncs wait for it. */
+	__wt_writelock(session, conn->ckpt_rwlock);
+
+	if (!force) {
+		WT_ERR(__ckpt_skip(session, cfg, &skip));
+		if (skip) {
+			WT_CSTAT_INCR(session, checkpoint_skipped);
+			goto err;
+		}
+	}
+
+	/*
+	 * Recovery replays each file's changes from the checkpoint's LSN:
+	 * changes logged later may not be in the checkpoint.
+	 */
+	if (conn->log != NULL)
+		__ckpt_lsn(session);
+
+	/*
+	 * The root addresses are written to the schema file: make sure it's
+	 * open, it must be checkpointed too.
+	 */
+	WT_ERR(__wt_schema_table_cursor(session, NULL, &cursor));
+	WT_ERR(cursor->close(cursor));
+
+	/*
+	 * Lock the open files.  Files with an exclusive lock are being bulk
+	 * loaded, salvaged or verified: skip them, they write their pages
+	 * when they close.  Closing a file waits for the checkpoint, because
+	 * it syncs the file first.
+	 */
+	__wt_spin_lock(session, &conn->spinlock);
+	TAILQ_FOREACH(btree, &conn->btqh, q) {
+		if (!F_ISSET(btree, WT_BTREE_OPEN) ||
+		    __wt_try_readlock(session, btree->rwlock) != 0)
+			continue;
+		if (!F_ISSET(btree, WT_BTREE_OPEN) ||
+		    F_ISSET(btree, WT_BTREE_BULK |
+		    WT_BTREE_SALVAGE | WT_BTREE_UPGRADE | WT_BTREE_VERIFY)) {
+			__wt_rwunlock(session, btree->rwlock);
+			continue;
+		}
+		if ((ret = __wt_realloc(session, &allocated,
+		    (nbtrees + 1) * sizeof(WT_BTREE *), &btrees)) != 0) {
+			__wt_rwunlock(session, btree->rwlock);
+			break;
+		}
+		btrees[nbtrees++] = btree;
+	}
+	__wt_spin_unlock(session, &conn->spinlock);
+	WT_ERR(ret);
+
+	/*
+	 * Checkpoint the files, the schema file last: the other files' root
+	 * addresses are written into it.
+	 */
+	conn->ckpt_running = 1;
+	for (i = 0; i < nbtrees; ++i) {
+		btree = btrees[i];
+		if (strcmp(btree->filename, WT_SCHEMA_FILENAME) == 0) {
+			schema_btree = btree;
+			continue;
+		}
+		if (!flush_cache)
+			continue;
+		session->btree = btree;
+		WT_ERR(__wt_btree_checkpoint(session, force));
+	}
+	if (schema_btree != NULL) {
+		session->btree = schema_btree;
+		WT_ERR(__wt_btree_checkpoint(session, force));
+	}
+
+	WT_ERR(__wt_epoch(session, &stop_secs, &stop_nsecs));
+	WT_CSTAT_INCR(session, checkpoint);
+	WT_CSTAT_INCRV(session, checkpoint_time,
+	    (uint64_t)((stop_secs - start_secs) * WT_MILLION +
+	    (stop_nsecs - start_nsecs) / 1000));
+
+	conn->ckpt_secs = start_secs;
+	conn->ckpt_nsecs = start_nsecs;
+
+	/*
+	 * Once the files have been written, log files preceding the LSN where
+	 * the checkpoint started aren't needed by recovery.  Files skipped
+	 * because they didn't change, and closed files, don't need older
+	 * records either.
+	 */
+	if (archive && flush_cache)
+		__wt_log_archive(session, conn->ckpt_lsn);
+
+	/*
+	 * Resolve the checkpoint in the files' block managers: if it failed,
+	 * the blocks freed before it started may still be referenced by the
+	 * last durable checkpoint.  Files whose pages weren't written, or whose
+	 * root didn't change, were never started or have been resolved.
+	 */
+err:	conn->ckpt_running = 0;
+	for (i = 0; i < nbtrees; ++i) {
+		btree = btrees[i];
+		session->btree = btree;
+		if (btree->block != NULL)
+			WT_TRET(__wt_bm_checkpoint_resolve(session, ret != 0));
+		__wt_rwunlock(session, btree->rwlock);
+	}
+	__wt_rwunlock(session, conn->ckpt_rwlock);
+
+	__wt_free(session, btrees);
+	session->btree = saved_btree;
+	return (ret);
+}
+
+/*
+ * __ckpt_lsn --
+ *	Set the LSN recovery replays each file's changes from.
+ *
+ * Reconciliation only writes updates older than the oldest running
+ * transaction, and a transaction's commit can be logged before its ID is
+ * cleared: the log end when the checkpoint starts can follow the commits of
+ * transactions whose updates aren't written.  Instead, use the log end from
+ * the newest checkpoint that started before the oldest running transaction
+ * was allocated its ID.  Checkpoints are single-threaded.
+ */
+static void
+__ckpt_lsn(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_TXN_GLOBAL *txn_global;
+	WT_LSN lsn;
+	uint64_t id, oldest;
+	u_int i, n;
+
+	conn = S2C(session);
+	txn_global = &conn->txn_global;
+
+	/*
+	 * Read the log end before the ID counter: transactions allocated IDs
+	 * after the counter is read log their commits after the log end.
+	 */
+	WT_ORDERED_READ(lsn, conn->log->write_lsn);
+	WT_ORDERED_READ(id, txn_global->current);
+	++id;
+	oldest = __wt_txn_oldest(session);
+
+	/*
+	 * The oldest running ID never goes backward: only the newest sample at
+	 * or before it can be needed by a later checkpoint, discard the rest.
+	 */
+	n = txn_global->ckpt_samples;
+	for (i = 0; i + 1 < n && txn_global->ckpt_sample[i + 1].id <= oldest;)
+		++i;
+	if (i > 0) {
+		memmove(txn_global->ckpt_sample, txn_global->ckpt_sample + i,
+		    (n - i) * sizeof(txn_global->ckpt_sample[0]));
+		n -= i;
+	}
+
+	if (oldest >= id)
+		conn->ckpt_lsn = lsn;
+	else if (n > 0 && txn_global->ckpt_sample[0].id <= oldest)
+		conn->ckpt_lsn = txn_global->ckpt_sample[0].lsn;
+	else
+		conn->ckpt_lsn = 0;
+
+	/*
+	 * Add this checkpoint's sample.  If the table is full, discard the
+	 * sample after the first: later checkpoints replay more of the log
+	 * until the oldest transaction resolves, but never too little.
+	 */
+	if (n == WT_TXN_CKPT_SAMPLES) {
+		memmove(txn_global->ckpt_sample + 1,
+		    txn_global->ckpt_sample + 2,
+		    (n - 2) * sizeof(txn_global->ckpt_sample[0]));
+		--n;
+	}
+	txn_global->ckpt_sample[n].id = id;
+	txn_global->ckpt_sample[n].lsn = lsn;
+	txn_global->ckpt_samples = n + 1;
+}
+
+/*
+ * __ckpt_skip --
+ *	Return if a checkpoint isn't needed yet.
+ */
+static int
+__ckpt_skip(WT_SESSION_IMPL *session, const char *cfg[], int *skipp)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	time_t secs;
+	long nsecs;
+	uint64_t elapsed;
+
+	conn = S2C(session);
+	*skipp = 0;
+
+	/* The first checkpoint always runs. */
+	if (conn->ckpt_secs == 0)
+		return (0);
+
+	WT_RET(__wt_config_gets(session, cfg, "timeout", &cval));
+	if (cval.val != 0) {
+		WT_RET(__wt_epoch(session, &secs, &nsecs));
+		elapsed = (uint64_t)((secs - conn->ckpt_secs) * 1000 +
+		    (nsecs - conn->ckpt_nsecs) / WT_MILLION);
+		if (elapsed <= (uint64_t)cval.val) {
+			*skipp = 1;
+			return (0);
+		}
+	}
+
+	WT_RET(__wt_config_gets(session, cfg, "log_size", &cval));
+	if (cval.val != 0 && conn->log != NULL &&
+	    __wt_log_bytes(session,
+	    conn->ckpt_lsn, conn->log->write_lsn) <= (uint64_t)cval.val)
+		*skipp = 1;
+	return (0);
+}
+
+/*
+ * __wt_checkpoint_stall --
+ *	Record how long an application thread waited for a page while a
+ * checkpoint was running.
+ */
+void
+__wt_checkpoint_stall(WT_SESSION_IMPL *session, uint64_t usecs)
+{
+	WT_CONNECTION_IMPL *conn;
+	uint64_t old;
+
+	conn = S2C(session);
+
+	while ((old = conn->ckpt_stall_max) < usecs &&
+	    !WT_ATOMIC_CAS(conn->ckpt_stall_max, old, usecs))
+		;
+}
@@ -0,0 +1,513 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+struct __wt_recovery;
+    typedef struct __wt_recovery WT_RECOVERY;
+struct __wt_recovery_file;
+    typedef struct __wt_recovery_file WT_RECOVERY_FILE;
+
+/*
+ * Recovery reads the log once, copying each file's records into a buffer for
+ * the file, then threads replay the buffered records, each thread replaying
+ * one file at a time.  Records for different files are independent, records
+ * for the same file are replayed in log order.  The log is read in batches
+ * to bound the memory used.
+ */
+#define	WT_RECOVERY_BATCH	(64 * WT_MEGABYTE)
+
+struct __wt_recovery_file {
+	const char *uri;		/* File URI */
+	WT_LSN	    ckpt_lsn;		/* Replay records from here */
+	WT_ITEM	    recs;		/* Buffered records */
+	uint64_t    nrecs;		/* Buffered record count */
+};
+
+struct __wt_recovery {
+	WT_CONNECTION_IMPL *conn;
+
+	WT_RECOVERY_FILE *files;	/* Files, indexed by ID */
+	u_int	 nfiles;
+
+	size_t	 batch_bytes;		/* Bytes buffered */
+	WT_LSN	 batch_end;		/* End of the batch */
+	volatile u_int next;		/* Next file to replay */
+	u_int	 nthreads;		/* Replay threads */
+
+	uint64_t scanned;		/* Records read */
+	uint64_t applied;		/* Records replayed */
+
+	volatile int error;		/* Replay failed */
+};
+
+static int   __recover_batch(WT_SESSION_IMPL *, WT_RECOVERY *);
+static int   __recover_file(WT_SESSION_IMPL *, WT_RECOVERY_FILE *);
+static int   __recover_files(WT_SESSION_IMPL *, WT_RECOVERY *);
+static int   __recover_op(
+		WT_SESSION_IMPL *, WT_RECOVERY *, WT_LSN, WT_LOG_RECORD *);
+static int   __recover_record(
+		WT_SESSION_IMPL *, WT_LSN, WT_LOG_RECORD *, void *);
+static void *__recover_thread(void *);
+
+/*
+ * __wt_recover --
+ *	Replay the log when the database is opened.
+ */
+int
+__wt_recover(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_RECOVERY *r, _r;
+	WT_SESSION_IMPL *session;
+	WT_LSN end, start;
+	time_t start_secs, stop_secs;
+	long start_nsecs, stop_nsecs;
+	uint64_t usecs;
+	u_int i;
+	int found, ret;
+
+	r = &_r;
+	WT_CLEAR(*r);
+	r->conn = conn;
+	ret = 0;
+
+	WT_RET(__wt_open_session(conn, 1, NULL, NULL, &session));
+
+	/*
+	 * Find the files and their IDs.  This is done even if logging isn't
+	 * configured: new files are given the next ID.
+	 */
+	WT_ERR(__recover_files(session, r));
+	if (conn->log == NULL)
+		goto err;
+
+	WT_ERR(__wt_config_gets(session, cfg, "recovery_threads", &cval));
+	r->nthreads = (u_int)cval.val;
+	WT_ERR(__wt_epoch(session, &start_secs, &start_nsecs));
+
+	/*
+	 * Records before the earliest file checkpoint don't need replay.  The
+	 * scan must start at a record to find the end of the last complete
+	 * record: if there are no files, or a file was never checkpointed,
+	 * read the whole log.
+	 */
+	found = 0;
+	start = WT_LSN_MAKE(conn->log->first_file, 0);
+	for (i = 0; i < r->nfiles; ++i)
+		if (r->files[i].uri != NULL &&
+		    (!found || r->files[i].ckpt_lsn < start)) {
+			found = 1;
+			start = r->files[i].ckpt_lsn;
+		}
+	if (start > conn->log->write_lsn)
+		start = WT_LSN_MAKE(conn->log->first_file, 0);
+
+	/*
+	 * Read the log in batches: the scan stops when a batch is full, then
+	 * the batch is replayed and the scan restarts from the batch's end.
+	 */
+	for (;;) {
+		ret = __wt_log_scan(session, start, __recover_record, r, &end);
+		if (ret != 0 && ret != WT_RESTART)
+			goto err;
+		if (ret == WT_RESTART)
+			end = r->batch_end;
+		WT_ERR(__recover_batch(session, r));
+		if (ret == 0)
+			break;
+		start = end;
+	}
+
+	/* New records are written following the last complete record. */
+	WT_ERR(__wt_log_truncate(session, end));
+
+	WT_ERR(__wt_epoch(session, &stop_secs, &stop_nsecs));
+	usecs = (uint64_t)((stop_secs - start_secs) * WT_MILLION +
+	    (stop_nsecs - start_nsecs) / 1000);
+	WT_CSTAT_INCRV(session, recovery_scanned, r->scanned);
+	WT_CSTAT_INCRV(session, recovery_applied, r->applied);
+	WT_CSTAT_INCRV(session, recovery_time, usecs);
+	WT_STAT_SET(conn->stats, recovery_rate,
+	    usecs == 0 ? r->applied : r->applied * WT_MILLION / usecs);
+	WT_VERBOSE(session, recovery,
+	    "replayed %" PRIu64 " of %" PRIu64 " records in %" PRIu64 "ms",
+	    r->applied, r->scanned, usecs / 1000);
+
+err:	if (r->files != NULL) {
+		for (i = 0; i < r->nfiles; ++i) {
+			__wt_free(session, r->files[i].uri);
+			__wt_buf_free(session, &r->files[i].recs);
+		}
+		__wt_free(session, r->files);
+	}
+	if (ret != 0)
+		__wt_err(session, ret, "recovery failed");
+	WT_TRET(session->iface.close(&session->iface, NULL));
+	return (ret);
+}
+
+/*
+ * __recover_files --
+ *	Read the files' IDs and checkpoint LSNs from the schema file.
+ */
+static int
+__recover_files(WT_SESSION_IMPL *session, WT_RECOVERY *r)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CURSOR *cursor;
+	WT_RECOVERY_FILE *f;
+	size_t allocated;
+	uint32_t id;
+	int ret;
+	const char *key, *value;
+
+	cursor = NULL;
+	allocated = 0;
+
+	WT_RET(__wt_schema_table_cursor(session, NULL, &cursor));
+	while ((ret = cursor->next(cursor)) == 0) {
+		WT_ERR(cursor->get_key(cursor, &key));
+		if (!WT_PREFIX_MATCH(key, "file:"))
+			continue;
+		WT_ERR(cursor->get_value(cursor, &value));
+
+		/* Files created before IDs were assigned aren't logged. */
+		if ((ret = __wt_config_getones(
+		    session, value, "id", &cval)) == WT_NOTFOUND)
+			continue;
+		WT_ERR(ret);
+		if ((id = (uint32_t)cval.val) == 0)
+			continue;
+
+		if (id >= r->nfiles) {
+			WT_ERR(__wt_realloc(session, &allocated,
+			    (id + 1) * sizeof(WT_RECOVERY_FILE), &r->files));
+			r->nfiles = id + 1;
+		}
+		f = &r->files[id];
+		WT_ERR(__wt_strdup(session, key, &f->uri));
+		if ((ret = __wt_config_getones(
+		    session, value, "checkpoint_lsn", &cval)) == 0)
+			f->ckpt_lsn = (WT_LSN)cval.val;
+		else if (ret != WT_NOTFOUND)
+			goto err;
+
+		if (id > r->conn->next_file_id)
+			r->conn->next_file_id = id;
+	}
+	if (ret == WT_NOTFOUND)
+		ret = 0;
+
+err:	if (cursor != NULL)
+		WT_TRET(cursor->close(cursor));
+	return (ret);
+}
+
+/*
+ * __recover_record --
+ *	Buffer a log record's file operations.
+ */
+static int
+__recover_record(
+    WT_SESSION_IMPL *session, WT_LSN lsn, WT_LOG_RECORD *logrec, void *cookie)
+{
+	WT_ITEM ops;
+	WT_RECOVERY *r;
+	uint64_t txnid;
+	uint8_t *end, *p;
+	int commit;
+
+	r = cookie;
+	++r->scanned;
+
+	/*
+	 * Only file operations are replayed: those logged outside of a
+	 * transaction, and committed transactions' operations, which are
+	 * packed in the commit record.
+	 */
+	if (logrec->rectype == 0 || logrec->rectype > WT_LOGREC_MAX)
+		WT_RET_MSG(session, WT_ERROR,
+		    "unknown log record type %" PRIu32,
+		    (uint32_t)logrec->rectype);
+	commit = logrec->rectype == __wt_logdesc_commit.type;
+	if (!commit && __wt_logdesc_table[logrec->rectype]->apply == NULL)
+		return (0);
+
+	/*
+	 * If the batch is full, stop the scan, the batch is replayed.  A
+	 * transaction's operations are buffered in the same batch.
+	 */
+	if (r->batch_bytes + logrec->len > WT_RECOVERY_BATCH &&
+	    r->batch_bytes != 0) {
+		r->batch_end = lsn;
+		return (WT_RESTART);
+	}
+
+	if (!commit)
+		return (__recover_op(session, r, lsn, logrec));
+
+	WT_RET(__wt_struct_unpack(session, WT_LOG_RECORD_DATA(logrec),
+	    logrec->len - sizeof(WT_LOG_RECORD),
+	    __wt_logdesc_commit.fmt, &txnid, &ops));
+	for (p = (uint8_t *)ops.data, end = p + ops.size;
+	    p < end; p += ((WT_LOG_RECORD *)p)->len)
+		WT_RET(__recover_op(session, r, lsn, (WT_LOG_RECORD *)p));
+	return (0);
+}
+
+/*
+ * __recover_op --
+ *	Buffer a file operation for its file.
+ */
+static int
+__recover_op(WT_SESSION_IMPL *session,
+    WT_RECOVERY *r, WT_LSN lsn, WT_LOG_RECORD *logrec)
+{
+	WT_RECOVERY_FILE *f;
+	WT_ITEM *recs;
+	uint32_t id;
+
+	if (logrec->len < sizeof(WT_LOG_RECORD) ||
+	    logrec->rectype == 0 || logrec->rectype > WT_LOGREC_MAX ||
+	    __wt_logdesc_table[logrec->rectype]->apply == NULL)
+		WT_RET_MSG(session, WT_ERROR,
+		    "log record type %" PRIu32 " isn't a file operation",
+		    (uint32_t)logrec->rectype);
+
+	/*
+	 * Skip records for files that no longer exist, and records the file's
+	 * last checkpoint includes.
+	 */
+	WT_RET(__wt_struct_unpack(session, WT_LOG_RECORD_DATA(logrec),
+	    logrec->len - sizeof(WT_LOG_RECORD), "I", &id));
+	if (id >= r->nfiles || (f = &r->files[id])->uri == NULL ||
+	    lsn < f->ckpt_lsn)
+		return (0);
+
+	recs = &f->recs;
+	WT_RET(__wt_buf_grow(session, recs, recs->size + logrec->len));
+	memcpy((uint8_t *)recs->mem + recs->size, logrec, logrec->len);
+	recs->size += logrec->len;
+	++f->nrecs;
+	r->batch_bytes += logrec->len;
+	return (0);
+}
+
+/*
+ * __recover_batch --
+ *	Replay the buffered records.
+ */
+static int
+__recover_batch(WT_SESSION_IMPL *session, WT_RECOVERY *r)
+{
+	pthread_t *tids;
+	u_int i, nthreads;
+	int ret;
+
+	tids = NULL;
+	ret = 0;
+
+	if (r->batch_bytes == 0)
+		return (0);
+
+	/* Each thread replays one file at a time. */
+	r->next = 0;
+	nthreads = r->nthreads;
+	WT_RET(__wt_calloc_def(session, nthreads, &tids));
+	for (i = 0; i < nthreads; ++i)
+		if ((ret = __wt_thread_create(
+		    &tids[i], __recover_thread, r)) != 0)
+			break;
+	nthreads = i;
+	for (i = 0; i < nthreads; ++i)
+		WT_TRET(__wt_thread_join(tids[i]));
+	__wt_free(session, tids);
+	WT_RET(ret);
+	if (r->error != 0)
+		return (r->error);
+
+	for (i = 0; i < r->nfiles; ++i) {
+		r->applied += r->files[i].nrecs;
+		r->files[i].nrecs = 0;
+		r->files[i].recs.size = 0;
+	}
+	r->batch_bytes = 0;
+	return (0);
+}
+
+/*
+ * __recover_thread --
+ *	Thread replaying files' buffered records.
+ */
+static void *
+__recover_thread(void *arg)
+{
+	WT_RECOVERY *r;
+	WT_RECOVERY_FILE *f;
+	WT_SESSION_IMPL *session;
+	u_int i;
+	int ret;
+
+	r = arg;
+	session = NULL;
+	ret = 0;
+
+	WT_ERR(__wt_open_session(r->conn, 1, NULL, NULL, &session));
+	F_SET(session, WT_SESSION_NO_LOGGING);
+	while (r->error == 0 &&
+	    (i = WT_ATOMIC_ADD(r->next, 1) - 1) < r->nfiles) {
+		f = &r->files[i];
+		if (f->nrecs != 0)
+			WT_ERR(__recover_file(session, f));
+	}
+
+err:	if (ret != 0) {
+		r->error = ret;
+		__wt_err(session != NULL ?
+		    session : &r->conn->default_session, ret,
+		    "recovery thread error");
+	}
+	if (session != NULL)
+		(void)session->iface.close(&session->iface, NULL);
+	return (NULL);
+}
+
+/*
+ * __recover_file --
+ *	Replay a file's buffered records.
+ */
+static int
+__recover_file(WT_SESSION_IMPL *session, WT_RECOVERY_FILE *f)
+{
+	WT_CURSOR *cursor;
+	WT_LOG_RECORD *logrec;
+	uint8_t *end, *p;
+	int ret;
+	const char *cfg[] =
+	    { __wt_confdfl_session_open_cursor, "overwrite", NULL };
+
+	/*
+	 * The file may have been dropped without removing its entry.  The
+	 * checkpoint may include some of the replayed changes: puts overwrite
+	 * existing records.
+	 */
+	if ((ret = __wt_curfile_open(
+	    session, f->uri, cfg, &cursor)) == WT_NOTFOUND)
+		return (0);
+	WT_RET(ret);
+
+	end = (uint8_t *)f->recs.mem + f->recs.size;
+	for (p = f->recs.mem; p < end; p += logrec->len) {
+		logrec = (WT_LOG_RECORD *)p;
+		WT_ERR(__wt_logdesc_table[logrec->rectype]->apply(
+		    session, cursor, logrec));
+	}
+
+err:	WT_TRET(cursor->close(cursor));
+	return (ret);
+}
+
+/*
+ * __recover_apply --
+ *	Replay a change with a file cursor.
+ */
+static int
+__recover_apply(WT_CURSOR *cursor,
+    WT_ITEM *key, uint64_t recno, WT_ITEM *value, int remove)
+{
+	WT_CURSOR_BTREE *cbt;
+	int ret;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+
+	/* Keys and values are logged in the cursor's packed format. */
+	if (key != NULL) {
+		cursor->key.data = key->data;
+		cursor->key.size = key->size;
+	} else
+		cursor->recno = recno;
+	if (value != NULL) {
+		cursor->value.data = value->data;
+		cursor->value.size = value->size;
+	}
+
+	/* A removed record may not have been in the checkpoint. */
+	if (!remove)
+		return (__wt_btcur_insert(cbt));
+	ret = __wt_btcur_remove(cbt);
+	return (ret == WT_NOTFOUND ? 0 : ret);
+}
+
+/*
+ * __wt_logapply_row_put --
+ *	Replay a row-store put.
+ */
+int
+__wt_logapply_row_put(
+    WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_LOG_RECORD *logrec)
+{
+	WT_ITEM key, value;
+	uint32_t fileid;
+
+	WT_RET(__wt_struct_unpack(session, WT_LOG_RECORD_DATA(logrec),
+	    logrec->len - sizeof(WT_LOG_RECORD),
+	    __wt_logdesc_row_put.fmt, &fileid, &key, &value));
+	return (__recover_apply(cursor, &key, 0, &value, 0));
+}
+
+/*
+ * __wt_logapply_row_remove --
+ *	Replay a row-store remove.
+ */
+int
+__wt_logapply_row_remove(
+    WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_LOG_RECORD *logrec)
+{
+	WT_ITEM key;
+	uint32_t fileid;
+
+	WT_RET(__wt_struct_unpack(session, WT_LOG_RECORD_DATA(logrec),
+	    logrec->len - sizeof(WT_LOG_RECORD),
+	    __wt_logdesc_row_remove.fmt, &fileid, &key));
+	return (__recover_apply(cursor, &key, 0, NULL, 1));
+}
+
+/*
+ * __wt_logapply_col_put --
+ *	Replay a column-store put.
+ */
+int
+__wt_logapply_col_put(
+    WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_LOG_RECORD *logrec)
+{
+	WT_ITEM value;
+	uint64_t recno;
+	uint32_t fileid;
+
+	WT_RET(__wt_struct_unpack(session, WT_LOG_RECORD_DATA(logrec),
+	    logrec->len - sizeof(WT_LOG_RECORD),
+	    __wt_logdesc_col_put.fmt, &fileid, &recno, &value));
+	return (__recover_apply(cursor, NULL, recno, &value, 0));
+}
+
+/*
+ * __wt_logapply_col_remove --
+ *	Replay a column-store remove.
+ */
+int
+__wt_logapply_col_remove(
+    WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_LOG_RECORD *logrec)
+{
+	uint64_t recno;
+	uint32_t fileid;
+
+	WT_RET(__wt_struct_unpack(session, WT_LOG_RECORD_DATA(logrec),
+	    logrec->len - sizeof(WT_LOG_RECORD),
+	    __wt_logdesc_col_remove.fmt, &fileid, &recno));
+	return (__recover_apply(cursor, NULL, recno, NULL, 1));
+}
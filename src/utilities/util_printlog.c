@@ -7,13 +7,17 @@
 
 #include "util.h"
 
-static int usage(void);
+static int  print_fields(WT_SESSION_IMPL *, WT_LOG_RECORD *, int);
+static void print_item(const uint8_t *, uint32_t, int);
+static int  print_record(WT_SESSION_IMPL *, WT_LSN, WT_LOG_RECORD *, void *);
+static int  usage(void);
 
 int
 util_printlog(WT_SESSION *session, int argc, char *argv[])
 {
-	WT_CURSOR *cursor;
-	WT_ITEM key, value;
+	WT_LOG *log;
+	WT_LSN end;
+	WT_SESSION_IMPL *session_impl;
 	int ch, printable, ret;
 
 	printable = 0;
@@ -40,38 +44,130 @@ util_printlog(WT_SESSION *session, int argc, char *argv[])
 	if (argc != 0)
 		return (usage());
 
-	if ((ret = session->open_cursor(session, "log",
-	    NULL, printable ? "printable" : "raw", &cursor)) != 0) {
-		fprintf(stderr, "%s: cursor open(log) failed: %s\n",
+	/* The log is only read if the database is opened with logging. */
+	session_impl = (WT_SESSION_IMPL *)session;
+	if ((log = S2C(session_impl)->log) == NULL) {
+		fprintf(stderr, "%s: printlog: logging is not configured, "
+		    "open the database with \"-C logging\"\n", progname);
+		return (1);
+	}
+
+	/*
+	 * Logs are large: write the output in large chunks, and lock the
+	 * stream once rather than for every character.
+	 */
+	(void)setvbuf(stdout, NULL, _IOFBF, 1024 * 1024);
+	flockfile(stdout);
+	ret = __wt_log_scan(session_impl,
+	    WT_LSN_MAKE(log->first_file, 0), print_record, &printable, &end);
+	if (ret == 0 && fflush(stdout) != 0)
+		ret = errno;
+	funlockfile(stdout);
+
+	if (ret != 0) {
+		fprintf(stderr, "%s: printlog failed: %s\n",
 		    progname, wiredtiger_strerror(ret));
-		goto err;
+		return (1);
 	}
+	return (0);
+}
+
+/*
+ * print_record --
+ *	Print a log record: its LSN, type and fields, one record per line.
+ */
+static int
+print_record(WT_SESSION_IMPL *session,
+    WT_LSN lsn, WT_LOG_RECORD *logrec, void *cookie)
+{
+	(void)printf("[%" PRIu32 ",%" PRIu32 "] ",
+	    WT_LSN_FILE(lsn), WT_LSN_OFFSET(lsn));
+	WT_RET(print_fields(session, logrec, *(int *)cookie));
+	if (putc_unlocked('\n', stdout) == EOF)
+		return (errno);
+	return (0);
+}
+
+/*
+ * print_fields --
+ *	Print a record's type and fields.  A commit record's operations are
+ * printed on the following lines, indented.
+ */
+static int
+print_fields(WT_SESSION_IMPL *session, WT_LOG_RECORD *logrec, int printable)
+{
+	WT_LOGREC_DESC *desc;
+	WT_LOG_RECORD *op;
+	WT_PACK pack;
+	WT_PACK_VALUE pv;
+	const char **field;
+	const uint8_t *end, *op_end, *op_p, *p;
+	int ret;
 
-	while ((ret = cursor->next(cursor)) == 0) {
-		if ((ret = cursor->get_key(cursor, &key)) != 0)
+	if (logrec->rectype == 0 || logrec->rectype > WT_LOGREC_MAX) {
+		(void)printf("unknown record type %" PRIu32,
+		    (uint32_t)logrec->rectype);
+		return (0);
+	}
+	desc = __wt_logdesc_table[logrec->rectype];
+	(void)printf("%s", desc->name);
+
+	p = WT_LOG_RECORD_DATA(logrec);
+	end = (uint8_t *)logrec + logrec->len;
+	WT_RET(__pack_init(session, &pack, desc->fmt));
+	for (field = desc->fields;
+	    (ret = __pack_next(&pack, &pv)) == 0; ++field) {
+		WT_RET(__unpack_read(session, &pv, &p, (size_t)(end - p)));
+		(void)printf(" %s=", *field);
+		switch (pv.type) {
+		case 'S':
+			(void)printf("%s", pv.u.s);
 			break;
-		if ((ret = cursor->get_value(cursor, &value)) != 0)
+		case 'I':
+		case 'Q':
+			(void)printf("%" PRIu64, pv.u.u);
 			break;
-		if (fwrite(key.data, 1, key.size, stdout) != key.size ||
-		    fwrite("\n", 1, 1, stdout) != 1 ||
-		    fwrite(value.data, 1, value.size, stdout) != value.size ||
-		    fwrite("\n", 1, 1, stdout) != 1) {
-			ret = errno;
+		case 'U':
+		case 'u':
+			if (desc != &__wt_logdesc_commit) {
+				print_item(
+				    pv.u.item.data, pv.u.item.size, printable);
+				break;
+			}
+			(void)printf("%" PRIu32, pv.u.item.size);
+			for (op_p = pv.u.item.data,
+			    op_end = op_p + pv.u.item.size;
+			    op_p < op_end; op_p += op->len) {
+				op = (WT_LOG_RECORD *)op_p;
+				(void)printf("\n\t");
+				WT_RET(print_fields(session, op, printable));
+			}
 			break;
+		WT_ILLEGAL_VALUE(session);
 		}
 	}
-	if (ret == WT_NOTFOUND)
-		ret = 0;
-	else {
-		fprintf(stderr, "%s: cursor get(log) failed: %s\n",
-		    progname, wiredtiger_strerror(ret));
-		goto err;
-	}
+	return (ret == WT_NOTFOUND ? 0 : ret);
+}
 
-	if (0) {
-err:		ret = 1;
-	}
-	return (ret);
+/*
+ * print_item --
+ *	Print a key or value, as hex pairs or, if printable, with only the
+ * non-printable bytes escaped.
+ */
+static void
+print_item(const uint8_t *p, uint32_t size, int printable)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	for (; size > 0; --size, ++p)
+		if (printable && isprint(*p) && *p != '\\')
+			(void)putc_unlocked(*p, stdout);
+		else {
+			if (printable)
+				(void)putc_unlocked('\\', stdout);
+			(void)putc_unlocked(hex[(*p & 0xf0) >> 4], stdout);
+			(void)putc_unlocked(hex[*p & 0x0f], stdout);
+		}
 }
 
 static int
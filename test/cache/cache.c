@@ -0,0 +1,278 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include <sys/types.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <wiredtiger.h>
+
+#define	FNAME	"file:__cache"			/* File name */
+
+#if defined (__GNUC__)
+void die(const char *, int) __attribute__((noreturn));
+#else
+void die(const char *, int);
+#endif
+void     load(void);
+uint64_t lookup(WT_CURSOR *, WT_CURSOR *);
+void     run(const char *);
+void     scan(WT_CURSOR *);
+int      usage(void);
+
+u_int	 cache_mb;				/* Cache size in MB */
+u_int	 hot;					/* Hot set keys */
+u_int	 nkeys;					/* Keys to load */
+u_int	 nops;					/* Lookups per round */
+u_int	 rounds;				/* Rounds of lookups/scans */
+
+const char *progname;				/* Program name */
+
+int
+main(int argc, char *argv[])
+{
+	int ch;
+
+	if ((progname = strrchr(argv[0], '/')) == NULL)
+		progname = argv[0];
+	else
+		++progname;
+
+	cache_mb = 2;
+	hot = 200;
+	nkeys = 200000;
+	nops = 20000;
+	rounds = 5;
+
+	while ((ch = getopt(argc, argv, "c:h:k:n:r:")) != EOF)
+		switch (ch) {
+		case 'c':			/* cache size */
+			cache_mb = (u_int)atoi(optarg);
+			break;
+		case 'h':			/* hot set */
+			hot = (u_int)atoi(optarg);
+			break;
+		case 'k':			/* rows */
+			nkeys = (u_int)atoi(optarg);
+			break;
+		case 'n':			/* lookups */
+			nops = (u_int)atoi(optarg);
+			break;
+		case 'r':			/* rounds */
+			rounds = (u_int)atoi(optarg);
+			break;
+		case '?':
+		default:
+			return (usage());
+		}
+	argc -= optind;
+	argv += optind;
+	if (argc != 0 || cache_mb == 0 ||
+	    hot == 0 || hot > nkeys || nops == 0 || rounds == 0)
+		return (usage());
+
+	/*
+	 * Load the file once, then replay the same workload against each of
+	 * the replacement policies.
+	 */
+	load();
+
+	printf("%u keys, %u hot keys, %uMB cache, %u rounds of %u lookups "
+	    "and a scan\n", nkeys, hot, cache_mb, rounds, nops);
+	run("lru");
+	run("2q");
+	run("clockpro");
+
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * load --
+ *	Create and populate the file.
+ */
+void
+load(void)
+{
+	WT_CONNECTION *conn;
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	u_int keyno;
+	int ret;
+	char config[64], keybuf[64], valuebuf[64];
+
+	(void)system("rm -f WiredTiger WiredTiger.* __cache*");
+
+	(void)snprintf(config, sizeof(config), "create,cache_size=%uMB",
+	    cache_mb > 10 ? cache_mb : 10);
+	if ((ret = wiredtiger_open(NULL, NULL, config, &conn)) != 0)
+		die("wiredtiger_open", ret);
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.open_session", ret);
+	if ((ret = session->create(session, FNAME,
+	    "key_format=S,value_format=S,"
+	    "internal_page_max=4KB,leaf_page_max=4KB")) != 0)
+		die("session.create", ret);
+	if ((ret = session->open_cursor(
+	    session, FNAME, NULL, "bulk", &cursor)) != 0)
+		die("session.open_cursor", ret);
+
+	for (keyno = 0; keyno < nkeys; ++keyno) {
+		(void)snprintf(keybuf, sizeof(keybuf), "%010u", keyno);
+		(void)snprintf(valuebuf, sizeof(valuebuf), "%037u", keyno);
+		cursor->set_key(cursor, keybuf);
+		cursor->set_value(cursor, valuebuf);
+		if ((ret = cursor->insert(cursor)) != 0)
+			die("cursor.insert", ret);
+	}
+
+	if ((ret = conn->close(conn, NULL)) != 0)
+		die("conn.close", ret);
+}
+
+/*
+ * run --
+ *	Replay the workload with a replacement policy, reporting the hit ratio
+ * of the point lookups.
+ */
+void
+run(const char *policy)
+{
+	WT_CONNECTION *conn;
+	WT_CURSOR *cursor, *stat;
+	WT_SESSION *session;
+	uint64_t reads;
+	u_int i;
+	int ret;
+	char config[128];
+
+	/* Re-open the connection so every policy starts with a cold cache. */
+	(void)snprintf(config, sizeof(config),
+	    "cache_size=%uMB,eviction_policy=%s", cache_mb, policy);
+	if ((ret = wiredtiger_open(NULL, NULL, config, &conn)) != 0)
+		die("wiredtiger_open", ret);
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.open_session", ret);
+	if ((ret = session->open_cursor(
+	    session, FNAME, NULL, NULL, &cursor)) != 0)
+		die("session.open_cursor", ret);
+	if ((ret = session->open_cursor(
+	    session, "statistics:", NULL, NULL, &stat)) != 0)
+		die("session.open_cursor", ret);
+
+	/*
+	 * Each round is a set of point lookups followed by a full scan: the
+	 * first round warms the cache, report the later rounds.
+	 */
+	srand(1);
+	for (reads = 0, i = 0; i < rounds; ++i) {
+		if (i == 0)
+			(void)lookup(cursor, stat);
+		else
+			reads += lookup(cursor, stat);
+		scan(cursor);
+	}
+
+	if (rounds > 1)
+		printf("%10s: %" PRIu64 " pages read, %.2lf%% hit ratio\n",
+		    policy, reads, 100.0 *
+		    (1.0 - (double)reads / ((double)(rounds - 1) * nops)));
+
+	if ((ret = conn->close(conn, NULL)) != 0)
+		die("conn.close", ret);
+}
+
+/*
+ * lookup --
+ *	Do a round of point lookups, returning the number of blocks read.
+ */
+uint64_t
+lookup(WT_CURSOR *cursor, WT_CURSOR *stat)
+{
+	uint64_t start, v;
+	u_int i, keyno;
+	int ret;
+	const char *desc, *pval;
+	char keybuf[64];
+
+	stat->set_key(stat, WT_STAT_block_read);
+	if ((ret = stat->search(stat)) != 0 ||
+	    (ret = stat->get_value(stat, &desc, &pval, &start)) != 0)
+		die("statistics cursor", ret);
+
+	/*
+	 * Most lookups are in the hot set, the rest are uniform.  The hot keys
+	 * are spread across the file so each is likely on a different page.
+	 */
+	for (i = 0; i < nops; ++i) {
+		keyno = (u_int)rand() % 100 == 0 ?
+		    (u_int)rand() % nkeys : ((u_int)rand() % hot) * (nkeys / hot);
+		(void)snprintf(keybuf, sizeof(keybuf), "%010u", keyno);
+		cursor->set_key(cursor, keybuf);
+		if ((ret = cursor->search(cursor)) != 0)
+			die("cursor.search", ret);
+	}
+	if ((ret = cursor->reset(cursor)) != 0)
+		die("cursor.reset", ret);
+
+	stat->set_key(stat, WT_STAT_block_read);
+	if ((ret = stat->search(stat)) != 0 ||
+	    (ret = stat->get_value(stat, &desc, &pval, &v)) != 0)
+		die("statistics cursor", ret);
+	return (v - start);
+}
+
+/*
+ * scan --
+ *	Read the file from beginning to end.
+ */
+void
+scan(WT_CURSOR *cursor)
+{
+	int ret;
+
+	while ((ret = cursor->next(cursor)) == 0)
+		;
+	if (ret != WT_NOTFOUND)
+		die("cursor.next", ret);
+	if ((ret = cursor->reset(cursor)) != 0)
+		die("cursor.reset", ret);
+}
+
+/*
+ * die --
+ *	Report an error and quit.
+ */
+void
+die(const char *m, int e)
+{
+	fprintf(stderr, "%s: %s: %s\n", progname, m, wiredtiger_strerror(e));
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * usage --
+ *	Display usage statement and exit failure.
+ */
+int
+usage(void)
+{
+	fprintf(stderr,
+	    "usage: %s [-c cache-MB] [-h hot-keys] [-k keys] [-n lookups] "
+	    "[-r rounds]\n", progname);
+	fprintf(stderr, "%s",
+	    "\t-c cache size in MB\n"
+	    "\t-h number of keys in the hot set\n"
+	    "\t-k number of keys to load\n"
+	    "\t-n number of lookups per round\n"
+	    "\t-r number of rounds\n");
+	return (EXIT_FAILURE);
+}
@@ -0,0 +1,221 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include <sys/types.h>
+#include <sys/time.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <wiredtiger.h>
+
+#define	FNAME	"file:__handle.%u"		/* File name format */
+
+#if defined (__GNUC__)
+void die(const char *, int) __attribute__((noreturn));
+#else
+void die(const char *, int);
+#endif
+void  load(void);
+void *opener(void *);
+void  run(const char *, int);
+int   usage(void);
+
+WT_CONNECTION *conn;				/* WiredTiger connection */
+int	 cache_cursors;				/* Cache cursors */
+u_int	 nfiles;				/* Files to create */
+u_int	 nops;					/* Opens per thread */
+u_int	 nthreads;				/* Threads */
+
+const char *progname;				/* Program name */
+
+int
+main(int argc, char *argv[])
+{
+	int ch, ret;
+
+	if ((progname = strrchr(argv[0], '/')) == NULL)
+		progname = argv[0];
+	else
+		++progname;
+
+	cache_cursors = 0;
+	nfiles = 10000;
+	nops = 100000;
+	nthreads = 1;
+
+	while ((ch = getopt(argc, argv, "cf:n:t:")) != EOF)
+		switch (ch) {
+		case 'c':			/* cache cursors */
+			cache_cursors = 1;
+			break;
+		case 'f':			/* files */
+			nfiles = (u_int)atoi(optarg);
+			break;
+		case 'n':			/* opens */
+			nops = (u_int)atoi(optarg);
+			break;
+		case 't':			/* threads */
+			nthreads = (u_int)atoi(optarg);
+			break;
+		case '?':
+		default:
+			return (usage());
+		}
+	argc -= optind;
+	argv += optind;
+	if (argc != 0 || nfiles == 0 || nops == 0 || nthreads == 0)
+		return (usage());
+
+	load();
+
+	printf("%u files, %u threads, %u cursor open/close calls per thread"
+	    "%s\n", nfiles, nthreads, nops,
+	    cache_cursors ? ", cached cursors" : "");
+
+	/*
+	 * In a new session, opening a file finds the handle in the connection's
+	 * cache, re-opening it finds the handle in the session's cache.
+	 */
+	run("first open", 1);
+	run("re-open", 0);
+
+	if ((ret = conn->close(conn, NULL)) != 0)
+		die("conn.close", ret);
+
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * load --
+ *	Create the files.
+ */
+void
+load(void)
+{
+	WT_SESSION *session;
+	u_int i;
+	int ret;
+	char name[64];
+
+	(void)system("rm -f WiredTiger WiredTiger.* __handle*");
+
+	if ((ret = wiredtiger_open(NULL, NULL, "create", &conn)) != 0)
+		die("wiredtiger_open", ret);
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.open_session", ret);
+	for (i = 0; i < nfiles; ++i) {
+		(void)snprintf(name, sizeof(name), FNAME, i);
+		if ((ret = session->create(session, name,
+		    "key_format=S,value_format=S")) != 0)
+			die("session.create", ret);
+	}
+	if ((ret = session->close(session, NULL)) != 0)
+		die("session.close", ret);
+}
+
+/*
+ * run --
+ *	Run the threads and report the throughput.
+ */
+void
+run(const char *op, int first)
+{
+	struct timeval start, stop;
+	pthread_t *tids;
+	double seconds;
+	u_int i;
+	int ret;
+
+	if ((tids = calloc((size_t)nthreads, sizeof(*tids))) == NULL)
+		die("calloc", errno);
+
+	(void)gettimeofday(&start, NULL);
+	for (i = 0; i < nthreads; ++i)
+		if ((ret = pthread_create(&tids[i], NULL, opener, &first)) != 0)
+			die("pthread_create", ret);
+	for (i = 0; i < nthreads; ++i)
+		(void)pthread_join(tids[i], NULL);
+	(void)gettimeofday(&stop, NULL);
+
+	seconds = (stop.tv_sec - start.tv_sec) +
+	    (stop.tv_usec - start.tv_usec) / 1e6;
+	printf("%10s: %.2lf seconds (%.0lf opens/second)\n", op, seconds,
+	    ((double)nthreads * (first ? nfiles : nfiles + nops)) / seconds);
+
+	free(tids);
+}
+
+/*
+ * opener --
+ *	Cursor open thread start function.
+ */
+void *
+opener(void *arg)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	u_int i, n, seed;
+	int ret;
+	char name[64];
+
+	if ((ret = conn->open_session(conn, NULL,
+	    cache_cursors ? "cache_cursors=true" : NULL, &session)) != 0)
+		die("conn.open_session", ret);
+
+	/*
+	 * Open every file once in a new session, then, unless this is a first
+	 * open pass, re-open random files.
+	 */
+	seed = (u_int)pthread_self();
+	n = *(int *)arg ? nfiles : nfiles + nops;
+	for (i = 0; i < n; ++i) {
+		(void)snprintf(name, sizeof(name), FNAME,
+		    i < nfiles ? i : (u_int)rand_r(&seed) % nfiles);
+		if ((ret = session->open_cursor(
+		    session, name, NULL, NULL, &cursor)) != 0)
+			die("session.open_cursor", ret);
+		if ((ret = cursor->close(cursor)) != 0)
+			die("cursor.close", ret);
+	}
+
+	if ((ret = session->close(session, NULL)) != 0)
+		die("session.close", ret);
+	return (NULL);
+}
+
+/*
+ * die --
+ *	Report an error and quit.
+ */
+void
+die(const char *m, int e)
+{
+	fprintf(stderr, "%s: %s: %s\n", progname, m, wiredtiger_strerror(e));
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * usage --
+ *	Display usage statement and exit failure.
+ */
+int
+usage(void)
+{
+	fprintf(stderr,
+	    "usage: %s [-c] [-f files] [-n opens] [-t threads]\n", progname);
+	fprintf(stderr, "%s",
+	    "\t-c cache cursors\n"
+	    "\t-f number of files to create\n"
+	    "\t-n number of cursor open/close calls per thread\n"
+	    "\t-t number of threads\n");
+	return (EXIT_FAILURE);
+}
@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_arena01.py
+# 	Page arenas: allocating page modifications
+#
+
+import wiredtiger, wttest
+
+class test_arena01(wttest.WiredTigerTestCase):
+    """
+    Test the chunks allocated for a page's modifications.
+    """
+    uri = 'file:test_arena01'
+    nentries = 1000
+
+    def key(self, i):
+        return 'key%06d' % i
+
+    def arena(self):
+        return (self.stat('page arena: chunks allocated'),
+            self.stat('page arena: bytes allocated in chunks'))
+
+    def insert(self, cursor, i, value):
+        cursor.set_key(self.key(i))
+        cursor.set_value(value)
+        cursor.insert()
+
+    def check(self, values):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for k, v in cursor:
+            self.assertEqual(v, values[k])
+        cursor.close()
+
+    # Inserts into a new page allocate chunks of doubling size: the count
+    # of chunks grows with the log of the bytes inserted.
+    def test_arena_chunks(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        chunks, bytes = self.arena()
+        values = {}
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries):
+            values[self.key(i)] = 'value' + str(i) * 10
+            self.insert(cursor, i, values[self.key(i)])
+        cursor.close()
+
+        nchunks, nbytes = self.arena()
+        self.assertGreater(nchunks - chunks, 1)
+        self.assertLessEqual(nchunks - chunks, 12)
+        self.assertGreaterEqual(
+            nbytes - bytes, sum([len(v) for v in values.values()]))
+        self.check(values)
+
+    # A large object gets a chunk of its own, sized to fit it, and doesn't
+    # take the place of the chunk smaller allocations are made from.
+    def test_arena_large(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        values = {}
+        cursor = self.session.open_cursor(self.uri, None, None)
+        values[self.key(0)] = 'small'
+        self.insert(cursor, 0, values[self.key(0)])
+
+        chunks, bytes = self.arena()
+        values[self.key(1)] = 'large' * 4000
+        self.insert(cursor, 1, values[self.key(1)])
+        nchunks, nbytes = self.arena()
+        self.assertGreaterEqual(nchunks - chunks, 1)
+        self.assertLessEqual(nchunks - chunks, 2)
+        self.assertGreaterEqual(nbytes - bytes, 20000)
+        self.assertLessEqual(nbytes - bytes, 20000 + 1024)
+
+        for i in range(2, self.nentries):
+            values[self.key(i)] = 'small' + str(i)
+            self.insert(cursor, i, values[self.key(i)])
+        cursor.close()
+        self.check(values)
+
+if __name__ == '__main__':
+    wttest.run()
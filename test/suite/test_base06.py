@@ -192,6 +192,44 @@ class test_base06(wttest.WiredTigerTestCase):
         self.assertGreater(newmtime, origmtime)
         self.checkContents(self.table_name1)
 
+    def test_sync_threads(self):
+        # Enough small pages that the root has many children to divide
+        # between the sync threads.
+        uri = 'table:' + self.table_name1
+        nentries = 10000
+        self.session.create(uri, 'key_format=i,value_format=S,' +
+            'internal_page_max=512,leaf_page_max=512')
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(0, nentries):
+            cursor.set_key(i)
+            cursor.set_value(str(i) * 10)
+            cursor.insert()
+        cursor.close()
+        self.session.sync(uri, 'threads=4')
+
+        # Update some of the records, sync again, and check them all once
+        # they're read back from the file.
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(0, nentries, 7):
+            cursor.set_key(i)
+            cursor.set_value('updated')
+            cursor.update()
+        cursor.close()
+        self.session.sync(uri, 'threads=4')
+        self.reopen_conn()
+
+        cursor = self.session.open_cursor(uri, None, None)
+        want = 0
+        for key,val in cursor:
+            self.assertEqual(key, want)
+            if want % 7 == 0:
+                self.assertEqual(val, 'updated')
+            else:
+                self.assertEqual(val, str(want) * 10)
+            want += 1
+        self.assertEqual(want, nentries)
+        cursor.close()
+
 
 if __name__ == '__main__':
     wttest.run()
@@ -0,0 +1,136 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_checkpoint01.py
+# 	Checkpoints: writing files while they're being updated
+#
+
+import wiredtiger, wttest
+
+class test_checkpoint01(wttest.WiredTigerTestCase):
+    """
+    Test checkpoints of files being updated.
+    """
+    tablename = 'test_checkpoint01'
+    nentries = 1000
+
+    scenarios = [
+        ('row', dict(uri='table:', key_format='S')),
+        ('col', dict(uri='table:', key_format='r')),
+        ('file-row', dict(uri='file:', key_format='S')),
+        ]
+
+    def key(self, i):
+        if self.key_format == 'r':
+            return long(i + 1)
+        return 'key%06d' % i
+
+    def setUp(self):
+        wttest.WiredTigerTestCase.setUp(self)
+        self.uri = self.uri + self.tablename
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S' +
+            ',allocation_size=512,leaf_page_max=4096')
+
+    def populate(self, value, start=0, stop=nentries):
+        cursor = self.session.open_cursor(self.uri, None, 'overwrite')
+        for i in range(start, stop):
+            cursor.set_key(self.key(i))
+            cursor.set_value(value + str(i))
+            cursor.insert()
+        cursor.close()
+
+    def check(self, value, count=nentries):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for v in cursor:
+            self.assertEqual(cursor.get_key(), self.key(i))
+            self.assertEqual(cursor.get_value(), value + str(i))
+            i += 1
+        self.assertEqual(i, count)
+        cursor.close()
+
+    def test_checkpoint(self):
+        # Checkpoint while a cursor holds a position in the file, then
+        # keep updating the file and checkpoint again.
+        self.populate('first')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        cursor.next()
+        self.session.checkpoint()
+        self.assertEqual(cursor.get_key(), self.key(0))
+        cursor.close()
+        self.populate('second', 0, self.nentries / 2)
+        self.session.checkpoint()
+        self.session.verify(self.uri, None)
+
+        self.populate('second', self.nentries / 2)
+        self.session.checkpoint()
+        self.check('second')
+
+        self.reopen_conn()
+        self.check('second')
+        self.session.verify(self.uri, None)
+
+    def test_checkpoint_options(self):
+        self.populate('first')
+        self.session.checkpoint()
+        self.assertEqual(self.stat('checkpoints'), 1)
+
+        # A checkpoint within the timeout is skipped, unless forced.
+        self.session.checkpoint('timeout=3600000')
+        self.assertEqual(self.stat('checkpoints'), 1)
+        self.session.checkpoint('force,timeout=3600000')
+        self.assertEqual(self.stat('checkpoints'), 2)
+
+        # Checkpoints aren't permitted in a running transaction.
+        self.session.begin_transaction()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.checkpoint(),
+            '/not permitted in a running transaction/')
+        self.session.rollback_transaction()
+
+        self.reopen_conn()
+        self.check('first')
+
+    def test_checkpoint_no_flush(self):
+        # A checkpoint that doesn't flush the cache doesn't record new
+        # roots: blocks referenced by the last durable root must not be
+        # reused by later writes.
+        self.populate('first')
+        self.session.checkpoint()
+        self.populate('second')
+        self.session.checkpoint('flush_cache=false')
+        self.populate('third')
+        self.session.checkpoint('flush_cache=false')
+        self.session.verify(self.uri, None)
+
+        self.reopen_conn()
+        self.check('third')
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
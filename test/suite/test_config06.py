@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_config06.py
+# 	Reconfigure an open connection
+#
+
+import time
+import wiredtiger, wttest
+
+class test_config06(wttest.WiredTigerTestCase):
+    """
+    Test WT_CONNECTION::reconfigure.
+    """
+    tablename = 'test_config06'
+    nentries = 20000
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=10MB,hazard_max=30' +
+            ',error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def populate(self):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries):
+            cursor.set_key('key%06d' % i)
+            cursor.set_value(str(i) * 20)
+            cursor.insert()
+        cursor.close()
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for v in cursor:
+            self.assertEqual(cursor.get_key(), 'key%06d' % i)
+            self.assertEqual(cursor.get_value(), str(i) * 20)
+            i += 1
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    def test_reconfigure_cache(self):
+        self.uri = 'table:' + self.tablename
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,leaf_page_max=4096')
+        self.populate()
+
+        # Growing the cache takes effect immediately.
+        self.conn.reconfigure('cache_size=20MB')
+        self.assertEqual(
+            self.stat('cache: maximum bytes configured'), 20 * 1024 * 1024)
+
+        # Shrinking the cache takes effect in steps.
+        self.conn.reconfigure('cache_size=2MB,eviction_target=60')
+        for i in range(0, 100):
+            if self.stat('cache: maximum bytes configured') == \
+                2 * 1024 * 1024:
+                break
+            time.sleep(0.1)
+        self.assertEqual(
+            self.stat('cache: maximum bytes configured'), 2 * 1024 * 1024)
+        self.check()
+
+    def test_reconfigure_errors(self):
+        # The eviction target must be less than the trigger.
+        self.assertRaises(wiredtiger.WiredTigerError, lambda:
+            self.conn.reconfigure('eviction_target=90,eviction_trigger=80'))
+        self.assertRaises(wiredtiger.WiredTigerError, lambda:
+            self.conn.reconfigure('eviction_target=96'))
+
+        # Hazard references can be limited, but not beyond the open value.
+        self.conn.reconfigure('hazard_max=20')
+        self.conn.reconfigure('hazard_max=30')
+        self.assertRaises(wiredtiger.WiredTigerError, lambda:
+            self.conn.reconfigure('hazard_max=40'))
+
+        # Options that can only be set when opening are rejected.
+        self.assertRaises(wiredtiger.WiredTigerError, lambda:
+            self.conn.reconfigure('session_max=200'))
+
+if __name__ == '__main__':
+    wttest.run()
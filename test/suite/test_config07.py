@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_config07.py
+# 	Configuration strings: repeated, overridden and mixed-case keys
+#
+
+import wiredtiger, wttest
+
+class test_config07(wttest.WiredTigerTestCase):
+    """
+    Test configuration keys looked up in parsed, cached strings.
+    """
+    niter = 10
+
+    scenarios = [
+        ('repeated', dict(config='key_format=S,value_format=S,key_format=r')),
+        ('override', dict(config='key_format=r,value_format=S')),
+        ('case', dict(config='KEY_FORMAT=r,Value_Format=S')),
+        ('case-repeated',
+            dict(config='key_format=S,value_format=S,Key_Format=r')),
+        ]
+
+    # Each configuration creates record-number keys: a repeated key's last
+    # value wins, the string's keys override the defaults, and keys are
+    # matched without regard to case.  The same string is passed each time,
+    # so after the first call it's found in the session's cache.
+    def test_config_keys(self):
+        for i in range(0, self.niter):
+            uri = 'file:test_config07.' + str(i)
+            self.session.create(uri, self.config)
+            cursor = self.session.open_cursor(uri, None, None)
+            cursor.set_key(long(i + 1))
+            cursor.set_value('value' + str(i))
+            cursor.insert()
+            cursor.close()
+
+            cursor = self.session.open_cursor(uri, None, None)
+            count = 0
+            for k, v in cursor:
+                self.assertEqual(k, long(i + 1))
+                self.assertEqual(v, 'value' + str(i))
+                count += 1
+            self.assertEqual(count, 1)
+            cursor.close()
+
+        self.assertGreater(
+            self.stat('configuration cache: strings found in the cache'), 0)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_cursor06.py
+# 	Read-ahead of cursor scans
+#
+
+import wiredtiger, wttest
+
+class test_cursor06(wttest.WiredTigerTestCase):
+    """
+    Test cursors scanning files read ahead by the read threads.
+    """
+    tablename = 'test_cursor06'
+    nentries = 10000
+
+    scenarios = [
+        ('row', dict(key_format='S')),
+        ('col', dict(key_format='r')),
+        ]
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,read_ahead=8,read_threads=2' +
+            ',error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        if self.key_format == 'r':
+            return long(i + 1)
+        return 'key%06d' % i
+
+    def test_read_ahead(self):
+        uri = 'table:' + self.tablename
+        self.session.create(uri,
+            'key_format=' + self.key_format + ',value_format=S' +
+            ',allocation_size=512,leaf_page_max=512')
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(0, self.nentries):
+            cursor.set_key(self.key(i))
+            cursor.set_value('value' + str(i))
+            cursor.insert()
+        cursor.close()
+
+        # Scan the file once it's only on disk, forward then backward.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(uri, None, None)
+        i = 0
+        for v in cursor:
+            self.assertEqual(cursor.get_key(), self.key(i))
+            self.assertEqual(cursor.get_value(), 'value' + str(i))
+            i += 1
+        self.assertEqual(i, self.nentries)
+        self.assertGreater(self.stat('read-ahead: pages queued'), 0)
+        self.assertGreater(
+            self.stat('read-ahead: pages read ahead found by a cursor scan'),
+            0)
+        cursor.close()
+
+        self.reopen_conn()
+        cursor = self.session.open_cursor(uri, None, None)
+        while cursor.prev() == 0:
+            i -= 1
+            self.assertEqual(cursor.get_key(), self.key(i))
+            self.assertEqual(cursor.get_value(), 'value' + str(i))
+        self.assertEqual(i, 0)
+        self.assertGreater(self.stat('read-ahead: pages queued'), 0)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
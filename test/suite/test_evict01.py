@@ -0,0 +1,143 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_evict01.py
+# 	Dirty pages written ahead of eviction
+#
+
+import threading, time
+import wiredtiger, wttest
+
+class test_evict01(wttest.WiredTigerTestCase):
+    """
+    Test dirty pages written, and kept in the cache, once too much of the
+    cache is dirty.
+    """
+    tablename = 'test_evict01'
+    nentries = 20000
+
+    scenarios = [
+        ('row', dict(key_format='S', cleaners=2)),
+        ('col', dict(key_format='r', cleaners=2)),
+        ('row-server', dict(key_format='S', cleaners=0)),
+        ]
+
+    # A cache large enough the file isn't evicted, with low dirty limits.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=10MB' +
+            ',eviction_dirty_target=5,eviction_dirty_trigger=10' +
+            ',eviction_cleaners=' + str(self.cleaners) +
+            ',error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        if self.key_format == 'r':
+            return long(i + 1)
+        return 'key%06d' % i
+
+    def populate(self, value):
+        cursor = self.session.open_cursor(self.uri, None, 'overwrite')
+        for i in range(0, self.nentries):
+            cursor.set_key(self.key(i))
+            cursor.set_value(value + str(i) * 10)
+            cursor.insert()
+        cursor.close()
+
+    def check(self, value):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for v in cursor:
+            self.assertEqual(cursor.get_key(), self.key(i))
+            self.assertEqual(cursor.get_value(), value + str(i) * 10)
+            i += 1
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    def test_evict(self):
+        self.uri = 'table:' + self.tablename
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S' +
+            ',leaf_page_max=4096')
+
+        # Pages are written in the background: give them a few seconds.
+        self.populate('first')
+        for i in range(0, 50):
+            if self.stat('cache: dirty pages written ahead of eviction') > 0:
+                break
+            time.sleep(0.1)
+        self.assertGreater(
+            self.stat('cache: dirty pages written ahead of eviction'), 0)
+        self.check('first')
+
+        # Update the written pages, they're dirty again.
+        self.populate('second')
+        self.check('second')
+
+        self.reopen_conn()
+        self.check('second')
+        self.session.verify(self.uri, None)
+
+    # Each thread writes every nthreads'th key through its own session, so
+    # the threads update the same pages the cleaners are writing.
+    def write(self, session, t, nthreads, value):
+        cursor = session.open_cursor(self.uri, None, 'overwrite')
+        for i in range(t, self.nentries, nthreads):
+            cursor.set_key(self.key(i))
+            cursor.set_value(value + str(i) * 10)
+            cursor.insert()
+        cursor.close()
+
+    def test_evict_threads(self):
+        self.uri = 'table:' + self.tablename
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S' +
+            ',leaf_page_max=4096')
+        self.populate('first')
+
+        nthreads = 4
+        sessions = [self.conn.open_session(None)
+            for t in range(0, nthreads)]
+        for value in ('second', 'third'):
+            threads = [threading.Thread(target=self.write,
+                args=(sessions[t], t, nthreads, value))
+                for t in range(0, nthreads)]
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            self.check(value)
+        for session in sessions:
+            session.close()
+
+        self.reopen_conn()
+        self.check('third')
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
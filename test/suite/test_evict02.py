@@ -0,0 +1,112 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_evict02.py
+# 	Application threads evicting pages from a full cache
+#
+
+import wiredtiger, wttest
+
+class test_evict02(wttest.WiredTigerTestCase):
+    """
+    Test reading a file larger than the cache, with application threads
+    evicting pages, and with eviction worker threads.
+    """
+    tablename = 'test_evict02'
+    nentries = 20000
+
+    scenarios = [
+        ('row', dict(key_format='S', workers=0)),
+        ('col', dict(key_format='r', workers=0)),
+        ('row-workers', dict(key_format='S', workers=2)),
+        ]
+
+    # A small cache with a low eviction target.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=1MB,eviction_target=50,eviction_trigger=90' +
+            ',eviction_workers=' + str(self.workers) +
+            ',error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        if self.key_format == 'r':
+            return long(i + 1)
+        return 'key%06d' % i
+
+    def value(self, i):
+        return str(i) * 20
+
+    def test_evict(self):
+        self.uri = 'table:' + self.tablename
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S' +
+            ',leaf_page_max=4096')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries):
+            cursor.set_key(self.key(i))
+            cursor.set_value(self.value(i))
+            cursor.insert()
+        cursor.close()
+        self.reopen_conn()
+
+        # Scan and search the file: it's several times the size of the cache.
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for v in cursor:
+            self.assertEqual(cursor.get_key(), self.key(i))
+            self.assertEqual(cursor.get_value(), self.value(i))
+            i += 1
+        self.assertEqual(i, self.nentries)
+        for i in range(0, self.nentries, 7):
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_value(), self.value(i))
+        cursor.close()
+
+        # The wait histogram and application eviction are reported.
+        waits = 0
+        for bucket in ['less than 1ms', '1ms to 10ms',
+            '10ms to 100ms', '100ms or more']:
+            waits += self.stat('cache: application waits for a page: ' +
+                bucket)
+        self.assertGreaterEqual(waits, 0)
+        self.assertGreaterEqual(
+            self.stat('cache: pages evicted by application threads'), 0)
+
+        # The eviction server woke the workers and waited for them to empty
+        # its queue.
+        if self.workers > 0:
+            evicted = 0
+            for i in range(0, self.workers):
+                evicted += self.stat('eviction worker: pages evicted',
+                    'statistics:eviction_worker:' + str(i))
+            self.assertGreater(evicted, 0)
+
+if __name__ == '__main__':
+    wttest.run()
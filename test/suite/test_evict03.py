@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_evict03.py
+# 	Per-file cache priorities and quotas
+#
+
+import time
+import wiredtiger, wttest
+
+class test_evict03(wttest.WiredTigerTestCase):
+    """
+    Test files configured with cache priorities, minimums and quotas.
+    """
+    nentries = 20000
+    cache_size = '10MB'
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=' + self.cache_size +
+            ',error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        return 'key%06d' % i
+
+    def value(self, i):
+        return str(i) * 20
+
+    def cache_bytes(self, uri):
+        return self.stat(
+            'file: bytes currently held in the cache', 'statistics:' + uri)
+
+    def populate(self, uri, config):
+        self.session.create(uri,
+            'key_format=S,value_format=S,leaf_page_max=4096,' + config)
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(0, self.nentries):
+            cursor.set_key(self.key(i))
+            cursor.set_value(self.value(i))
+            cursor.insert()
+        cursor.close()
+
+    def check(self, uri):
+        cursor = self.session.open_cursor(uri, None, None)
+        i = 0
+        for v in cursor:
+            self.assertEqual(cursor.get_key(), self.key(i))
+            self.assertEqual(cursor.get_value(), self.value(i))
+            i += 1
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    # A file over its quota is evicted even if the cache isn't full: once
+    # eviction catches up, the file stays under its quota.
+    def test_cache_max(self):
+        uri = 'file:test_evict03_max'
+        quota = 500 * 1024
+        self.populate(uri, 'cache_max=500KB')
+        self.check(uri)
+        for i in range(0, 100):
+            if self.cache_bytes(uri) <= quota:
+                break
+            time.sleep(0.1)
+        for i in range(0, 10):
+            self.assertLessEqual(self.cache_bytes(uri), quota)
+            time.sleep(0.1)
+        self.check(uri)
+
+    # Files with the same data and the same reads share a cache too small
+    # for both: the file with the higher priority keeps more of it, even
+    # though the other file was read more recently.
+    def test_cache_priority(self):
+        self.cache_size = '3MB'
+        self.reopen_conn()
+        hot = 'file:test_evict03_hot'
+        cold = 'file:test_evict03_cold'
+        self.populate(hot, 'cache_priority=50')
+        self.populate(cold, 'cache_priority=-50')
+        for i in range(0, 3):
+            self.check(hot)
+            self.check(cold)
+        self.assertGreater(self.cache_bytes(hot), self.cache_bytes(cold))
+
+    def test_cache_config(self):
+        uri = 'file:test_evict03_config'
+        self.assertRaises(wiredtiger.WiredTigerError, lambda:
+            self.session.create(uri, 'cache_priority=200'))
+        self.assertRaises(wiredtiger.WiredTigerError, lambda:
+            self.session.create(uri, 'cache_min=2MB,cache_max=1MB'))
+
+if __name__ == '__main__':
+    wttest.run()
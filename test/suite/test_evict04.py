@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_evict04.py
+# 	Saving and restoring the cache's working set
+#
+
+import os, time
+import wiredtiger, wttest
+
+class test_evict04(wttest.WiredTigerTestCase):
+    """
+    Test the cache's working set is saved when the connection is closed,
+    and read back into the cache when it's re-opened.
+    """
+    nentries = 20000
+    uri = 'file:test_evict04'
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=10MB,cache_warm=true,cache_warm_threads=2' +
+            ',error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        return 'key%06d' % i
+
+    def value(self, i):
+        return str(i) * 20
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for v in cursor:
+            self.assertEqual(cursor.get_key(), self.key(i))
+            self.assertEqual(cursor.get_value(), self.value(i))
+            i += 1
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    def test_warm(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,leaf_page_max=4096')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries):
+            cursor.set_key(self.key(i))
+            cursor.set_value(self.value(i))
+            cursor.insert()
+        cursor.close()
+
+        # Closing the connection saves the pages in the cache.
+        self.reopen_conn()
+        self.check()
+        self.close_conn()
+        self.assertTrue(os.path.exists('WiredTiger.warm'))
+
+        # Opening the connection reads them back, and removes the file.
+        self.open_conn()
+        self.assertFalse(os.path.exists('WiredTiger.warm'))
+        for i in range(0, 100):
+            if self.stat('cache: saved pages read back into the cache') > 0:
+                break
+            time.sleep(0.1)
+        self.assertGreater(
+            self.stat('cache: saved pages read back into the cache'), 0)
+        self.check()
+
+    def test_warm_corrupt(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        self.close_conn()
+        f = open('WiredTiger.warm', 'w')
+        f.write('X\tgarbage\n')
+        f.close()
+        with self.expectedStderrPattern('corrupted'):
+            self.open_conn()
+        self.assertFalse(os.path.exists('WiredTiger.warm'))
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,92 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_log01.py
+# 	Logging: log file pre-allocation and archival
+#
+
+import os, time
+import wiredtiger, wttest
+
+class test_log01(wttest.WiredTigerTestCase):
+    """
+    Test log files are archived by checkpoints.
+    """
+    tablename = 'test_log01'
+    uri = 'table:' + tablename
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,logging,log_file_size=1MB,error_prefix="' +
+            self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def logfiles(self):
+        return sorted(f for f in os.listdir('.')
+            if f.startswith('WiredTiger.log.'))
+
+    def update(self, i):
+        self.session.begin_transaction()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        cursor.set_key(i)
+        cursor.set_value('value' + str(i))
+        cursor.insert()
+        cursor.close()
+        self.session.commit_transaction()
+
+    def test_archive(self):
+        # Each run of the database writes a new log file.
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        for i in range(0, 3):
+            self.update(i)
+            self.session.checkpoint()
+            self.reopen_conn()
+        self.update(3)
+        self.assertEqual(len(self.logfiles()), 4)
+
+        # The log files preceding the checkpoint are recycled or removed by
+        # a background thread.
+        self.session.checkpoint('archive')
+        for i in range(0, 100):
+            if len(self.logfiles()) == 1:
+                break
+            time.sleep(0.1)
+        self.assertEqual(self.logfiles(), ['WiredTiger.log.0000000004'])
+
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for k, v in cursor:
+            self.assertEqual(k, i)
+            self.assertEqual(v, 'value' + str(i))
+            i += 1
+        self.assertEqual(i, 4)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_log02.py
+# 	Logging: concurrent commits grouped into log slots
+#
+
+import os, threading
+import wiredtiger, wttest
+
+class test_log02(wttest.WiredTigerTestCase):
+    """
+    Test threads committing concurrently, and a failed log write.
+    """
+    tablename = 'test_log02'
+    uri = 'table:' + tablename
+    ncommits = 200
+
+    scenarios = [
+        ('1', dict(threads=1)),
+        ('8', dict(threads=8)),
+        ('64', dict(threads=64)),
+        ]
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,logging,log_file_size=1MB,error_prefix="' +
+            self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    # Each thread commits its own keys, returning the number of commits
+    # and the error that stopped it, if any.
+    def commit(self, t, ncommits, value, results):
+        session = self.conn.open_session(None)
+        cursor = session.open_cursor(self.uri, None, None)
+        syncs = ['sync=full', 'sync=write', 'sync=background']
+        done = 0
+        error = None
+        try:
+            for i in range(0, ncommits):
+                session.begin_transaction()
+                cursor.set_key(t * ncommits + i)
+                cursor.set_value(value)
+                cursor.insert()
+                session.commit_transaction(syncs[i % len(syncs)])
+                done += 1
+        except wiredtiger.WiredTigerError as e:
+            error = e
+        cursor.close()
+        session.close()
+        results[t] = (done, error)
+
+    def run_threads(self, ncommits, value):
+        results = [None] * self.threads
+        threads = [threading.Thread(target=self.commit,
+            args=(t, ncommits, value, results))
+            for t in range(0, self.threads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join(120)
+            self.assertFalse(t.isAlive())
+        return results
+
+    def test_commit(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        results = self.run_threads(self.ncommits, 'value')
+        for done, error in results:
+            self.assertEqual(error, None)
+            self.assertEqual(done, self.ncommits)
+
+        # Every commit with sync=full waited for its record to be synced.
+        total = self.threads * self.ncommits
+        self.assertGreaterEqual(self.stat('log: records written'), total)
+        self.assertEqual(self.stat('log: records waiting to be synced'),
+            self.threads * ((self.ncommits + 2) / 3))
+        self.assertLessEqual(
+            self.stat('log: writes'), self.stat('log: records written'))
+
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, 'value')
+            count += 1
+        self.assertEqual(count, total)
+        cursor.close()
+
+    def test_write_error(self):
+        # A directory with the next log file's name makes the switch to
+        # that file fail: every thread, including the ones waiting on the
+        # failed write, must see the error rather than wait forever.
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        os.mkdir('WiredTiger.log.0000000002')
+        with self.expectedStderrPattern('WiredTiger.log.0000000002'):
+            results = self.run_threads(10000, 'x' * 1000)
+            self.close_conn()
+        for done, error in results:
+            self.assertNotEqual(error, None)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_recover01.py
+# 	Recovery: opening a database after a crash
+#
+
+import os
+import wiredtiger, wttest
+
+class test_recover01(wttest.WiredTigerTestCase):
+    """
+    Test recovery when a database is opened.
+    """
+    tablename = 'test_recover01'
+    uri = 'table:' + tablename
+    nentries = 1000
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,logging,log_file_size=1MB,recovery_threads=2,' +
+            'error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def populate(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries):
+            cursor.set_key('key%06d' % i)
+            cursor.set_value('value%06d' % i)
+            cursor.insert()
+        cursor.close()
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for k, v in cursor:
+            self.assertEqual(k, 'key%06d' % i)
+            self.assertEqual(v, 'value%06d' % i)
+            i += 1
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    def logfiles(self):
+        return sorted(f for f in os.listdir('.')
+            if f.startswith('WiredTiger.log.'))
+
+    def test_torn_log(self):
+        # A crash can leave a partially written record at the end of the
+        # log: recovery stops at the last complete record, and new records
+        # are written to a new log file.
+        self.populate()
+        self.session.checkpoint()
+        self.session.begin_transaction()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        cursor.set_key('key%06d' % 0)
+        cursor.set_value('value%06d' % 0)
+        cursor.update()
+        cursor.close()
+        self.session.commit_transaction()
+        self.close_conn()
+        logfiles = self.logfiles()
+        self.assertEqual(len(logfiles), 1)
+        log = open(logfiles[0], 'ab')
+        log.write('\x40\x00\x00\x00' + 'torn' * 8)
+        log.close()
+
+        self.open_conn()
+        self.check()
+        self.assertEqual(self.stat('recovery: records replayed'), 0)
+        self.session.begin_transaction()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        cursor.set_key('key%06d' % 1)
+        cursor.set_value('value%06d' % 1)
+        cursor.update()
+        cursor.close()
+        self.session.commit_transaction()
+        self.assertEqual(len(self.logfiles()), 2)
+
+if __name__ == '__main__':
+    wttest.run()
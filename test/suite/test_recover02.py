@@ -0,0 +1,124 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_recover02.py
+# 	Recovery: replaying logged cursor operations
+#
+
+import os, shutil
+import wiredtiger, wttest
+
+class test_recover02(wttest.WiredTigerTestCase):
+    """
+    Test recovery replays the cursor operations logged after a checkpoint,
+    and only the committed transactions' operations.
+    """
+    tablename = 'test_recover02'
+    uri = 'table:' + tablename
+    nentries = 1000
+
+    scenarios = [
+        ('row', dict(key_format='S', compressor=None)),
+        ('col', dict(key_format='r', compressor=None)),
+        ('row-bzip2', dict(key_format='S', compressor='bzip2_compress')),
+        ]
+
+    def config(self):
+        config = 'create,logging,log_file_size=1MB,recovery_threads=2'
+        if self.compressor != None:
+            import run
+            extfile = os.path.join(run.wt_builddir, 'ext/compressors',
+                self.compressor, '.libs', self.compressor + '.so')
+            if not os.path.exists(extfile):
+                self.skipTest('Extension "' + extfile + '" not built')
+            config += ',log_compressor=' + self.compressor + \
+                ',extensions=["' + extfile + '"]'
+        return config
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, self.config() +
+            ',error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        return 'key%06d' % i if self.key_format == 'S' else i + 1
+
+    def value(self, i):
+        return ('value%06d' % i) * 10
+
+    def test_replay(self):
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S')
+        self.session.checkpoint()
+
+        # Half of the records are inserted outside of a transaction, half
+        # in a committed transaction that also removes the first record.
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries / 2):
+            cursor.set_key(self.key(i))
+            cursor.set_value(self.value(i))
+            cursor.insert()
+        self.session.begin_transaction()
+        for i in range(self.nentries / 2, self.nentries):
+            cursor.set_key(self.key(i))
+            cursor.set_value(self.value(i))
+            cursor.insert()
+        cursor.set_key(self.key(0))
+        cursor.remove()
+        self.session.commit_transaction()
+
+        # A rolled back transaction's operations aren't replayed.
+        self.session.begin_transaction()
+        cursor.set_key(self.key(self.nentries))
+        cursor.set_value(self.value(self.nentries))
+        cursor.insert()
+        self.session.rollback_transaction()
+        cursor.close()
+
+        # Copy the database while it's open, as a crash would leave it: the
+        # table's changes since the checkpoint are only in the log.
+        self.session.transaction_sync()
+        os.mkdir('RESTART')
+        for f in os.listdir('.'):
+            if os.path.isfile(f):
+                shutil.copy(f, 'RESTART')
+
+        conn = wiredtiger.wiredtiger_open('RESTART', self.config())
+        session = conn.open_session(None)
+        cursor = session.open_cursor(self.uri, None, None)
+        i = 1
+        for k, v in cursor:
+            self.assertEqual(k, self.key(i))
+            self.assertEqual(v, self.value(i))
+            i += 1
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+        conn.close()
+
+if __name__ == '__main__':
+    wttest.run()
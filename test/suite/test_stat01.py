@@ -29,6 +29,7 @@
 # 	Statistics operations
 #
 
+import threading
 import wiredtiger, wttest
 
 class test_stat01(wttest.WiredTigerTestCase):
@@ -116,5 +117,43 @@ class test_stat01(wttest.WiredTigerTestCase):
                           lambda: self.session.open_cursor(
                               'statistics:file:DoesNotExist', None, None))
 
+    # Each thread inserts its own range of keys through its own session.
+    def insert(self, session, t, nrows):
+        cursor = session.open_cursor('file:' + self.tablename, None, None)
+        for i in range(t * nrows, (t + 1) * nrows):
+            cursor.set_key('%08d' % i)
+            cursor.set_value('value')
+            cursor.insert()
+        cursor.close()
+
+    def test_statistics_threads(self):
+        # Statistics are kept in one copy per session slot (there are 8),
+        # and the copies are summed when read: sessions opened together
+        # update different copies, the sum must count every insert.
+        nthreads = 8
+        nrows = 5000
+        uri = 'file:' + self.tablename
+        self.session.create(uri, 'key_format=S,value_format=S')
+        sessions = [self.conn.open_session(None)
+            for t in range(0, nthreads)]
+        threads = [threading.Thread(target=self.insert,
+            args=(sessions[t], t, nrows)) for t in range(0, nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        for session in sessions:
+            session.close()
+
+        self.assertEqual(
+            self.stat('cursor-inserts', 'statistics:' + uri),
+            nthreads * nrows)
+        cursor = self.session.open_cursor(uri, None, None)
+        count = 0
+        for k, v in cursor:
+            count += 1
+        cursor.close()
+        self.assertEqual(count, nthreads * nrows)
+
 if __name__ == '__main__':
     wttest.run()
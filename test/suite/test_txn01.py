@@ -0,0 +1,184 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn01.py
+# 	Transactions: isolation levels, conflicts and rollback
+#
+
+import threading
+import wiredtiger, wttest
+from wtscenario import multiply_scenarios
+
+class test_txn01(wttest.WiredTigerTestCase):
+    """
+    Test transaction isolation with two sessions.
+    """
+    tablename = 'test_txn01'
+
+    scenarios = [
+        ('row', dict(uri='table:', key_format='S')),
+        ('col', dict(uri='table:', key_format='r')),
+        ('file-row', dict(uri='file:', key_format='S')),
+        ]
+
+    def key(self, i):
+        if self.key_format == 'r':
+            return long(i)
+        return 'key' + str(i)
+
+    def setUp(self):
+        wttest.WiredTigerTestCase.setUp(self)
+        self.uri = self.uri + self.tablename
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S')
+        self.session2 = self.conn.open_session(None)
+
+    def insert(self, session, i, value):
+        cursor = session.open_cursor(self.uri, None, 'overwrite')
+        cursor.set_key(self.key(i))
+        cursor.set_value(value)
+        cursor.insert()
+        cursor.close()
+
+    def check(self, session, i, expected):
+        cursor = session.open_cursor(self.uri, None, None)
+        cursor.set_key(self.key(i))
+        if expected == None:
+            self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        else:
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_value(), expected)
+        cursor.close()
+
+    def test_snapshot(self):
+        self.insert(self.session, 1, 'old')
+        self.session.begin_transaction('isolation=snapshot')
+        self.check(self.session, 1, 'old')
+        self.insert(self.session2, 1, 'new')
+        self.insert(self.session2, 2, 'new')
+
+        # The snapshot doesn't see changes committed after it was taken.
+        self.check(self.session, 1, 'old')
+        self.check(self.session, 2, None)
+
+        # Updating a value changed since the snapshot is a conflict.
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.insert(self.session, 1, 'conflict'))
+        self.session.rollback_transaction()
+        self.check(self.session, 1, 'new')
+        self.check(self.session, 2, 'new')
+
+    def test_read_committed(self):
+        self.insert(self.session, 1, 'old')
+        self.session.begin_transaction()
+        self.check(self.session, 1, 'old')
+        self.insert(self.session2, 1, 'new')
+        self.check(self.session, 1, 'new')
+        self.session.commit_transaction()
+
+    def test_rollback(self):
+        self.insert(self.session, 1, 'old')
+        self.session.begin_transaction()
+        self.insert(self.session, 1, 'updated')
+        self.insert(self.session, 2, 'inserted')
+        self.check(self.session, 1, 'updated')
+
+        # Other sessions don't see uncommitted changes, unless they ask to.
+        self.check(self.session2, 1, 'old')
+        self.check(self.session2, 2, None)
+        self.session2.begin_transaction('isolation=read-uncommitted')
+        self.check(self.session2, 1, 'updated')
+        self.session2.commit_transaction()
+
+        # Updating a value another transaction changed is a conflict.
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.insert(self.session2, 1, 'conflict'))
+
+        self.session.rollback_transaction()
+        self.check(self.session, 1, 'old')
+        self.check(self.session, 2, None)
+
+        # Changes are durable once committed.
+        self.session.begin_transaction()
+        self.insert(self.session, 2, 'committed')
+        self.session.commit_transaction()
+        self.session2.close()
+        self.reopen_conn()
+        self.check(self.session, 1, 'old')
+        self.check(self.session, 2, 'committed')
+
+    # Each thread updates the same key outside of a transaction, returning
+    # the number of updates and the error that stopped it, if any.
+    def update(self, t, nupdates, results):
+        session = self.conn.open_session(None)
+        cursor = session.open_cursor(self.uri, None, 'overwrite')
+        done = 0
+        error = None
+        try:
+            for i in range(0, nupdates):
+                cursor.set_key(self.key(1))
+                cursor.set_value('thread%d-%d' % (t, i))
+                cursor.insert()
+                done += 1
+        except wiredtiger.WiredTigerError as e:
+            error = e
+        cursor.close()
+        session.close()
+        results[t] = (done, error)
+
+    def test_autocommit_threads(self):
+        # Updates outside of a transaction commit as they're made: threads
+        # updating the same key retry conflicts, they never see them.
+        nthreads = 8
+        nupdates = 2000
+        self.insert(self.session, 1, 'old')
+        results = [None] * nthreads
+        threads = [threading.Thread(target=self.update,
+            args=(t, nupdates, results)) for t in range(0, nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join(120)
+            self.assertFalse(t.isAlive())
+        for done, error in results:
+            self.assertEqual(error, None)
+            self.assertEqual(done, nupdates)
+
+        cursor = self.session.open_cursor(self.uri, None, None)
+        cursor.set_key(self.key(1))
+        self.assertEqual(cursor.search(), 0)
+        self.assertTrue(cursor.get_value() in
+            ['thread%d-%d' % (t, nupdates - 1) for t in range(0, nthreads)])
+        cursor.close()
+
+    def test_serializable(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.begin_transaction('isolation=serializable'),
+            '/serializable isolation is not supported/')
+
+if __name__ == '__main__':
+    wttest.run()
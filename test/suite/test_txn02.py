@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn02.py
+# 	Transactions: commit durability levels
+#
+
+import wiredtiger, wttest
+
+class test_txn02(wttest.WiredTigerTestCase):
+    """
+    Test committing transactions with each sync level.
+    """
+    tablename = 'test_txn02'
+    uri = 'table:' + tablename
+    nentries = 100
+
+    scenarios = [
+        ('none', dict(sync='none')),
+        ('write', dict(sync='write')),
+        ('background', dict(sync='background')),
+        ('full', dict(sync='full')),
+        ]
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,logging,log_file_size=1MB,log_flush_period=10,' +
+            'error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def test_commit(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries):
+            self.session.begin_transaction('sync=' + self.sync)
+            cursor.set_key(i)
+            cursor.set_value('value' + str(i))
+            cursor.insert()
+            self.session.commit_transaction()
+        cursor.close()
+
+        # Waiting for the last commit waits for all of the earlier ones.
+        self.session.transaction_sync()
+        self.assertEqual(self.stat('transactions: committed'), self.nentries)
+        self.assertTrue(self.stat('log: records written') >= self.nentries)
+        self.assertTrue(self.stat('log: syncs') > 0)
+
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for k, v in cursor:
+            self.assertEqual(k, i)
+            self.assertEqual(v, 'value' + str(i))
+            i += 1
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    def test_sync_running(self):
+        self.session.begin_transaction('sync=' + self.sync)
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.session.transaction_sync())
+        self.session.rollback_transaction()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_util13.py
+#	Utilities: wt printlog
+#
+
+from suite_subprocess import suite_subprocess
+import wiredtiger, wttest
+
+class test_util13(wttest.WiredTigerTestCase, suite_subprocess):
+    tablename = 'test_util13.a'
+    nentries = 100
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,logging,error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def populate(self):
+        """
+        Insert records outside of a transaction and in a transaction
+        """
+        self.session.create('table:' + self.tablename,
+            'key_format=S,value_format=S')
+        cursor = self.session.open_cursor('table:' + self.tablename, None, None)
+        for i in range(0, self.nentries):
+            if i == self.nentries / 2:
+                self.session.begin_transaction()
+            cursor.set_key('key%06d' % i)
+            cursor.set_value('value%06d' % i)
+            cursor.insert()
+        self.session.commit_transaction()
+        cursor.close()
+
+    def test_printlog(self):
+        self.populate()
+        outfile = 'printlog.out'
+        self.runWt(['-C', 'logging', 'printlog', '-p'], outfilename=outfile)
+        self.check_file_contains(outfile, 'row_put fileid=')
+        self.check_file_contains(outfile, 'key=key000000')
+        self.check_file_contains(outfile, 'value=value000000')
+        self.check_file_contains(outfile, 'commit txnid=')
+        self.check_file_contains(outfile, '\trow_put fileid=')
+
+    def test_printlog_hex(self):
+        self.populate()
+        outfile = 'printlog.out'
+        self.runWt(['-C', 'logging', 'printlog'], outfilename=outfile)
+        self.check_file_contains(outfile,
+            'key=' + 'key000000'.encode('hex') + '00')
+
+    def test_printlog_no_logging(self):
+        self.populate()
+        errfile = 'printlogerr.txt'
+        self.runWt(['printlog'], errfilename=errfile)
+        self.check_file_contains(errfile, 'logging is not configured')
+
+if __name__ == '__main__':
+    wttest.run()
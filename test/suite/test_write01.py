@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_write01.py
+# 	Block write threads: pages written by eviction and checkpoints
+#
+
+import wiredtiger, wttest
+
+class test_write01(wttest.WiredTigerTestCase):
+    """
+    Test files written by the block write threads.
+    """
+    tablename = 'test_write01'
+    nentries = 20000
+
+    scenarios = [
+        ('row', dict(key_format='S', threads=4)),
+        ('col', dict(key_format='r', threads=4)),
+        ('row-1', dict(key_format='S', threads=1)),
+        ]
+
+    # A small cache, so pages are evicted while the file is loaded.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=1MB,write_threads=' + str(self.threads) +
+            ',error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        if self.key_format == 'r':
+            return long(i + 1)
+        return 'key%06d' % i
+
+    def populate(self, value):
+        cursor = self.session.open_cursor(self.uri, None, 'overwrite')
+        for i in range(0, self.nentries):
+            cursor.set_key(self.key(i))
+            cursor.set_value(value + str(i) * 10)
+            cursor.insert()
+        cursor.close()
+
+    def check(self, value):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for v in cursor:
+            self.assertEqual(cursor.get_key(), self.key(i))
+            self.assertEqual(cursor.get_value(), value + str(i) * 10)
+            i += 1
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    def test_write(self):
+        self.uri = 'table:' + self.tablename
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S' +
+            ',allocation_size=512,leaf_page_max=4096')
+
+        # Evicted pages are read back while their writes may be queued.
+        self.populate('first')
+        self.check('first')
+        self.assertGreater(self.stat('write queue: blocks queued'), 0)
+
+        # Rewrite the file: blocks freed while their writes are queued are
+        # re-used once they're written.
+        self.populate('second')
+        self.session.checkpoint()
+        self.check('second')
+        self.session.verify(self.uri, None)
+
+        self.reopen_conn()
+        self.check('second')
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -338,6 +338,20 @@ class WiredTigerTestCase(unittest.TestCase):
             with self.expectedStderr(message):
                 self.assertRaises(exceptionType, expr)
             
+    def stat(self, desc, uri='statistics:'):
+        """
+        Return the value of a statistic, given its description, from
+        a statistics cursor opened on uri.  The test fails if there's
+        no such statistic.
+        """
+        cursor = self.session.open_cursor(uri, None, None)
+        for id, d, valstr, val in cursor:
+            if d == desc:
+                cursor.close()
+                return val
+        cursor.close()
+        self.fail('statistic not found: ' + desc)
+
     @staticmethod
     def printOnce(msg):
         # There's a race condition with multiple threads,
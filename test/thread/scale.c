@@ -0,0 +1,189 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "thread.h"
+
+static void *inserter(void *);
+static void *searcher(void *);
+
+typedef struct {
+	u_int id;				/* Thread ID */
+	u_int nthreads;				/* Threads in this pass */
+	u_int base;				/* First key for this pass */
+} INSERT_ARGS;
+
+static void scale_pass(
+    const char *, void *(*)(void *), INSERT_ARGS *, pthread_t *, u_int, u_int);
+
+/*
+ * scale --
+ *	Measure insert throughput as the number of inserting threads grows,
+ * doubling the thread count on each pass up to the maximum, then measure
+ * search throughput the same way.
+ */
+void
+scale(u_int max_threads)
+{
+	INSERT_ARGS *args;
+	pthread_t *tids;
+	u_int base, nthreads;
+
+	if ((args = calloc((size_t)max_threads, sizeof(*args))) == NULL ||
+	    (tids = calloc((size_t)max_threads, sizeof(*tids))) == NULL)
+		die("calloc", errno);
+
+	/*
+	 * Every pass inserts a new range of keys, past the loaded keys and any
+	 * keys inserted by previous passes, so every operation is an insert.
+	 */
+	base = nkeys;
+	for (nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+		scale_pass("inserts", inserter, args, tids, nthreads, base);
+		base += nthreads * nops;
+	}
+
+	for (nthreads = 1; nthreads <= max_threads; nthreads *= 2)
+		scale_pass("searches", searcher, args, tids, nthreads, base);
+
+	free(args);
+	free(tids);
+}
+
+/*
+ * scale_pass --
+ *	Run a single pass of threads and report the throughput.
+ */
+static void
+scale_pass(const char *op, void *(*func)(void *),
+    INSERT_ARGS *args, pthread_t *tids, u_int nthreads, u_int base)
+{
+	struct timeval start, stop;
+	double seconds;
+	u_int i;
+	int ret;
+
+	(void)gettimeofday(&start, NULL);
+
+	for (i = 0; i < nthreads; ++i) {
+		args[i].id = i;
+		args[i].nthreads = nthreads;
+		args[i].base = base;
+		if ((ret = pthread_create(&tids[i], NULL, func, &args[i])) != 0)
+			die("pthread_create", ret);
+	}
+	for (i = 0; i < nthreads; ++i)
+		(void)pthread_join(tids[i], NULL);
+
+	(void)gettimeofday(&stop, NULL);
+	seconds = (stop.tv_sec - start.tv_sec) +
+	    (stop.tv_usec - start.tv_usec) / 1e6;
+	printf("%4u threads: %.2lf seconds (%.0lf %s/second)\n",
+	    nthreads, seconds, (nthreads * nops) / seconds, op);
+}
+
+/*
+ * inserter --
+ *	Insert thread start function.
+ */
+static void *
+inserter(void *arg)
+{
+	INSERT_ARGS *args;
+	WT_CURSOR *cursor;
+	WT_ITEM *key, _key, *value, _value;
+	WT_SESSION *session;
+	u_int i, keyno;
+	int ret;
+	char keybuf[64], valuebuf[64];
+
+	args = arg;
+	key = &_key;
+	value = &_value;
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.open_session", ret);
+	if ((ret = session->open_cursor(
+	    session, FNAME, NULL, NULL, &cursor)) != 0)
+		die("session.open_cursor", ret);
+
+	/*
+	 * Interleave the threads' keys so they contend for the same pages:
+	 * unrelated pages never contended with each other, the interesting
+	 * case is concurrent inserts into a single page.
+	 */
+	for (i = 0; i < nops; ++i) {
+		keyno = args->base + i * args->nthreads + args->id + 1;
+		if (ftype == ROW) {
+			key->data = keybuf;
+			key->size = (uint32_t)
+			    snprintf(keybuf, sizeof(keybuf), "%017u", keyno);
+			cursor->set_key(cursor, key);
+		} else
+			cursor->set_key(cursor, (uint32_t)keyno);
+		if (ftype == FIX)
+			cursor->set_value(cursor, 0x01);
+		else {
+			value->data = valuebuf;
+			value->size = (uint32_t)
+			    snprintf(valuebuf, sizeof(valuebuf), "%37u", keyno);
+			cursor->set_value(cursor, value);
+		}
+		if ((ret = cursor->insert(cursor)) != 0)
+			die("cursor.insert", ret);
+	}
+
+	if ((ret = session->close(session, NULL)) != 0)
+		die("session.close", ret);
+	return (NULL);
+}
+
+/*
+ * searcher --
+ *	Search thread start function.
+ */
+static void *
+searcher(void *arg)
+{
+	INSERT_ARGS *args;
+	WT_CURSOR *cursor;
+	WT_ITEM *key, _key;
+	WT_SESSION *session;
+	u_int i, keyno;
+	int ret;
+	char keybuf[64];
+
+	args = arg;
+	key = &_key;
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.open_session", ret);
+	if ((ret = session->open_cursor(
+	    session, FNAME, NULL, NULL, &cursor)) != 0)
+		die("session.open_cursor", ret);
+
+	/*
+	 * Step through the loaded keys with a large prime stride, so the
+	 * threads search different keys, spread across the file.
+	 */
+	for (i = 0; i < nops; ++i) {
+		keyno = (u_int)(((uint64_t)i * args->nthreads + args->id) *
+		    1000003 % nkeys);
+		if (ftype == ROW) {
+			key->data = keybuf;
+			key->size = (uint32_t)
+			    snprintf(keybuf, sizeof(keybuf), "%017u", keyno);
+			cursor->set_key(cursor, key);
+		} else
+			cursor->set_key(cursor, (uint32_t)keyno);
+		if ((ret = cursor->search(cursor)) != 0)
+			die("cursor.search", ret);
+	}
+
+	if ((ret = session->close(session, NULL)) != 0)
+		die("session.close", ret);
+	return (NULL);
+}
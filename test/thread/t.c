@@ -11,6 +11,7 @@ WT_CONNECTION *conn;				/* WiredTiger connection */
 __ftype ftype;					/* File type */
 u_int nkeys, nops;				/* Keys, Operations */
 int session_per_op;				/* New session per operation */
+int insert_scale;				/* Insert scaling benchmark */
 
 static char *progname;				/* Program name */
 static FILE *logfp;				/* Log file */
@@ -36,6 +37,7 @@ main(int argc, char *argv[])
 
 	config_open = NULL;
 	ftype = ROW;
+	insert_scale = 0;
 	nkeys = 1000;
 	nops = 10000;
 	readers = 10;
@@ -43,7 +45,7 @@ main(int argc, char *argv[])
 	session_per_op = 0;
 	writers = 10;
 
-	while ((ch = getopt(argc, argv, "1C:k:l:n:R:r:St:W:")) != EOF)
+	while ((ch = getopt(argc, argv, "1C:Ik:l:n:R:r:St:W:")) != EOF)
 		switch (ch) {
 		case '1':			/* One run */
 			runs = 1;
@@ -51,6 +53,9 @@ main(int argc, char *argv[])
 		case 'C':			/* wiredtiger_open config */
 			config_open = optarg;
 			break;
+		case 'I':			/* Insert scaling benchmark */
+			insert_scale = 1;
+			break;
 		case 'k':			/* rows */
 			nkeys = (u_int)atoi(optarg);
 			break;
@@ -114,7 +119,9 @@ main(int argc, char *argv[])
 
 		load();				/* Load initial records */
 						/* Loop operations */
-		if (run(readers, writers))
+		if (insert_scale)
+			scale(writers);
+		else if (run(readers, writers))
 			return (EXIT_FAILURE);
 
 		stats();			/* Statistics */
@@ -229,12 +236,13 @@ usage(void)
 {
 	fprintf(stderr,
 	    "usage: %s "
-	    "[-1S] [-C wiredtiger-config] [-k keys] [-l log]\n\t"
+	    "[-1IS] [-C wiredtiger-config] [-k keys] [-l log]\n\t"
 	    "[-n ops] [-R readers] [-r runs] [-t f|r|v] [-W writers]\n",
 	    progname);
 	fprintf(stderr, "%s",
 	    "\t-1 run once\n"
 	    "\t-C specify wiredtiger_open configuration arguments\n"
+	    "\t-I measure insert and search throughput from 1 to W threads\n"
 	    "\t-k set number of keys to load\n"
 	    "\t-l specify a log file\n"
 	    "\t-n set number of operations each thread does\n"
@@ -32,6 +32,7 @@ extern __ftype ftype;
 extern u_int nkeys;				/* Keys to load */
 extern u_int nops;				/* Operations per thread */
 extern int   session_per_op;			/* New session per operation */
+extern int   insert_scale;			/* Insert scaling benchmark */
 
 #if defined (__GNUC__)
 void die(const char *, int) __attribute__((noreturn));
@@ -40,4 +41,5 @@ void die(const char *, int);
 #endif
 void load(void);
 int  run(u_int, u_int);
+void scale(u_int);
 void stats(void);